@@ -18,6 +18,12 @@ void APUDishGiver::BeginPlay()
 {
     Super::BeginPlay();
     
+    // Search for a solvable order in the background so it's ready before the first conversation
+    if (IsValid(OrderComponent))
+    {
+        OrderComponent->RequestSolvableOrder();
+    }
+    
     //UE_LOG(LogTemp,Log, TEXT("APUDishGiver::BeginPlay - Dish giver initialized: %s"), *GetTalkingObjectDisplayName().ToString());
 }
 
@@ -47,6 +53,11 @@ void APUDishGiver::StartInteraction()
         //UE_LOG(LogTemp,Display, TEXT("APUDishGiver::StartInteraction - Player already has an active order: %s"), 
             //*PlayerChar->GetCurrentOrder().OrderID.ToString());
     }
+    // No order yet - make sure one is being searched for while the dialogue plays (no-op if already ready)
+    else if (IsValid(OrderComponent))
+    {
+        OrderComponent->RequestSolvableOrder();
+    }
     
     // Don't generate orders automatically - let dialogue control this
     // Just start the dialogue system
@@ -490,7 +501,7 @@ void APUDishGiver::AnalyzeCompletedDish(const FPUOrderBase& CompletedOrder)
     TMap<FGameplayTag, int32> IngredientQuantities;
     for (const FIngredientInstance& Instance : CompletedDish.IngredientInstances)
     {
-        IngredientQuantities.FindOrAdd(Instance.IngredientData.IngredientTag) += Instance.Quantity;
+        IngredientQuantities.FindOrAdd(Instance.IngredientTag) += Instance.Quantity;
     }
     
     // Find the ingredient with highest quantity
@@ -510,7 +521,7 @@ void APUDishGiver::AnalyzeCompletedDish(const FPUOrderBase& CompletedOrder)
     PreparationCount = 0;
     for (const FIngredientInstance& Instance : CompletedDish.IngredientInstances)
     {
-        if (Instance.IngredientData.ActivePreparations.Num() > 0)
+        if (Instance.Preparations.Num() > 0)
         {
             PreparationCount++;
         }
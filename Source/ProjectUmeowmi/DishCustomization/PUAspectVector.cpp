@@ -0,0 +1,185 @@
+#include "PUAspectVector.h"
+#include "PUIngredientBase.h"
+#include "PUDishBase.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+
+namespace PUAspects
+{
+    // Names indexed by lane (FName construction happens once, on first use)
+    static const FName* GetLaneNames()
+    {
+        static const FName LaneNames[NumLanes] =
+        {
+            FName(TEXT("Umami")),
+            FName(TEXT("Salt")),
+            FName(TEXT("Sweet")),
+            FName(TEXT("Sour")),
+            FName(TEXT("Bitter")),
+            FName(TEXT("Spicy")),
+            FName(TEXT("Rich")),
+            FName(TEXT("Juicy")),
+            FName(TEXT("Tender")),
+            FName(TEXT("Chewy")),
+            FName(TEXT("Crispy")),
+            FName(TEXT("Crumbly"))
+        };
+        return LaneNames;
+    }
+
+    int32 ResolveFlavorIndex(const FName& AspectName)
+    {
+        const FName* LaneNames = GetLaneNames();
+        for (int32 Index = 0; Index < NumFlavorLanes; ++Index)
+        {
+            if (LaneNames[Index] == AspectName)
+            {
+                return Index;
+            }
+        }
+        return INDEX_NONE;
+    }
+
+    int32 ResolveTextureIndex(const FName& AspectName)
+    {
+        const FName* LaneNames = GetLaneNames();
+        for (int32 Index = NumFlavorLanes; Index < NumLanes; ++Index)
+        {
+            if (LaneNames[Index] == AspectName)
+            {
+                return Index;
+            }
+        }
+        return INDEX_NONE;
+    }
+
+    int32 ResolveAspectIndex(uint8 AspectType, const FName& AspectName)
+    {
+        if (AspectType == 0)
+        {
+            return ResolveFlavorIndex(AspectName);
+        }
+        if (AspectType == 1)
+        {
+            return ResolveTextureIndex(AspectName);
+        }
+        return INDEX_NONE;
+    }
+
+    FName GetAspectName(int32 AspectIndex)
+    {
+        if (AspectIndex < 0 || AspectIndex >= NumLanes)
+        {
+            return NAME_None;
+        }
+        return GetLaneNames()[AspectIndex];
+    }
+}
+
+#if !UE_BUILD_SHIPPING
+namespace
+{
+    // Previous string-matched lookup, kept only as the "before" side of the benchmark below.
+    float LegacyGetFlavorAspect(const FFlavorAspects& FlavorAspects, const FName& AspectName)
+    {
+        FString AspectStr = AspectName.ToString().ToLower();
+
+        if (AspectStr == TEXT("umami"))
+            return FlavorAspects.Umami;
+        else if (AspectStr == TEXT("sweet"))
+            return FlavorAspects.Sweet;
+        else if (AspectStr == TEXT("salt"))
+            return FlavorAspects.Salt;
+        else if (AspectStr == TEXT("sour"))
+            return FlavorAspects.Sour;
+        else if (AspectStr == TEXT("bitter"))
+            return FlavorAspects.Bitter;
+        else if (AspectStr == TEXT("spicy"))
+            return FlavorAspects.Spicy;
+
+        return 0.0f;
+    }
+
+    float LegacyGetTotalFlavorAspect(const FPUDishBase& Dish, const FName& AspectName)
+    {
+        float TotalValue = 0.0f;
+        for (const FIngredientInstance& Instance : Dish.IngredientInstances)
+        {
+            TotalValue += LegacyGetFlavorAspect(Instance.FlavorAspects, AspectName) * Instance.Quantity;
+        }
+        return TotalValue;
+    }
+
+    // Micro-benchmark: string-matched vs index-based aspect totals on a synthetic dish.
+    // Usage: pu.Aspects.Benchmark [NumInstances] [NumIterations]
+    void RunAspectBenchmark(const TArray<FString>& Args)
+    {
+        const int32 NumInstances = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 64;
+        const int32 NumIterations = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 2000;
+
+        FPUDishBase Dish;
+        Dish.IngredientInstances.SetNum(NumInstances);
+        for (int32 Index = 0; Index < NumInstances; ++Index)
+        {
+            FIngredientInstance& Instance = Dish.IngredientInstances[Index];
+            Instance.InstanceID = Index + 1;
+            Instance.Quantity = 1 + (Index % 3);
+            Instance.FlavorAspects.Umami = static_cast<float>(Index % 5);
+            Instance.FlavorAspects.Salt = static_cast<float>((Index + 1) % 5);
+            Instance.FlavorAspects.Spicy = static_cast<float>((Index + 2) % 5);
+            Instance.TextureAspects.Crispy = static_cast<float>((Index + 3) % 5);
+        }
+
+        const FName FlavorNames[] = { FName(TEXT("Umami")), FName(TEXT("Salt")), FName(TEXT("Sweet")), FName(TEXT("Sour")), FName(TEXT("Bitter")), FName(TEXT("Spicy")) };
+
+        // Before: six string-matched totals (what the radar chart used to do per refresh)
+        float LegacySink = 0.0f;
+        const double LegacyStart = FPlatformTime::Seconds();
+        for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+        {
+            for (const FName& AspectName : FlavorNames)
+            {
+                LegacySink += LegacyGetTotalFlavorAspect(Dish, AspectName);
+            }
+        }
+        const double LegacySeconds = FPlatformTime::Seconds() - LegacyStart;
+
+        // After (scalar): per-name index resolution once, then lane reads
+        float IndexedSink = 0.0f;
+        const double IndexedStart = FPlatformTime::Seconds();
+        for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+        {
+            for (const FName& AspectName : FlavorNames)
+            {
+                IndexedSink += Dish.GetTotalFlavorAspect(AspectName);
+            }
+        }
+        const double IndexedSeconds = FPlatformTime::Seconds() - IndexedStart;
+
+        // After (vector): all 12 lanes in one pass
+        float VectorSink = 0.0f;
+        const double VectorStart = FPlatformTime::Seconds();
+        for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+        {
+            const FPUAspectVector Totals = Dish.GetTotalAspects();
+            VectorSink += Totals.SumFlavor();
+        }
+        const double VectorSeconds = FPlatformTime::Seconds() - VectorStart;
+
+        const double Scale = 1.0e6 / NumIterations;
+        UE_LOG(LogTemp, Display, TEXT("pu.Aspects.Benchmark: %d instances, %d iterations"), NumInstances, NumIterations);
+        UE_LOG(LogTemp, Display, TEXT("  string-matched (6 totals):  %8.3f us/iter (checksum %.1f)"), LegacySeconds * Scale, LegacySink);
+        UE_LOG(LogTemp, Display, TEXT("  index-based    (6 totals):  %8.3f us/iter (checksum %.1f)"), IndexedSeconds * Scale, IndexedSink);
+        UE_LOG(LogTemp, Display, TEXT("  aspect vector  (12 lanes):  %8.3f us/iter (checksum %.1f)"), VectorSeconds * Scale, VectorSink);
+        if (IndexedSeconds > 0.0 && VectorSeconds > 0.0)
+        {
+            UE_LOG(LogTemp, Display, TEXT("  speedup: %.1fx (index), %.1fx (vector)"), LegacySeconds / IndexedSeconds, LegacySeconds / VectorSeconds);
+        }
+    }
+
+    FAutoConsoleCommand GPUAspectBenchmarkCommand(
+        TEXT("pu.Aspects.Benchmark"),
+        TEXT("Compare string-matched and index-based dish aspect totals. Usage: pu.Aspects.Benchmark [NumInstances] [NumIterations]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&RunAspectBenchmark));
+}
+#endif
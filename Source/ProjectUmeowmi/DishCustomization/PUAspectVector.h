@@ -0,0 +1,203 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/VectorRegister.h"
+
+// Lane indices for the packed aspect vector (6 flavors followed by 6 textures)
+// Order matches the member order of FFlavorAspects and FTextureAspects so both can be copied in directly.
+enum class EPUAspectIndex : uint8
+{
+    // Flavor lanes
+    Umami = 0,
+    Salt,
+    Sweet,
+    Sour,
+    Bitter,
+    Spicy,
+
+    // Texture lanes
+    Rich,
+    Juicy,
+    Tender,
+    Chewy,
+    Crispy,
+    Crumbly,
+
+    Count
+};
+
+namespace PUAspects
+{
+    constexpr int32 NumFlavorLanes = 6;
+    constexpr int32 NumTextureLanes = 6;
+    constexpr int32 NumLanes = NumFlavorLanes + NumTextureLanes;
+    constexpr int32 NumBlocks = NumLanes / 4;
+
+    static_assert(NumLanes % 4 == 0, "Aspect lanes must pack into whole 4-wide vector registers");
+
+    // Resolve a flavor aspect name (e.g. "Umami") to its lane index, or INDEX_NONE.
+    // FName comparison is case-insensitive, so this matches the old ToLower() string compares without allocating.
+    PROJECTUMEOWMI_API int32 ResolveFlavorIndex(const FName& AspectName);
+
+    // Resolve a texture aspect name (e.g. "Crispy") to its lane index, or INDEX_NONE.
+    PROJECTUMEOWMI_API int32 ResolveTextureIndex(const FName& AspectName);
+
+    // Resolve an aspect name for the given type (0 = Flavor, 1 = Texture, matches EAspectType)
+    PROJECTUMEOWMI_API int32 ResolveAspectIndex(uint8 AspectType, const FName& AspectName);
+
+    // Get the display name for a lane index
+    PROJECTUMEOWMI_API FName GetAspectName(int32 AspectIndex);
+
+    FORCEINLINE bool IsFlavorIndex(int32 AspectIndex)
+    {
+        return AspectIndex >= 0 && AspectIndex < NumFlavorLanes;
+    }
+
+    FORCEINLINE bool IsTextureIndex(int32 AspectIndex)
+    {
+        return AspectIndex >= NumFlavorLanes && AspectIndex < NumLanes;
+    }
+}
+
+// Packed 12-lane aspect vector (flavor + texture), stored as three aligned 4-wide registers.
+// Used for all hot-path aspect math; FFlavorAspects/FTextureAspects remain the Blueprint-facing views.
+struct FPUAspectVector
+{
+    alignas(16) float Lanes[PUAspects::NumLanes];
+
+    FPUAspectVector()
+    {
+        SetZero();
+    }
+
+    FORCEINLINE void SetZero()
+    {
+        const VectorRegister4Float Zero = VectorZeroFloat();
+        for (int32 Block = 0; Block < PUAspects::NumBlocks; ++Block)
+        {
+            VectorStoreAligned(Zero, &Lanes[Block * 4]);
+        }
+    }
+
+    FORCEINLINE static FPUAspectVector Splat(float Value)
+    {
+        FPUAspectVector Result;
+        const VectorRegister4Float Splatted = VectorSetFloat1(Value);
+        for (int32 Block = 0; Block < PUAspects::NumBlocks; ++Block)
+        {
+            VectorStoreAligned(Splatted, &Result.Lanes[Block * 4]);
+        }
+        return Result;
+    }
+
+    FORCEINLINE float& operator[](int32 AspectIndex)
+    {
+        checkSlow(AspectIndex >= 0 && AspectIndex < PUAspects::NumLanes);
+        return Lanes[AspectIndex];
+    }
+
+    FORCEINLINE float operator[](int32 AspectIndex) const
+    {
+        checkSlow(AspectIndex >= 0 && AspectIndex < PUAspects::NumLanes);
+        return Lanes[AspectIndex];
+    }
+
+    FORCEINLINE float& operator[](EPUAspectIndex AspectIndex)
+    {
+        return Lanes[static_cast<int32>(AspectIndex)];
+    }
+
+    FORCEINLINE float operator[](EPUAspectIndex AspectIndex) const
+    {
+        return Lanes[static_cast<int32>(AspectIndex)];
+    }
+
+    // this += Other
+    FORCEINLINE FPUAspectVector& operator+=(const FPUAspectVector& Other)
+    {
+        for (int32 Block = 0; Block < PUAspects::NumBlocks; ++Block)
+        {
+            VectorStoreAligned(VectorAdd(VectorLoadAligned(&Lanes[Block * 4]), VectorLoadAligned(&Other.Lanes[Block * 4])), &Lanes[Block * 4]);
+        }
+        return *this;
+    }
+
+    // this -= Other
+    FORCEINLINE FPUAspectVector& operator-=(const FPUAspectVector& Other)
+    {
+        for (int32 Block = 0; Block < PUAspects::NumBlocks; ++Block)
+        {
+            VectorStoreAligned(VectorSubtract(VectorLoadAligned(&Lanes[Block * 4]), VectorLoadAligned(&Other.Lanes[Block * 4])), &Lanes[Block * 4]);
+        }
+        return *this;
+    }
+
+    // this *= Other (per lane)
+    FORCEINLINE FPUAspectVector& operator*=(const FPUAspectVector& Other)
+    {
+        for (int32 Block = 0; Block < PUAspects::NumBlocks; ++Block)
+        {
+            VectorStoreAligned(VectorMultiply(VectorLoadAligned(&Lanes[Block * 4]), VectorLoadAligned(&Other.Lanes[Block * 4])), &Lanes[Block * 4]);
+        }
+        return *this;
+    }
+
+    // this += Other * Scale (used for quantity-weighted dish totals)
+    FORCEINLINE void AddScaled(const FPUAspectVector& Other, float Scale)
+    {
+        const VectorRegister4Float ScaleVec = VectorSetFloat1(Scale);
+        for (int32 Block = 0; Block < PUAspects::NumBlocks; ++Block)
+        {
+            VectorStoreAligned(VectorMultiplyAdd(VectorLoadAligned(&Other.Lanes[Block * 4]), ScaleVec, VectorLoadAligned(&Lanes[Block * 4])), &Lanes[Block * 4]);
+        }
+    }
+
+    // this = this * Mul + Add (per lane affine transform, used by preparations and time/temp)
+    FORCEINLINE void MultiplyAdd(const FPUAspectVector& Mul, const FPUAspectVector& Add)
+    {
+        for (int32 Block = 0; Block < PUAspects::NumBlocks; ++Block)
+        {
+            VectorStoreAligned(VectorMultiplyAdd(VectorLoadAligned(&Lanes[Block * 4]), VectorLoadAligned(&Mul.Lanes[Block * 4]), VectorLoadAligned(&Add.Lanes[Block * 4])), &Lanes[Block * 4]);
+        }
+    }
+
+    // Per-lane select: lanes whose Mask bits are set take the value from Source, the rest are left unchanged
+    FORCEINLINE void SelectFrom(const FPUAspectVector& Mask, const FPUAspectVector& Source)
+    {
+        for (int32 Block = 0; Block < PUAspects::NumBlocks; ++Block)
+        {
+            VectorStoreAligned(VectorSelect(VectorLoadAligned(&Mask.Lanes[Block * 4]), VectorLoadAligned(&Source.Lanes[Block * 4]), VectorLoadAligned(&Lanes[Block * 4])), &Lanes[Block * 4]);
+        }
+    }
+
+    // Set every bit of a lane (builds masks for SelectFrom)
+    FORCEINLINE void SetLaneMask(int32 AspectIndex)
+    {
+        checkSlow(AspectIndex >= 0 && AspectIndex < PUAspects::NumLanes);
+        FMemory::Memset(&Lanes[AspectIndex], 0xFF, sizeof(float));
+    }
+
+    // Clamp to >= 0 and round to the nearest 0.5 increment (matches FMath::RoundToFloat(Value * 2) / 2)
+    FORCEINLINE void ClampAndRoundToHalf()
+    {
+        const VectorRegister4Float Zero = VectorZeroFloat();
+        const VectorRegister4Float Two = VectorSetFloat1(2.0f);
+        const VectorRegister4Float Half = VectorSetFloat1(0.5f);
+        for (int32 Block = 0; Block < PUAspects::NumBlocks; ++Block)
+        {
+            VectorRegister4Float Value = VectorMax(VectorLoadAligned(&Lanes[Block * 4]), Zero);
+            Value = VectorMultiply(VectorFloor(VectorMultiplyAdd(Value, Two, Half)), Half);
+            VectorStoreAligned(Value, &Lanes[Block * 4]);
+        }
+    }
+
+    FORCEINLINE float SumFlavor() const
+    {
+        return Lanes[0] + Lanes[1] + Lanes[2] + Lanes[3] + Lanes[4] + Lanes[5];
+    }
+
+    FORCEINLINE float SumTexture() const
+    {
+        return Lanes[6] + Lanes[7] + Lanes[8] + Lanes[9] + Lanes[10] + Lanes[11];
+    }
+};
@@ -0,0 +1,111 @@
+#include "PUBakeTextureColorsCommandlet.h"
+#include "PUTextureColorCache.h"
+#include "PUIngredientBase.h"
+#include "PUIngredientCatalogSubsystem.h"
+#include "Engine/DataTable.h"
+#include "Engine/Texture2D.h"
+#include "ImageCore.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+
+UPUBakeTextureColorsCommandlet::UPUBakeTextureColorsCommandlet()
+{
+    IsClient = false;
+    IsEditor = true;
+    IsServer = false;
+    LogToConsole = true;
+}
+
+int32 UPUBakeTextureColorsCommandlet::Main(const FString& Params)
+{
+#if WITH_EDITORONLY_DATA
+    // Ingredient tables to scan
+    TArray<FSoftObjectPath> TablePaths;
+    FString TablesParam;
+    if (FParse::Value(*Params, TEXT("Tables="), TablesParam, false))
+    {
+        TArray<FString> TableStrings;
+        TablesParam.ParseIntoArray(TableStrings, TEXT("+"));
+        for (const FString& TableString : TableStrings)
+        {
+            TablePaths.Add(FSoftObjectPath(TableString));
+        }
+    }
+    else
+    {
+        TablePaths.Add(GetDefault<UPUIngredientCatalogSubsystem>()->CoreIngredientDataTablePath.ToSoftObjectPath());
+    }
+
+    // Every texture the ingredient slots can take colors from
+    TSet<UTexture2D*> Textures;
+    for (const FSoftObjectPath& TablePath : TablePaths)
+    {
+        const UDataTable* Table = Cast<UDataTable>(TablePath.TryLoad());
+        if (!Table || Table->GetRowStruct() != FPUIngredientBase::StaticStruct())
+        {
+            UE_LOG(LogTemp, Error, TEXT("UPUBakeTextureColorsCommandlet - '%s' is not an ingredient data table"), *TablePath.ToString());
+            return 1;
+        }
+
+        Table->ForeachRow<FPUIngredientBase>(TEXT("UPUBakeTextureColorsCommandlet"), [&Textures](const FName& RowName, const FPUIngredientBase& Ingredient)
+        {
+            for (UTexture2D* Texture : { Ingredient.PreviewTexture, Ingredient.PantryTexture, Ingredient.PreppedTexture })
+            {
+                if (Texture)
+                {
+                    Textures.Add(Texture);
+                }
+            }
+        });
+    }
+
+    // Load the existing bake (entries for textures outside these tables are kept) or create it
+    const TSoftObjectPtr<UPUTextureColorBake>& BakePath = GetDefault<UPUTextureColorCacheSubsystem>()->BakedColorsPath;
+    if (BakePath.IsNull())
+    {
+        UE_LOG(LogTemp, Error, TEXT("UPUBakeTextureColorsCommandlet - BakedColorsPath is not set"));
+        return 1;
+    }
+
+    const FString PackageName = BakePath.GetLongPackageName();
+    UPUTextureColorBake* Bake = BakePath.LoadSynchronous();
+    if (!Bake)
+    {
+        UPackage* Package = CreatePackage(*PackageName);
+        Bake = NewObject<UPUTextureColorBake>(Package, *BakePath.GetAssetName(), RF_Public | RF_Standalone);
+    }
+
+    int32 NumBaked = 0;
+    for (UTexture2D* Texture : Textures)
+    {
+        FImage SourceImage;
+        if (!UPUTextureColorCacheSubsystem::GetSourceImage(Texture, SourceImage))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("UPUBakeTextureColorsCommandlet - %s has no source image, skipped"), *Texture->GetPathName());
+            continue;
+        }
+
+        FPUTextureColors& Baked = Bake->Colors.Add(TSoftObjectPtr<UTexture2D>(Texture), UPUTextureColorCacheSubsystem::ComputeColors(SourceImage));
+        Baked.SourceId = Texture->Source.GetId();
+        ++NumBaked;
+    }
+
+    Bake->MarkPackageDirty();
+
+    FSavePackageArgs SaveArgs;
+    SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+    const FString Filename = FPackageName::LongPackageNameToFilename(PackageName, FPackageName::GetAssetPackageExtension());
+    if (!UPackage::SavePackage(Bake->GetPackage(), Bake, *Filename, SaveArgs))
+    {
+        UE_LOG(LogTemp, Error, TEXT("UPUBakeTextureColorsCommandlet - Failed to save %s"), *Filename);
+        return 1;
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("UPUBakeTextureColorsCommandlet - Baked %d texture(s) into %s (%d entries)"), NumBaked, *PackageName, Bake->Colors.Num());
+    return 0;
+#else
+    UE_LOG(LogTemp, Error, TEXT("UPUBakeTextureColorsCommandlet - Needs editor-only source data, run it from the editor"));
+    return 1;
+#endif
+}
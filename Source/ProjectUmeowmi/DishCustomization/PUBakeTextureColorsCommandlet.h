@@ -0,0 +1,24 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "PUBakeTextureColorsCommandlet.generated.h"
+
+/**
+ * Bakes the average / dominant colors of every ingredient texture into the UPUTextureColorBake asset
+ * (UPUTextureColorCacheSubsystem::BakedColorsPath), so cooked builds read them instead of decoding source art.
+ *
+ * Run before cooking:
+ *   UnrealEditor-Cmd ProjectUmeowmi.uproject -run=PUBakeTextureColors [-Tables=/Game/A.A+/Game/B.B]
+ * Without -Tables the catalog's core ingredient table is used.
+ */
+UCLASS()
+class PROJECTUMEOWMI_API UPUBakeTextureColorsCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UPUBakeTextureColorsCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
@@ -2,6 +2,8 @@
 #include "PUIngredientBase.h"
 #include "PUPreparationBase.h"
 #include "PUDishBlueprintLibrary.h"
+#include "PUIngredientCatalogSubsystem.h"
+#include "PUPreparationRegistrySubsystem.h"
 #include "Engine/DataTable.h"
 
 // Debug output toggles (kept in code, but disabled by default to avoid log spam).
@@ -11,8 +13,100 @@ namespace
     constexpr bool bPU_LogIngredientRowLookups = false;
 }
 
-// Initialize the static counter
-std::atomic<int32> FPUDishBase::GlobalInstanceCounter(0);
+const FPUIngredientBase& FIngredientInstance::GetDefinition() const
+{
+    if (Definition.IsValid())
+    {
+        return *Definition;
+    }
+
+    // Not resolved yet (loaded from a table or save): look the tag up without caching, so this stays const-safe.
+    // Registered definitions live as long as the registry, so the reference outlives the returned pointer.
+    if (TSharedPtr<const FPUIngredientBase> Found = UPUIngredientCatalogSubsystem::FindDefinition(IngredientTag))
+    {
+        return *Found;
+    }
+
+    static const FPUIngredientBase EmptyDefinition;
+    return EmptyDefinition;
+}
+
+void FIngredientInstance::ResolveDefinition(const TSoftObjectPtr<UDataTable>& IngredientDataTable)
+{
+    if (Definition.IsValid())
+    {
+        return;
+    }
+
+    if (TSharedPtr<const FPUIngredientBase> Found = UPUIngredientCatalogSubsystem::FindDefinition(IngredientTag, IngredientDataTable))
+    {
+        Definition = Found;
+    }
+}
+
+void FIngredientInstance::SetIngredientData(const FPUIngredientBase& Ingredient)
+{
+    IngredientTag = Ingredient.IngredientTag;
+    Preparations = Ingredient.ActivePreparations;
+    FlavorAspects = Ingredient.FlavorAspects;
+    TextureAspects = Ingredient.TextureAspects;
+    Definition = UPUIngredientCatalogSubsystem::InternDefinition(Ingredient);
+}
+
+FPUIngredientBase FIngredientInstance::GetIngredientData() const
+{
+    FPUIngredientBase Ingredient = GetDefinition();
+    Ingredient.IngredientTag = IngredientTag;
+    Ingredient.ActivePreparations = Preparations;
+    Ingredient.FlavorAspects = FlavorAspects;
+    Ingredient.TextureAspects = TextureAspects;
+    return Ingredient;
+}
+
+FText FIngredientInstance::GetCurrentDisplayName() const
+{
+    return GetDefinition().GetDisplayNameWithPreparations(Preparations);
+}
+
+FPUAspectVector FIngredientInstance::CalculateTimeTempModifiedAspectVector(float InTimeValue, float InTemperatureValue) const
+{
+    FPUAspectVector Aspects = GetAspectVector();
+    GetDefinition().GetTimeTempTable().Apply(FPUIngredientBase::MapTimeValueToState(InTimeValue), FPUIngredientBase::MapTemperatureValueToState(InTemperatureValue), Aspects);
+    return Aspects;
+}
+
+void FIngredientInstance::CalculateTimeTempModifiedAspects(float InTimeValue, float InTemperatureValue, FFlavorAspects& OutFlavor, FTextureAspects& OutTexture) const
+{
+    FPUIngredientBase::UnpackAspects(CalculateTimeTempModifiedAspectVector(InTimeValue, InTemperatureValue), OutFlavor, OutTexture);
+}
+
+SIZE_T FIngredientInstance::GetAllocatedSize() const
+{
+    return sizeof(FIngredientInstance) + Preparations.Num() * sizeof(FGameplayTag);
+}
+
+void FIngredientInstance::PostSerialize(const FArchive& Ar)
+{
+#if WITH_EDITORONLY_DATA
+    // Saved before instances shared their definition: keep the tag/preparations the old code read first
+    // (instance fields, then the inline copy) and the prepared aspects, and share the rest
+    if (Ar.IsLoading() && (IngredientData_DEPRECATED.IngredientTag.IsValid() || !IngredientData_DEPRECATED.IngredientName.IsNone()))
+    {
+        if (!IngredientTag.IsValid())
+        {
+            IngredientTag = IngredientData_DEPRECATED.IngredientTag;
+        }
+        if (Preparations.Num() == 0)
+        {
+            Preparations = IngredientData_DEPRECATED.ActivePreparations;
+        }
+        FlavorAspects = IngredientData_DEPRECATED.FlavorAspects;
+        TextureAspects = IngredientData_DEPRECATED.TextureAspects;
+        Definition = UPUIngredientCatalogSubsystem::InternDefinition(IngredientData_DEPRECATED);
+        IngredientData_DEPRECATED = FPUIngredientBase();
+    }
+#endif
+}
 
 FPUDishBase::FPUDishBase()
     : DishName(NAME_None)
@@ -31,56 +125,24 @@ bool FPUDishBase::GetIngredient(const FGameplayTag& IngredientTag, FPUIngredient
         return false;
     }
     
-    UDataTable* LoadedIngredientDataTable = IngredientDataTable.LoadSynchronous();
-    if (!LoadedIngredientDataTable)
-    {
-        //UE_LOG(LogTemp,Warning, TEXT("⚠️ FPUDishBase::GetIngredient - Failed to load IngredientDataTable!"));
-        return false;
-    }
-    
-    // Get the ingredient row name from the tag (removes "Ingredient." prefix, converts to lowercase, removes periods)
-    FName RowName = UPUDishBlueprintLibrary::GetIngredientRowNameFromTag(IngredientTag);
+    // Resolve the row through the ingredient catalog (precomputed tag -> row index, no string building)
     if (bPU_LogIngredientRowLookups)
     {
-        //UE_LOG(LogTemp,Display, TEXT("🔍 FPUDishBase::GetIngredient - Looking for tag: %s, RowName: %s"),
-            //*IngredientTag.ToString(), *RowName.ToString());
+        //UE_LOG(LogTemp,Display, TEXT("🔍 FPUDishBase::GetIngredient - Looking for tag: %s"), *IngredientTag.ToString());
     }
         
-    if (FPUIngredientBase* FoundIngredient = LoadedIngredientDataTable->FindRow<FPUIngredientBase>(RowName, TEXT("GetIngredient")))
+    if (const FPUIngredientBase* FoundIngredient = UPUIngredientCatalogSubsystem::ResolveIngredient(IngredientDataTable, IngredientTag))
     {
         OutIngredient = *FoundIngredient;
         
-        // Load preparation data if available
-        if (OutIngredient.PreparationDataTable.IsValid())
-        {
-            UDataTable* LoadedPreparationDataTable = OutIngredient.PreparationDataTable.LoadSynchronous();
-            if (LoadedPreparationDataTable)
-            {
-                // Apply any active preparations to the ingredient
-                for (const FGameplayTag& PrepTag : OutIngredient.ActivePreparations)
-                {
-                    // Get the preparation name from the tag (everything after the last period) and convert to lowercase
-                    FString PrepFullTag = PrepTag.ToString();
-                    int32 PrepLastPeriodIndex;
-                    if (PrepFullTag.FindLastChar('.', PrepLastPeriodIndex))
-                    {
-                        FString PrepName = PrepFullTag.RightChop(PrepLastPeriodIndex + 1).ToLower();
-                        FName PrepRowName = FName(*PrepName);
-                        
-                        if (FPUPreparationBase* Preparation = LoadedPreparationDataTable->FindRow<FPUPreparationBase>(PrepRowName, TEXT("GetIngredient")))
-                        {
-                            // Apply preparation modifiers
-                            Preparation->ApplyModifiers(OutIngredient.FlavorAspects, OutIngredient.TextureAspects);
-                        }
-                    }
-                }
-            }
-        }
+        // Apply any active preparations to the ingredient (compiled per-lane transforms, no row lookups)
+        UPUPreparationRegistrySubsystem::ApplyPreparations(OutIngredient.PreparationDataTable, OutIngredient.ActivePreparations,
+            OutIngredient.FlavorAspects, OutIngredient.TextureAspects);
         
         return true;
     }
     
-    //UE_LOG(LogTemp,Warning, TEXT("⚠️ FPUDishBase::GetIngredient - Could not find ingredient row '%s' in data table!"), *RowName.ToString());
+    //UE_LOG(LogTemp,Warning, TEXT("⚠️ FPUDishBase::GetIngredient - Could not find ingredient '%s' in data table!"), *IngredientTag.ToString());
     return false;
 }
 
@@ -91,8 +153,8 @@ bool FPUDishBase::GetIngredientForInstance(int32 InstanceIndex, FPUIngredientBas
         return false;
     }
 
-    // Simply return the ingredient data that's already stored in the instance
-    OutIngredient = IngredientInstances[InstanceIndex].IngredientData;
+    // The instance's definition with its own tag, preparations and aspects
+    OutIngredient = IngredientInstances[InstanceIndex].GetIngredientData();
     return true;
 }
 
@@ -101,7 +163,7 @@ TArray<FPUIngredientBase> FPUDishBase::GetAllIngredients() const
     TArray<FPUIngredientBase> Ingredients;
     for (const FIngredientInstance& Instance : IngredientInstances)
     {
-        Ingredients.Add(Instance.IngredientData);
+        Ingredients.Add(Instance.GetIngredientData());
     }
     return Ingredients;
 }
@@ -113,61 +175,228 @@ TArray<FIngredientInstance> FPUDishBase::GetAllIngredientInstances() const
 
 int32 FPUDishBase::GetTotalIngredientQuantity() const
 {
-    int32 TotalQuantity = 0;
-    for (const FIngredientInstance& Instance : IngredientInstances)
+    EnsureAggregates();
+    return AggregateQuantity;
+}
+
+float FPUDishBase::GetTotalFlavorAspect(const FName& AspectName) const
+{
+    return GetTotalAspectByIndex(PUAspects::ResolveFlavorIndex(AspectName));
+}
+
+float FPUDishBase::GetTotalTextureAspect(const FName& AspectName) const
+{
+    return GetTotalAspectByIndex(PUAspects::ResolveTextureIndex(AspectName));
+}
+
+float FPUDishBase::GetTotalAspectByIndex(int32 AspectIndex) const
+{
+    if (AspectIndex < 0 || AspectIndex >= PUAspects::NumLanes)
     {
-        TotalQuantity += Instance.Quantity;
+        return 0.0f;
     }
-    return TotalQuantity;
+
+    EnsureAggregates();
+    return AggregateAspects[AspectIndex];
 }
 
-float FPUDishBase::GetTotalFlavorAspect(const FName& AspectName) const
+FPUAspectVector FPUDishBase::GetTotalAspects() const
 {
-    float TotalValue = 0.0f;
-    
+    EnsureAggregates();
+    return AggregateAspects;
+}
+
+void FPUDishBase::EnsureAggregates() const
+{
+    if (bAggregatesValid)
+    {
+        return;
+    }
+
     // Sum up values from all ingredients
-    // Use the aspects directly from IngredientData which already includes:
+    // Use the instance aspects directly, which already include:
     // - Base aspects
     // - Preparation modifications
     // - Time/temperature modifications
-    // - Quantity multiplication
+    AggregateAspects.SetZero();
+    AggregateQuantity = 0;
     for (const FIngredientInstance& Instance : IngredientInstances)
     {
-        // Use the aspects directly from IngredientData (already calculated with all modifiers and quantity)
-        float AspectValue = Instance.IngredientData.GetFlavorAspect(AspectName);
-        TotalValue += AspectValue * Instance.Quantity;
+        AggregateAspects.AddScaled(Instance.GetAspectVector(), static_cast<float>(Instance.Quantity));
+        AggregateQuantity += Instance.Quantity;
     }
-    
-    return TotalValue;
+    bAggregatesValid = true;
 }
 
-float FPUDishBase::GetTotalTextureAspect(const FName& AspectName) const
+void FPUDishBase::AccumulateInstance(const FIngredientInstance& Instance, float Sign)
 {
-    float TotalValue = 0.0f;
-    
-    // Sum up values from all ingredients
-    // Use the aspects directly from IngredientData which already includes:
-    // - Base aspects
-    // - Preparation modifications
-    // - Time/temperature modifications
-    // - Quantity multiplication
+    // Nothing to maintain until the totals have been built once
+    if (!bAggregatesValid)
+    {
+        return;
+    }
+
+    AggregateAspects.AddScaled(Instance.GetAspectVector(), Sign * static_cast<float>(Instance.Quantity));
+    AggregateQuantity += static_cast<int32>(Sign) * Instance.Quantity;
+}
+
+bool FPUDishBase::VerifyAggregates() const
+{
+    if (!bAggregatesValid)
+    {
+        return true;
+    }
+
+    FPUAspectVector Expected;
+    int32 ExpectedQuantity = 0;
     for (const FIngredientInstance& Instance : IngredientInstances)
     {
-        // Use the aspects directly from IngredientData (already calculated with all modifiers and quantity)
-        float AspectValue = Instance.IngredientData.GetTextureAspect(AspectName);
-        TotalValue += AspectValue * Instance.Quantity;
+        Expected.AddScaled(Instance.GetAspectVector(), static_cast<float>(Instance.Quantity));
+        ExpectedQuantity += Instance.Quantity;
     }
-    
-    return TotalValue;
+
+    if (ExpectedQuantity != AggregateQuantity)
+    {
+        return false;
+    }
+
+    // Incremental add/remove can drift by a few ulps; anything larger means a missed update
+    for (int32 AspectIndex = 0; AspectIndex < PUAspects::NumLanes; ++AspectIndex)
+    {
+        if (!FMath::IsNearlyEqual(Expected[AspectIndex], AggregateAspects[AspectIndex], 1.0e-2f))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+int32 FPUDishBase::AddInstance(const FIngredientInstance& Instance)
+{
+    const int32 InstanceIndex = IngredientInstances.Add(Instance);
+    AccumulateInstance(Instance, 1.0f);
+    ReserveInstanceID(Instance.InstanceID);
+    if (bInstanceIndexValid)
+    {
+        InstanceIndexByID.FindOrAdd(Instance.InstanceID, InstanceIndex);
+    }
+    DebugVerifyAggregates();
+    return InstanceIndex;
+}
+
+void FPUDishBase::RemoveInstanceAt(int32 InstanceIndex)
+{
+    if (!IngredientInstances.IsValidIndex(InstanceIndex))
+    {
+        return;
+    }
+
+    AccumulateInstance(IngredientInstances[InstanceIndex], -1.0f);
+    if (bInstanceIndexValid)
+    {
+        const int32 RemovedID = IngredientInstances[InstanceIndex].InstanceID;
+        const int32* IndexedAt = InstanceIndexByID.Find(RemovedID);
+        if (IndexedAt && *IndexedAt == InstanceIndex)
+        {
+            InstanceIndexByID.Remove(RemovedID);
+        }
+    }
+    IngredientInstances.RemoveAt(InstanceIndex);
+
+    if (bInstanceIndexValid)
+    {
+        // Only the tail moved down by one. Entries pointing into it follow; an ID with no entry is a repeat of the
+        // removed one, and its first remaining occurrence becomes the match.
+        for (int32 i = InstanceIndex; i < IngredientInstances.Num(); ++i)
+        {
+            int32& IndexedAt = InstanceIndexByID.FindOrAdd(IngredientInstances[i].InstanceID, i);
+            if (IndexedAt == i + 1)
+            {
+                IndexedAt = i;
+            }
+        }
+    }
+
+    // Snap back to exact zero so add/remove drift never accumulates across dishes
+    if (IngredientInstances.Num() == 0)
+    {
+        AggregateAspects.SetZero();
+        AggregateQuantity = 0;
+    }
+    DebugVerifyAggregates();
+}
+
+void FPUDishBase::ReplaceInstanceAt(int32 InstanceIndex, const FIngredientInstance& Instance)
+{
+    if (!IngredientInstances.IsValidIndex(InstanceIndex))
+    {
+        return;
+    }
+
+    AccumulateInstance(IngredientInstances[InstanceIndex], -1.0f);
+    if (IngredientInstances[InstanceIndex].InstanceID != Instance.InstanceID)
+    {
+        bInstanceIndexValid = false;
+        ReserveInstanceID(Instance.InstanceID);
+    }
+    IngredientInstances[InstanceIndex] = Instance;
+    AccumulateInstance(Instance, 1.0f);
+    DebugVerifyAggregates();
+}
+
+void FPUDishBase::ModifyInstanceAt(int32 InstanceIndex, TFunctionRef<void(FIngredientInstance&)> Edit)
+{
+    if (!IngredientInstances.IsValidIndex(InstanceIndex))
+    {
+        return;
+    }
+
+    FIngredientInstance& Instance = IngredientInstances[InstanceIndex];
+    const int32 PreviousID = Instance.InstanceID;
+    AccumulateInstance(Instance, -1.0f);
+    Edit(Instance);
+    AccumulateInstance(Instance, 1.0f);
+    if (Instance.InstanceID != PreviousID)
+    {
+        bInstanceIndexValid = false;
+        ReserveInstanceID(Instance.InstanceID);
+    }
+    DebugVerifyAggregates();
+}
+
+void FPUDishBase::SetInstanceQuantity(int32 InstanceIndex, int32 NewQuantity)
+{
+    if (!IngredientInstances.IsValidIndex(InstanceIndex))
+    {
+        return;
+    }
+
+    FIngredientInstance& Instance = IngredientInstances[InstanceIndex];
+    if (bAggregatesValid)
+    {
+        const int32 QuantityDelta = NewQuantity - Instance.Quantity;
+        AggregateAspects.AddScaled(Instance.GetAspectVector(), static_cast<float>(QuantityDelta));
+        AggregateQuantity += QuantityDelta;
+    }
+    Instance.Quantity = NewQuantity;
+    DebugVerifyAggregates();
+}
+
+void FPUDishBase::ClearInstances()
+{
+    IngredientInstances.Empty();
+    AggregateAspects.SetZero();
+    AggregateQuantity = 0;
+    bAggregatesValid = true;
+    InstanceIndexByID.Reset();
+    bInstanceIndexValid = true;
 }
 
 bool FPUDishBase::HasIngredient(const FGameplayTag& IngredientTag) const
 {
     for (const FIngredientInstance& Instance : IngredientInstances)
     {
-        // Check both the convenient field and the data field for compatibility
-        FGameplayTag InstanceTag = Instance.IngredientTag.IsValid() ? Instance.IngredientTag : Instance.IngredientData.IngredientTag;
-        if (InstanceTag == IngredientTag)
+        if (Instance.IngredientTag == IngredientTag)
         {
             return true;
         }
@@ -189,11 +418,8 @@ FText FPUDishBase::GetCurrentDisplayName() const
     
     for (const FIngredientInstance& Instance : IngredientInstances)
     {
-        // Use convenient field if available, fallback to data field
-        FGameplayTagContainer Preparations = Instance.Preparations.Num() > 0 ? Instance.Preparations : Instance.IngredientData.ActivePreparations;
-        
         TotalIngredients += Instance.Quantity;
-        if (Preparations.Num() > 1)
+        if (Instance.Preparations.Num() > 1)
         {
             SuspiciousIngredients += Instance.Quantity;
         }
@@ -210,9 +436,7 @@ FText FPUDishBase::GetCurrentDisplayName() const
     TMap<FGameplayTag, int32> IngredientQuantities;
     for (const FIngredientInstance& Instance : IngredientInstances)
     {
-        // Use convenient field if available, fallback to data field
-        FGameplayTag InstanceTag = Instance.IngredientTag.IsValid() ? Instance.IngredientTag : Instance.IngredientData.IngredientTag;
-        IngredientQuantities.FindOrAdd(InstanceTag) += Instance.Quantity;
+        IngredientQuantities.FindOrAdd(Instance.IngredientTag) += Instance.Quantity;
     }
 
     // Find the ingredient with the highest quantity
@@ -236,12 +460,10 @@ FText FPUDishBase::GetCurrentDisplayName() const
             // Find the first instance of the most common ingredient to get its preparations
             for (const FIngredientInstance& Instance : IngredientInstances)
             {
-                // Use convenient field if available, fallback to data field
-                FGameplayTag InstanceTag = Instance.IngredientTag.IsValid() ? Instance.IngredientTag : Instance.IngredientData.IngredientTag;
-                if (InstanceTag == MostCommonTag)
+                if (Instance.IngredientTag == MostCommonTag)
                 {
-                    // Apply the preparations from this instance (prefer convenient field, fallback to data field)
-                    MostCommonIngredient.ActivePreparations = Instance.Preparations.Num() > 0 ? Instance.Preparations : Instance.IngredientData.ActivePreparations;
+                    // Apply the preparations from this instance
+                    MostCommonIngredient.ActivePreparations = Instance.Preparations;
                     break;
                 }
             }
@@ -261,31 +483,85 @@ FText FPUDishBase::GetCurrentDisplayName() const
     return DisplayName;
 }
 
-int32 FPUDishBase::FindInstanceIndexByID(int32 InstanceID) const
+void FPUDishBase::EnsureInstanceIndex() const
 {
+    if (bInstanceIndexValid)
+    {
+        return;
+    }
+
+    InstanceIndexByID.Reset();
+    InstanceIndexByID.Reserve(IngredientInstances.Num());
     for (int32 i = 0; i < IngredientInstances.Num(); ++i)
     {
-        if (IngredientInstances[i].InstanceID == InstanceID)
+        // FindOrAdd keeps the first index if an ID is repeated, matching the old linear scan
+        InstanceIndexByID.FindOrAdd(IngredientInstances[i].InstanceID, i);
+    }
+    bInstanceIndexValid = true;
+}
+
+int32 FPUDishBase::FindInstanceIndexByID(int32 InstanceID) const
+{
+    EnsureInstanceIndex();
+
+    if (const int32* Found = InstanceIndexByID.Find(InstanceID))
+    {
+        if (IngredientInstances.IsValidIndex(*Found) && IngredientInstances[*Found].InstanceID == InstanceID)
         {
-            return i;
+            return *Found;
         }
+
+        // Stale - the array was edited directly without MarkAggregatesDirty()
+        bInstanceIndexValid = false;
+        EnsureInstanceIndex();
+        const int32* Rebuilt = InstanceIndexByID.Find(InstanceID);
+        return Rebuilt ? *Rebuilt : INDEX_NONE;
     }
     return INDEX_NONE;
 }
 
+const FIngredientInstance* FPUDishBase::FindInstanceByID(int32 InstanceID) const
+{
+    const int32 InstanceIndex = FindInstanceIndexByID(InstanceID);
+    return InstanceIndex != INDEX_NONE ? &IngredientInstances[InstanceIndex] : nullptr;
+}
+
+int32 FPUDishBase::AllocateInstanceID()
+{
+    NextInstanceID = GenerateNewInstanceID();
+    // Caught up with the array; a valid index lets the next allocation skip the scan
+    EnsureInstanceIndex();
+    const int32 InstanceID = NextInstanceID;
+    ReserveInstanceID(InstanceID);
+    return InstanceID;
+}
+
 int32 FPUDishBase::GenerateNewInstanceID() const
 {
-    int32 MaxID = 0;
+    if (bInstanceIndexValid)
+    {
+        // Every mutator since the last index rebuild has kept the counter past the IDs it added
+        return NextInstanceID;
+    }
+
+    // The array was loaded (saves from before the counter existed) or edited directly - stay above what's in it
+    int32 NextFreeID = NextInstanceID;
     for (const FIngredientInstance& Instance : IngredientInstances)
     {
-        MaxID = FMath::Max(MaxID, Instance.InstanceID);
+        if (Instance.InstanceID >= NextFreeID && Instance.InstanceID < MAX_int32)
+        {
+            NextFreeID = Instance.InstanceID + 1;
+        }
     }
-    return MaxID + 1;
+    return NextFreeID;
 }
 
-int32 FPUDishBase::GenerateUniqueInstanceID()
+void FPUDishBase::ReserveInstanceID(int32 InstanceID)
 {
-    return ++GlobalInstanceCounter;
+    if (InstanceID >= NextInstanceID && InstanceID < MAX_int32)
+    {
+        NextInstanceID = InstanceID + 1;
+    }
 }
 
 bool FPUDishBase::GetIngredientForInstanceID(int32 InstanceID, FPUIngredientBase& OutIngredient) const
@@ -293,7 +569,7 @@ bool FPUDishBase::GetIngredientForInstanceID(int32 InstanceID, FPUIngredientBase
     int32 InstanceIndex = FindInstanceIndexByID(InstanceID);
     if (InstanceIndex != INDEX_NONE)
     {
-        OutIngredient = IngredientInstances[InstanceIndex].IngredientData;
+        OutIngredient = IngredientInstances[InstanceIndex].GetIngredientData();
         return true;
     }
     return false;
@@ -310,14 +586,40 @@ bool FPUDishBase::GetIngredientInstanceByID(int32 InstanceID, FIngredientInstanc
     return false;
 }
 
+const FPUIngredientBase* FPUDishBase::GetIngredientDefinition(int32 InstanceID) const
+{
+    const int32 InstanceIndex = FindInstanceIndexByID(InstanceID);
+    if (InstanceIndex == INDEX_NONE)
+    {
+        return nullptr;
+    }
+    return &IngredientInstances[InstanceIndex].GetDefinition();
+}
+
+void FPUDishBase::ResolveIngredientDefinitions()
+{
+    for (FIngredientInstance& Instance : IngredientInstances)
+    {
+        Instance.ResolveDefinition(IngredientDataTable);
+    }
+}
+
+SIZE_T FPUDishBase::GetAllocatedSize() const
+{
+    SIZE_T Bytes = sizeof(FPUDishBase) + (IngredientInstances.GetSlack() * sizeof(FIngredientInstance)) + DishTags.Num() * sizeof(FGameplayTag);
+    for (const FIngredientInstance& Instance : IngredientInstances)
+    {
+        Bytes += Instance.GetAllocatedSize();
+    }
+    return Bytes;
+}
+
 FGameplayTag FPUDishBase::GetIngredientTag(int32 InstanceID) const
 {
     int32 InstanceIndex = FindInstanceIndexByID(InstanceID);
     if (InstanceIndex != INDEX_NONE)
     {
-        const FIngredientInstance& Instance = IngredientInstances[InstanceIndex];
-        // Use convenient field if available, fallback to data field
-        return Instance.IngredientTag.IsValid() ? Instance.IngredientTag : Instance.IngredientData.IngredientTag;
+        return IngredientInstances[InstanceIndex].IngredientTag;
     }
     return FGameplayTag();
 }
@@ -327,9 +629,7 @@ FGameplayTagContainer FPUDishBase::GetPreparations(int32 InstanceID) const
     int32 InstanceIndex = FindInstanceIndexByID(InstanceID);
     if (InstanceIndex != INDEX_NONE)
     {
-        const FIngredientInstance& Instance = IngredientInstances[InstanceIndex];
-        // Use convenient field if available, fallback to data field
-        return Instance.Preparations.Num() > 0 ? Instance.Preparations : Instance.IngredientData.ActivePreparations;
+        return IngredientInstances[InstanceIndex].Preparations;
     }
     return FGameplayTagContainer();
 }
@@ -6,7 +6,15 @@
 #include "PUIngredientBase.h"
 #include "PUDishBase.generated.h"
 
+// Verify the running dish totals against a full recompute after every mutation (debug builds only; queries are never verified)
+#ifndef PU_VERIFY_DISH_AGGREGATES
+#define PU_VERIFY_DISH_AGGREGATES UE_BUILD_DEBUG
+#endif
+
 // Internal struct to track ingredient instances
+// An instance holds only its ingredient tag (the handle to the shared definition) and what differs per instance:
+// quantity, preparations, prepared aspects, placement and cooking values. Names, textures, meshes and time/temp
+// modifiers live once per ingredient in the shared definition (see GetDefinition).
 USTRUCT(BlueprintType)
 struct FIngredientInstance
 {
@@ -25,18 +33,22 @@ struct FIngredientInstance
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ingredient")
     int32 Quantity;
 
-    // The ingredient data with preparations already applied
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ingredient")
-    FPUIngredientBase IngredientData;
-
-    // Ingredient tag for easy template creation (redundant with IngredientData.IngredientTag but convenient)
+    // Ingredient tag - the handle to the shared definition
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ingredient", meta = (Categories = "Ingredient"))
     FGameplayTag IngredientTag;
 
-    // Preparations for easy template creation (redundant with IngredientData.ActivePreparations but convenient)
+    // Preparations applied to this instance
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ingredient", meta = (Categories = "Preparation"))
     FGameplayTagContainer Preparations;
 
+    // Flavor aspects of this instance with its preparations already applied
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ingredient|Aspects")
+    FFlavorAspects FlavorAspects;
+
+    // Texture aspects of this instance with its preparations already applied
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ingredient|Aspects")
+    FTextureAspects TextureAspects;
+
     // Optional: Placement data for this instance
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ingredient")
     FVector PlacementPosition;
@@ -65,6 +77,57 @@ struct FIngredientInstance
     // Temperature: 0.0 = Raw, 0.33 = Low, 0.66 = Med, 1.0 = Hot
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ingredient|Cooking", meta = (ClampMin = "0.0", ClampMax = "1.0", UIMin = "0.0", UIMax = "1.0"))
     float TemperatureValue = 0.0f;
+
+#if WITH_EDITORONLY_DATA
+    // Full ingredient copy stored by dishes saved before instances shared their definition. Old data reaches it through
+    // the IngredientData redirect in DefaultEngine.ini; PostSerialize folds it into the fields above and empties it.
+    // Deprecated, so it is never saved again (and does not exist in cooked builds).
+    UPROPERTY()
+    FPUIngredientBase IngredientData_DEPRECATED;
+#endif
+
+    // Shared, immutable definition of this ingredient (never null - an empty definition if the tag is unknown).
+    // Its aspects and ActivePreparations are not this instance's: use FlavorAspects/TextureAspects/Preparations.
+    const FPUIngredientBase& GetDefinition() const;
+
+    // If this instance has no definition yet, point it at the one for IngredientTag in the given table
+    // (game thread - may load the table)
+    void ResolveDefinition(const TSoftObjectPtr<UDataTable>& IngredientDataTable);
+
+    // Take tag, preparations and aspects from an ingredient and share the rest of it as this instance's definition
+    void SetIngredientData(const FPUIngredientBase& Ingredient);
+
+    // The definition with this instance's tag, preparations and aspects (a copy, for APIs that take a whole ingredient)
+    FPUIngredientBase GetIngredientData() const;
+
+    // Display name with this instance's preparations applied
+    FText GetCurrentDisplayName() const;
+
+    // Pack/unpack this instance's aspects (12 lanes)
+    FPUAspectVector GetAspectVector() const { return FPUIngredientBase::PackAspects(FlavorAspects, TextureAspects); }
+    void SetAspectVector(const FPUAspectVector& Aspects) { FPUIngredientBase::UnpackAspects(Aspects, FlavorAspects, TextureAspects); }
+
+    // This instance's aspects after the definition's time/temp modifiers for TimeValue/TemperatureValue
+    FPUAspectVector CalculateTimeTempModifiedAspectVector(float InTimeValue, float InTemperatureValue) const;
+    void CalculateTimeTempModifiedAspects(float InTimeValue, float InTemperatureValue, FFlavorAspects& OutFlavor, FTextureAspects& OutTexture) const;
+
+    // Inline + heap bytes of this instance (for memory reports; the shared definition is not counted)
+    SIZE_T GetAllocatedSize() const;
+
+    void PostSerialize(const FArchive& Ar);
+
+private:
+    // Shared definition for IngredientTag (not serialized - resolved from the tag when missing)
+    TSharedPtr<const FPUIngredientBase> Definition;
+};
+
+template<>
+struct TStructOpsTypeTraits<FIngredientInstance> : public TStructOpsTypeTraitsBase2<FIngredientInstance>
+{
+    enum
+    {
+        WithPostSerialize = true,
+    };
 };
 
 USTRUCT(BlueprintType)
@@ -94,6 +157,9 @@ public:
     TSoftObjectPtr<UDataTable> IngredientDataTable;
 
     // Array of ingredient instances in the dish
+    // C++ should use the instance mutators below. Code that edits this array or an instance's aspects/quantity
+    // directly must call MarkAggregatesDirty() (Blueprint: Mark Dish Aggregates Dirty); dishes handed back from
+    // Blueprint through the customization component and widgets are marked dirty on the way in.
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dish|Ingredients")
     TArray<FIngredientInstance> IngredientInstances;
 
@@ -111,6 +177,12 @@ public:
     // Get the total value for a specific texture aspect across all ingredients
     float GetTotalTextureAspect(const FName& AspectName) const;
 
+    // Get the total value for an FPUAspectVector lane across all ingredients (no name lookup)
+    float GetTotalAspectByIndex(int32 AspectIndex) const;
+
+    // Get all 12 aspect totals (quantity-weighted). O(1) - returns the running totals.
+    FPUAspectVector GetTotalAspects() const;
+
     // Check if the dish has a specific ingredient
     bool HasIngredient(const FGameplayTag& IngredientTag) const;
 
@@ -129,7 +201,7 @@ public:
     // Helper function to get all ingredient instances (including IDs)
     TArray<FIngredientInstance> GetAllIngredientInstances() const;
 
-    // Helper function to get the total quantity of all ingredients
+    // Helper function to get the total quantity of all ingredients (O(1) - returns the running total)
     int32 GetTotalIngredientQuantity() const;
 
     // Helper function to get ingredient data for a specific instance ID
@@ -138,15 +210,32 @@ public:
     // Helper function to get ingredient instance by ID
     bool GetIngredientInstanceByID(int32 InstanceID, FIngredientInstance& OutInstance) const;
 
-    // Helper function to find instance index by ID
+    // Shared ingredient definition for an instance ID, nullptr if the dish has no such instance
+    const FPUIngredientBase* GetIngredientDefinition(int32 InstanceID) const;
+
+    // Point every instance that has no definition yet at its row in IngredientDataTable (game thread).
+    // Call when a dish arrives from a table or save; instances resolve lazily by tag otherwise.
+    void ResolveIngredientDefinitions();
+
+    // Inline + heap bytes of the dish and its instances (for memory reports)
+    SIZE_T GetAllocatedSize() const;
+
+    // Helper function to find instance index by ID (O(1) - hashed, first match if IDs repeat)
     int32 FindInstanceIndexByID(int32 InstanceID) const;
 
+    // Instance with the given ID, nullptr if the dish does not have it
+    const FIngredientInstance* FindInstanceByID(int32 InstanceID) const;
+
     // Helper functions for easy access to common properties
     FGameplayTag GetIngredientTag(int32 InstanceID) const;
     FGameplayTagContainer GetPreparations(int32 InstanceID) const;
     int32 GetQuantity(int32 InstanceID) const;
 
-    // Helper function to generate a new unique instance ID
+    // Reserve the next instance ID for this dish. IDs are dense, never reused within the dish, and carried
+    // through copies and save/load, so they never collide with each other (unlike hashed GUIDs).
+    int32 AllocateInstanceID();
+
+    // The ID AllocateInstanceID() would hand out next, without reserving it
     int32 GenerateNewInstanceID() const;
 
     // Plating-related functions (internal use only)
@@ -155,13 +244,59 @@ public:
     void ClearIngredientPlating(int32 InstanceID);
     bool GetIngredientPlating(int32 InstanceID, FVector& OutPosition, FRotator& OutRotation, FVector& OutScale) const;
 
+    // Instance mutators - keep the running aspect/quantity totals in sync incrementally
+    int32 AddInstance(const FIngredientInstance& Instance);
+    void RemoveInstanceAt(int32 InstanceIndex);
+    void ReplaceInstanceAt(int32 InstanceIndex, const FIngredientInstance& Instance);
+    void SetInstanceQuantity(int32 InstanceIndex, int32 NewQuantity);
+    void ClearInstances();
+
+    // Edit one instance in place (its old contribution is removed from the totals and the new one added)
+    void ModifyInstanceAt(int32 InstanceIndex, TFunctionRef<void(FIngredientInstance&)> Edit);
+
+    // Call after editing IngredientInstances directly; totals and the ID index are rebuilt on the next query
+    void MarkAggregatesDirty() const
+    {
+        bAggregatesValid = false;
+        bInstanceIndexValid = false;
+    }
+
+    // Compare the running totals against a full recompute (true if they match or have not been built yet)
+    bool VerifyAggregates() const;
+
 private:
-    // Static counter for generating unique instance IDs
-    static std::atomic<int32> GlobalInstanceCounter;
+    // Rebuild the running totals if they were invalidated
+    void EnsureAggregates() const;
 
-public:
-    // Generate a globally unique instance ID
-    static int32 GenerateUniqueInstanceID();
+    // Add (Sign = 1) or remove (Sign = -1) one instance's contribution to the running totals
+    void AccumulateInstance(const FIngredientInstance& Instance, float Sign);
+
+    void DebugVerifyAggregates() const
+    {
+#if PU_VERIFY_DISH_AGGREGATES
+        ensureMsgf(VerifyAggregates(), TEXT("FPUDishBase running totals are out of sync - IngredientInstances was edited without MarkAggregatesDirty()"));
+#endif
+    }
+
+    // Quantity-weighted aspect totals and total quantity (not serialized; rebuilt after load)
+    mutable FPUAspectVector AggregateAspects;
+    mutable int32 AggregateQuantity = 0;
+    mutable bool bAggregatesValid = false;
+
+    // Rebuild InstanceID -> array index if it was invalidated
+    void EnsureInstanceIndex() const;
+
+    // InstanceID -> index into IngredientInstances (not serialized; rebuilt on first lookup)
+    mutable TMap<int32, int32> InstanceIndexByID;
+    mutable bool bInstanceIndexValid = false;
+
+    // Move NextInstanceID past an ID that just entered the dish (allocated here or carried in by AddInstance)
+    void ReserveInstanceID(int32 InstanceID);
+
+    // Next ID AllocateInstanceID() hands out - the source of truth for instance IDs. Serialized so a loaded or
+    // copied dish keeps counting where it left off; the instance mutators keep it past every ID they add.
+    UPROPERTY()
+    int32 NextInstanceID = 1;
 };
 
 // Planning stage data - ingredients selected for cooking without quantities
@@ -2,7 +2,8 @@
 #include "PUDishBase.h"
 #include "PUIngredientBase.h"
 #include "PUPreparationBase.h"
-#include "../UI/PUDishCustomizationWidget.h"
+#include "PUIngredientCatalogSubsystem.h"
+#include "PUPreparationRegistrySubsystem.h"
 
 // Debug output toggles (kept in code, but disabled by default to avoid startup/on-screen spam).
 namespace
@@ -47,58 +48,24 @@ FIngredientInstance UPUDishBlueprintLibrary::AddIngredient(FPUDishBase& Dish, co
         return FIngredientInstance();
     }
     
-    UDataTable* LoadedIngredientDataTable = Dish.IngredientDataTable.LoadSynchronous();
-    if (!LoadedIngredientDataTable)
-    {
-        //UE_LOG(LogTemp,Warning, TEXT("UPUDishBlueprintLibrary::AddIngredient - Failed to load ingredient data table"));
-        return FIngredientInstance();
-    }
-    
-    // Get the ingredient row name from the tag (removes "Ingredient." prefix, converts to lowercase, removes periods)
-    FName RowName = GetIngredientRowNameFromTag(IngredientTag);
-        
-    if (FPUIngredientBase* FoundIngredient = LoadedIngredientDataTable->FindRow<FPUIngredientBase>(RowName, TEXT("AddIngredient")))
+    // Resolve the row through the ingredient catalog (precomputed tag -> row index, no string building)
+    if (const FPUIngredientBase* FoundIngredient = UPUIngredientCatalogSubsystem::ResolveIngredient(Dish.IngredientDataTable, IngredientTag))
     {
         // Create a new ingredient instance
         FIngredientInstance NewInstance;
-        // Use GUID-based instance ID generation (same as ingredient buttons)
-        NewInstance.InstanceID = UPUDishCustomizationWidget::GenerateGUIDBasedInstanceID();
+        // Next ID from the dish's own allocator
+        NewInstance.InstanceID = Dish.AllocateInstanceID();
         NewInstance.Quantity = 1;
-        NewInstance.IngredientData = *FoundIngredient;
+        NewInstance.SetIngredientData(*FoundIngredient);
         NewInstance.IngredientTag = IngredientTag;
         NewInstance.Preparations = Preparations;
         
-        // Apply preparations to the ingredient data
-        if (NewInstance.IngredientData.PreparationDataTable.IsValid())
-        {
-            UDataTable* LoadedPreparationDataTable = NewInstance.IngredientData.PreparationDataTable.LoadSynchronous();
-            if (LoadedPreparationDataTable)
-            {
-                TArray<FGameplayTag> PreparationTags;
-                Preparations.GetGameplayTagArray(PreparationTags);
-                
-                for (const FGameplayTag& PrepTag : PreparationTags)
-                {
-                    // Get the preparation name from the tag (everything after the last period) and convert to lowercase
-                    FString PrepFullTag = PrepTag.ToString();
-                    int32 PrepLastPeriodIndex;
-                    if (PrepFullTag.FindLastChar('.', PrepLastPeriodIndex))
-                    {
-                        FString PrepName = PrepFullTag.RightChop(PrepLastPeriodIndex + 1).ToLower();
-                        FName PrepRowName = FName(*PrepName);
-                        
-                        if (FPUPreparationBase* Preparation = LoadedPreparationDataTable->FindRow<FPUPreparationBase>(PrepRowName, TEXT("AddIngredient")))
-                        {
-                            // Apply preparation modifiers
-                            Preparation->ApplyModifiers(NewInstance.IngredientData.FlavorAspects, NewInstance.IngredientData.TextureAspects);
-                        }
-                    }
-                }
-            }
-        }
+        // Apply preparations to the instance aspects (compiled per-lane transforms, no row lookups)
+        UPUPreparationRegistrySubsystem::ApplyPreparations(FoundIngredient->PreparationDataTable, Preparations,
+            NewInstance.FlavorAspects, NewInstance.TextureAspects);
         
-        // Add the instance to the dish
-        Dish.IngredientInstances.Add(NewInstance);
+        // Add the instance to the dish (updates the running totals)
+        Dish.AddInstance(NewInstance);
         
         if (bPU_LogDishTagSpam)
         {
@@ -115,9 +82,16 @@ FIngredientInstance UPUDishBlueprintLibrary::AddIngredient(FPUDishBase& Dish, co
 
 bool UPUDishBlueprintLibrary::RemoveIngredient(FPUDishBase& Dish, const FGameplayTag& IngredientTag)
 {
-    return Dish.IngredientInstances.RemoveAll([&](const FIngredientInstance& Instance) {
-        return Instance.IngredientData.IngredientTag == IngredientTag;
-    }) > 0;
+    bool bRemoved = false;
+    for (int32 i = Dish.IngredientInstances.Num() - 1; i >= 0; --i)
+    {
+        if (Dish.IngredientInstances[i].IngredientTag == IngredientTag)
+        {
+            Dish.RemoveInstanceAt(i);
+            bRemoved = true;
+        }
+    }
+    return bRemoved;
 }
 
 bool UPUDishBlueprintLibrary::RemoveIngredientInstance(FPUDishBase& Dish, int32 InstanceIndex)
@@ -130,7 +104,7 @@ bool UPUDishBlueprintLibrary::RemoveIngredientInstance(FPUDishBase& Dish, int32
     }
 
     // Remove the instance
-    Dish.IngredientInstances.RemoveAt(InstanceIndex);
+    Dish.RemoveInstanceAt(InstanceIndex);
     //UE_LOG(LogTemp,Log, TEXT("UPUDishBlueprintLibrary::RemoveIngredientInstance - Removed instance at index %d"), InstanceIndex);
     
     return true;
@@ -156,14 +130,14 @@ bool UPUDishBlueprintLibrary::RemoveIngredientQuantity(FPUDishBase& Dish, int32
     }
 
     // Remove the quantity
-    Instance.Quantity -= Quantity;
+    Dish.SetInstanceQuantity(InstanceIndex, Instance.Quantity - Quantity);
     //UE_LOG(LogTemp,Log, TEXT("UPUDishBlueprintLibrary::RemoveIngredientQuantity - Removed %d from instance %d. Remaining: %d"), 
     //    Quantity, InstanceIndex, Instance.Quantity);
 
     // Auto-cleanup: Remove instance if quantity reaches 0
     if (Instance.Quantity <= 0)
     {
-        Dish.IngredientInstances.RemoveAt(InstanceIndex);
+        Dish.RemoveInstanceAt(InstanceIndex);
         //UE_LOG(LogTemp,Log, TEXT("UPUDishBlueprintLibrary::RemoveIngredientQuantity - Auto-removed empty instance at index %d"), InstanceIndex);
     }
     
@@ -181,7 +155,7 @@ bool UPUDishBlueprintLibrary::IncrementIngredientAmount(FPUDishBase& Dish, const
     for (int32 i = 0; i < Dish.IngredientInstances.Num(); ++i)
     {
         FIngredientInstance& Instance = Dish.IngredientInstances[i];
-        if (Instance.IngredientData.IngredientTag == IngredientTag)
+        if (Instance.IngredientTag == IngredientTag)
         {
             // Get the base ingredient to check max quantity
             FPUIngredientBase BaseIngredient;
@@ -190,7 +164,7 @@ bool UPUDishBlueprintLibrary::IncrementIngredientAmount(FPUDishBase& Dish, const
                 // Check if we're within the max quantity
                 if (Instance.Quantity + Amount <= BaseIngredient.MaxQuantity)
                 {
-                    Instance.Quantity += Amount;
+                    Dish.SetInstanceQuantity(i, Instance.Quantity + Amount);
                     //UE_LOG(LogTemp,Log, TEXT("UPUDishBlueprintLibrary::IncrementIngredientAmount - Added %d to instance %d. New quantity: %d"), 
                     //    Amount, i, Instance.Quantity);
                     return true;
@@ -213,7 +187,7 @@ bool UPUDishBlueprintLibrary::DecrementIngredientAmount(FPUDishBase& Dish, const
     for (int32 i = 0; i < Dish.IngredientInstances.Num(); ++i)
     {
         FIngredientInstance& Instance = Dish.IngredientInstances[i];
-        if (Instance.IngredientData.IngredientTag == IngredientTag)
+        if (Instance.IngredientTag == IngredientTag)
         {
             // Get the base ingredient to check min quantity
             FPUIngredientBase BaseIngredient;
@@ -222,14 +196,14 @@ bool UPUDishBlueprintLibrary::DecrementIngredientAmount(FPUDishBase& Dish, const
                 // Check if we're within the min quantity
                 if (Instance.Quantity - Amount >= BaseIngredient.MinQuantity)
                 {
-                    Instance.Quantity -= Amount;
+                    Dish.SetInstanceQuantity(i, Instance.Quantity - Amount);
                     //UE_LOG(LogTemp,Log, TEXT("UPUDishBlueprintLibrary::DecrementIngredientAmount - Removed %d from instance %d. New quantity: %d"), 
                     //    Amount, i, Instance.Quantity);
 
                     // Auto-cleanup: Remove instance if quantity reaches 0
                     if (Instance.Quantity <= 0)
                     {
-                        Dish.IngredientInstances.RemoveAt(i);
+                        Dish.RemoveInstanceAt(i);
                         //UE_LOG(LogTemp,Log, TEXT("UPUDishBlueprintLibrary::DecrementIngredientAmount - Auto-removed empty instance at index %d"), i);
                     }
                     
@@ -247,7 +221,7 @@ int32 UPUDishBlueprintLibrary::GetIngredientQuantity(const FPUDishBase& Dish, co
     int32 TotalQuantity = 0;
     for (const FIngredientInstance& Instance : Dish.IngredientInstances)
     {
-        if (Instance.IngredientData.IngredientTag == IngredientTag)
+        if (Instance.IngredientTag == IngredientTag)
         {
             TotalQuantity += Instance.Quantity;
         }
@@ -260,7 +234,7 @@ int32 UPUDishBlueprintLibrary::GetIngredientInstanceCount(const FPUDishBase& Dis
     int32 Count = 0;
     for (const FIngredientInstance& Instance : Dish.IngredientInstances)
     {
-        if (Instance.IngredientData.IngredientTag == IngredientTag)
+        if (Instance.IngredientTag == IngredientTag)
         {
             Count++;
         }
@@ -273,7 +247,7 @@ TArray<int32> UPUDishBlueprintLibrary::GetInstanceIndicesForIngredient(const FPU
     TArray<int32> Indices;
     for (int32 i = 0; i < Dish.IngredientInstances.Num(); ++i)
     {
-        if (Dish.IngredientInstances[i].IngredientData.IngredientTag == IngredientTag)
+        if (Dish.IngredientInstances[i].IngredientTag == IngredientTag)
         {
             Indices.Add(i);
         }
@@ -286,7 +260,7 @@ TArray<int32> UPUDishBlueprintLibrary::GetInstanceIDsForIngredient(const FPUDish
     TArray<int32> IDs;
     for (const FIngredientInstance& Instance : Dish.IngredientInstances)
     {
-        if (Instance.IngredientData.IngredientTag == IngredientTag)
+        if (Instance.IngredientTag == IngredientTag)
         {
             IDs.Add(Instance.InstanceID);
         }
@@ -305,16 +279,15 @@ bool UPUDishBlueprintLibrary::ApplyPreparation(FPUDishBase& Dish, int32 Instance
 
     FIngredientInstance& Instance = Dish.IngredientInstances[InstanceIndex];
     
-    // Check if this preparation is already applied (check both Preparations and ActivePreparations)
-    if (Instance.IngredientData.ActivePreparations.HasTag(PreparationTag) || Instance.Preparations.HasTag(PreparationTag))
+    // Check if this preparation is already applied
+    if (Instance.Preparations.HasTag(PreparationTag))
     {
         //UE_LOG(LogTemp,Warning, TEXT("UPUDishBlueprintLibrary::ApplyPreparation - Preparation %s already applied to instance %d"), 
         //    *PreparationTag.ToString(), InstanceIndex);
         return false;
     }
 
-    // Apply the preparation to both fields to keep them in sync
-    Instance.IngredientData.ActivePreparations.AddTag(PreparationTag);
+    // Apply the preparation
     Instance.Preparations.AddTag(PreparationTag);
     
     //UE_LOG(LogTemp,Log, TEXT("UPUDishBlueprintLibrary::ApplyPreparation - Applied %s to instance %d (now has %d preparations)"), 
@@ -334,16 +307,15 @@ bool UPUDishBlueprintLibrary::RemovePreparation(FPUDishBase& Dish, int32 Instanc
 
     FIngredientInstance& Instance = Dish.IngredientInstances[InstanceIndex];
     
-    // Check if this preparation is actually applied (check both Preparations and ActivePreparations)
-    if (!Instance.IngredientData.ActivePreparations.HasTag(PreparationTag) && !Instance.Preparations.HasTag(PreparationTag))
+    // Check if this preparation is actually applied
+    if (!Instance.Preparations.HasTag(PreparationTag))
     {
         //UE_LOG(LogTemp,Warning, TEXT("UPUDishBlueprintLibrary::RemovePreparation - Preparation %s not applied to instance %d"), 
         //    *PreparationTag.ToString(), InstanceIndex);
         return false;
     }
 
-    // Remove the preparation from both fields to keep them in sync
-    Instance.IngredientData.ActivePreparations.RemoveTag(PreparationTag);
+    // Remove the preparation
     Instance.Preparations.RemoveTag(PreparationTag);
     
     //UE_LOG(LogTemp,Log, TEXT("UPUDishBlueprintLibrary::RemovePreparation - Removed %s from instance %d (now has %d preparations)"), 
@@ -385,6 +357,37 @@ bool UPUDishBlueprintLibrary::RemoveIngredientInstanceByID(FPUDishBase& Dish, in
     return RemoveIngredientInstance(Dish, InstanceIndex);
 }
 
+int32 UPUDishBlueprintLibrary::AddIngredientInstance(FPUDishBase& Dish, const FIngredientInstance& Instance)
+{
+    FIngredientInstance NewInstance = Instance;
+    if (NewInstance.InstanceID == 0 || Dish.FindInstanceIndexByID(NewInstance.InstanceID) != INDEX_NONE)
+    {
+        NewInstance.InstanceID = Dish.AllocateInstanceID();
+    }
+    Dish.AddInstance(NewInstance);
+    return NewInstance.InstanceID;
+}
+
+bool UPUDishBlueprintLibrary::SetIngredientInstanceByID(FPUDishBase& Dish, int32 InstanceID, const FIngredientInstance& Instance)
+{
+    const int32 InstanceIndex = Dish.FindInstanceIndexByID(InstanceID);
+    if (InstanceIndex == INDEX_NONE)
+    {
+        //UE_LOG(LogTemp,Warning, TEXT("UPUDishBlueprintLibrary::SetIngredientInstanceByID - Instance ID %d not found"), InstanceID);
+        return false;
+    }
+
+    FIngredientInstance Replacement = Instance;
+    Replacement.InstanceID = InstanceID;
+    Dish.ReplaceInstanceAt(InstanceIndex, Replacement);
+    return true;
+}
+
+void UPUDishBlueprintLibrary::ClearIngredientInstances(FPUDishBase& Dish)
+{
+    Dish.ClearInstances();
+}
+
 bool UPUDishBlueprintLibrary::RemoveIngredientQuantityByID(FPUDishBase& Dish, int32 InstanceID, int32 Quantity)
 {
     int32 InstanceIndex = Dish.FindInstanceIndexByID(InstanceID);
@@ -406,7 +409,7 @@ bool UPUDishBlueprintLibrary::IncrementIngredientQuantityByID(FPUDishBase& Dish,
     }
     
     FIngredientInstance& Instance = Dish.IngredientInstances[InstanceIndex];
-    Instance.Quantity += Amount;
+    Dish.SetInstanceQuantity(InstanceIndex, Instance.Quantity + Amount);
     
     //UE_LOG(LogTemp,Log, TEXT("UPUDishBlueprintLibrary::IncrementIngredientQuantityByID - Incremented instance %d quantity by %d (new total: %d)"), 
     //    InstanceID, Amount, Instance.Quantity);
@@ -433,13 +436,13 @@ bool UPUDishBlueprintLibrary::DecrementIngredientQuantityByID(FPUDishBase& Dish,
         return false;
     }
     
-    Instance.Quantity -= Amount;
+    Dish.SetInstanceQuantity(InstanceIndex, Instance.Quantity - Amount);
     
     // If quantity reaches zero, remove the instance
     if (Instance.Quantity <= 0)
     {
         //UE_LOG(LogTemp,Log, TEXT("UPUDishBlueprintLibrary::DecrementIngredientQuantityByID - Quantity reached zero, removing instance %d"), InstanceID);
-        Dish.IngredientInstances.RemoveAt(InstanceIndex);
+        Dish.RemoveInstanceAt(InstanceIndex);
     }
     else
     {
@@ -460,6 +463,11 @@ float UPUDishBlueprintLibrary::GetTotalTextureAspect(const FPUDishBase& Dish, co
     return Dish.GetTotalTextureAspect(AspectName);
 }
 
+void UPUDishBlueprintLibrary::MarkDishAggregatesDirty(FPUDishBase& Dish)
+{
+    Dish.MarkAggregatesDirty();
+}
+
 bool UPUDishBlueprintLibrary::HasIngredient(const FPUDishBase& Dish, const FGameplayTag& IngredientTag)
 {
     return Dish.HasIngredient(IngredientTag);
@@ -525,7 +533,9 @@ bool UPUDishBlueprintLibrary::GetDishFromDataTable(UDataTable* DishDataTable, UD
             }
             */
             
-            // Populate IngredientData for each instance using the convenient fields
+            // Point each instance at its ingredient definition and rebuild its aspects from the tag and preparations
+            // (instances are rebuilt in place, so the running totals are rebuilt on the next query)
+            OutDish.MarkAggregatesDirty();
             for (FIngredientInstance& Instance : OutDish.IngredientInstances)
             {
                 if (Instance.IngredientTag.IsValid() && IngredientDataTable)
@@ -552,74 +562,40 @@ bool UPUDishBlueprintLibrary::GetDishFromDataTable(UDataTable* DishDataTable, UD
                     }
                     */
                     
-                    UDataTable* LoadedIngredientDataTable = IngredientDataTable;
-                    if (LoadedIngredientDataTable)
+                    if (IngredientDataTable)
                     {
-                        // Get the ingredient row name from the tag (removes "Ingredient." prefix, converts to lowercase, removes periods)
-                        FName IngredientRowName = GetIngredientRowNameFromTag(Instance.IngredientTag);
-                            
-                        if (FPUIngredientBase* FoundIngredient = LoadedIngredientDataTable->FindRow<FPUIngredientBase>(IngredientRowName, TEXT("GetDishFromDataTable")))
+                        // Resolve the row through the ingredient catalog (precomputed tag -> row index, no string building)
+                        if (const FPUIngredientBase* FoundIngredient = UPUIngredientCatalogSubsystem::ResolveIngredient(IngredientDataTable, Instance.IngredientTag))
                         {
-                            // Copy the base ingredient data
-                            Instance.IngredientData = *FoundIngredient;
+                            // Share the row and take its base aspects (and its preparations, kept below if the instance has none)
+                            const FGameplayTagContainer InstancePreparations = Instance.Preparations;
+                            Instance.SetIngredientData(*FoundIngredient);
                             
-                            // IMPORTANT: If the ingredient data table row has ActivePreparations set (like Prep.Char in bbqduck),
-                            // copy them to Instance.Preparations so they're preserved
-                            if (Instance.Preparations.Num() == 0 && Instance.IngredientData.ActivePreparations.Num() > 0)
+                            // IMPORTANT: If the ingredient data table row has ActivePreparations set (like Prep.Char in bbqduck)
+                            // and the instance has none of its own, the row's preparations are preserved
+                            if (InstancePreparations.Num() > 0)
                             {
-                                Instance.Preparations = Instance.IngredientData.ActivePreparations;
-                                if (bPU_LogDishDataTableDebug)
-                                {
-                                    //UE_LOG(LogTemp,Display, TEXT("UPUDishBlueprintLibrary::GetDishFromDataTable - Copied %d ActivePreparations from data table to Instance.Preparations"),
-                                    //    Instance.IngredientData.ActivePreparations.Num());
-                                }
+                                Instance.Preparations = InstancePreparations;
                             }
-                            
-                            // Sync both ways: if Instance.Preparations has values, use those; otherwise use ActivePreparations from data table
-                            if (Instance.Preparations.Num() > 0)
+                            else if (bPU_LogDishDataTableDebug)
                             {
-                                Instance.IngredientData.ActivePreparations = Instance.Preparations;
+                                //UE_LOG(LogTemp,Display, TEXT("UPUDishBlueprintLibrary::GetDishFromDataTable - Copied %d ActivePreparations from data table to Instance.Preparations"),
+                                //    Instance.Preparations.Num());
                             }
-                            // If Instance.Preparations is empty but ActivePreparations has values, they're already synced above
                             
-                            // Apply each preparation's modifiers
-                            if (Instance.IngredientData.PreparationDataTable.IsValid())
-                            {
-                                UDataTable* LoadedPreparationDataTable = Instance.IngredientData.PreparationDataTable.LoadSynchronous();
-                                if (LoadedPreparationDataTable)
-                                {
-                                    TArray<FGameplayTag> PreparationTags;
-                                    Instance.Preparations.GetGameplayTagArray(PreparationTags);
-
-                                    for (const FGameplayTag& PrepTag : PreparationTags)
-                                    {
-                                        // Get the preparation name from the tag (everything after the last period) and convert to lowercase
-                                        FString PrepTagName = PrepTag.ToString();
-                                        int32 PrepLastPeriodIndex;
-                                        if (PrepTagName.FindLastChar('.', PrepLastPeriodIndex))
-                                        {
-                                            FString PrepName = PrepTagName.RightChop(PrepLastPeriodIndex + 1).ToLower();
-                                            FName PrepRowName = FName(*PrepName);
-                                            
-                                            if (FPUPreparationBase* Preparation = LoadedPreparationDataTable->FindRow<FPUPreparationBase>(PrepRowName, TEXT("GetDishFromDataTable")))
-                                            {
-                                                // Apply preparation modifiers
-                                                Preparation->ApplyModifiers(Instance.IngredientData.FlavorAspects, Instance.IngredientData.TextureAspects);
-                                            }
-                                        }
-                                    }
-                                }
-                            }
+                            // Apply each preparation's modifiers (compiled per-lane transforms, no row lookups)
+                            UPUPreparationRegistrySubsystem::ApplyPreparations(FoundIngredient->PreparationDataTable, Instance.Preparations,
+                                Instance.FlavorAspects, Instance.TextureAspects);
                             
                             if (bPU_LogDishDataTableDebug)
                             {
                                 //UE_LOG(LogTemp,Display, TEXT("UPUDishBlueprintLibrary::GetDishFromDataTable - Successfully populated ingredient data for: %s"),
-                                //    *Instance.IngredientData.DisplayName.ToString());
+                                //    *Instance.GetDefinition().DisplayName.ToString());
                             }
                         }
                         else
                         {
-                            //UE_LOG(LogTemp,Warning, TEXT("UPUDishBlueprintLibrary::GetDishFromDataTable - Failed to find ingredient in data table: %s"), *IngredientRowName.ToString());
+                            //UE_LOG(LogTemp,Warning, TEXT("UPUDishBlueprintLibrary::GetDishFromDataTable - Failed to find ingredient in data table: %s"), *Instance.IngredientTag.ToString());
                         }
                     }
                     else
@@ -725,6 +701,42 @@ bool UPUDishBlueprintLibrary::GetIngredientForInstanceID(const FPUDishBase& Dish
     return Dish.GetIngredientForInstanceID(InstanceID, OutIngredient);
 }
 
+bool UPUDishBlueprintLibrary::GetIngredientDefinitionForInstanceID(const FPUDishBase& Dish, int32 InstanceID, FPUIngredientBase& OutDefinition)
+{
+    if (const FPUIngredientBase* Definition = Dish.GetIngredientDefinition(InstanceID))
+    {
+        OutDefinition = *Definition;
+        return true;
+    }
+    return false;
+}
+
+TArray<FGameplayTag> UPUDishBlueprintLibrary::GetEffectsAtQuantityForInstanceID(const FPUDishBase& Dish, int32 InstanceID, int32 Quantity)
+{
+    const FPUIngredientBase* Definition = Dish.GetIngredientDefinition(InstanceID);
+    return Definition ? Definition->GetEffectsAtQuantity(Quantity) : TArray<FGameplayTag>();
+}
+
+FPUIngredientBase UPUDishBlueprintLibrary::GetInstanceIngredientData(const FIngredientInstance& Instance)
+{
+    return Instance.GetIngredientData();
+}
+
+void UPUDishBlueprintLibrary::SetInstanceIngredientData(FIngredientInstance& Instance, const FPUIngredientBase& Ingredient)
+{
+    Instance.SetIngredientData(Ingredient);
+}
+
+FText UPUDishBlueprintLibrary::GetInstanceDisplayName(const FIngredientInstance& Instance)
+{
+    return Instance.GetCurrentDisplayName();
+}
+
+int64 UPUDishBlueprintLibrary::GetDishAllocatedBytes(const FPUDishBase& Dish)
+{
+    return static_cast<int64>(Dish.GetAllocatedSize());
+}
+
 // Plating-related functions
 bool UPUDishBlueprintLibrary::HasPlatingData(const FPUDishBase& Dish)
 {
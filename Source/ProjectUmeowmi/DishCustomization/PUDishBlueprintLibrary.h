@@ -84,6 +84,19 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Dish")
     static bool DecrementIngredientQuantityByID(UPARAM(ref) FPUDishBase& Dish, int32 InstanceID, int32 Amount = 1);
 
+    // Add a whole ingredient instance (IngredientInstances is read-only in Blueprint). Instances without an ID, or with
+    // one the dish already uses, get a new ID from the dish. Returns the instance's ID in the dish.
+    UFUNCTION(BlueprintCallable, Category = "Dish")
+    static int32 AddIngredientInstance(UPARAM(ref) FPUDishBase& Dish, const FIngredientInstance& Instance);
+
+    // Replace the instance with the given ID (the instance keeps that ID)
+    UFUNCTION(BlueprintCallable, Category = "Dish")
+    static bool SetIngredientInstanceByID(UPARAM(ref) FPUDishBase& Dish, int32 InstanceID, const FIngredientInstance& Instance);
+
+    // Remove every ingredient instance from the dish
+    UFUNCTION(BlueprintCallable, Category = "Dish")
+    static void ClearIngredientInstances(UPARAM(ref) FPUDishBase& Dish);
+
     // Get the total value for a specific flavor aspect
     UFUNCTION(BlueprintCallable, Category = "Dish|Aspects")
     static float GetTotalFlavorAspect(const FPUDishBase& Dish, const FName& AspectName);
@@ -92,6 +105,11 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Dish|Aspects")
     static float GetTotalTextureAspect(const FPUDishBase& Dish, const FName& AspectName);
 
+    // Rebuild the dish's running aspect/quantity totals and instance ID index on the next query
+    // (call after setting Ingredient Instances or editing an instance's data outside the functions above)
+    UFUNCTION(BlueprintCallable, Category = "Dish|Aspects")
+    static void MarkDishAggregatesDirty(UPARAM(ref) FPUDishBase& Dish);
+
     // Check if the dish has a specific ingredient
     UFUNCTION(BlueprintCallable, Category = "Dish")
     static bool HasIngredient(const FPUDishBase& Dish, const FGameplayTag& IngredientTag);
@@ -132,6 +150,31 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Dish|Ingredients")
     static bool GetIngredientForInstanceID(const FPUDishBase& Dish, int32 InstanceID, FPUIngredientBase& OutIngredient);
 
+    // Get the shared ingredient definition (data table row) for an instance ID.
+    // Prefer the ...ForInstanceID readers below when only one field is needed - they read the row in place instead of copying it.
+    UFUNCTION(BlueprintCallable, Category = "Dish|Ingredients")
+    static bool GetIngredientDefinitionForInstanceID(const FPUDishBase& Dish, int32 InstanceID, FPUIngredientBase& OutDefinition);
+
+    // Special effects the instance's ingredient triggers at a quantity (read from the shared row)
+    UFUNCTION(BlueprintPure, Category = "Dish|Ingredients")
+    static TArray<FGameplayTag> GetEffectsAtQuantityForInstanceID(const FPUDishBase& Dish, int32 InstanceID, int32 Quantity);
+
+    // An instance's ingredient: its shared definition with the instance's tag, preparations and aspects (a copy)
+    UFUNCTION(BlueprintPure, Category = "Dish|Ingredients")
+    static FPUIngredientBase GetInstanceIngredientData(const FIngredientInstance& Instance);
+
+    // Take tag, preparations and aspects from an ingredient and share the rest of it as the instance's definition
+    UFUNCTION(BlueprintCallable, Category = "Dish|Ingredients")
+    static void SetInstanceIngredientData(UPARAM(ref) FIngredientInstance& Instance, const FPUIngredientBase& Ingredient);
+
+    // Display name of an instance with its preparations applied
+    UFUNCTION(BlueprintPure, Category = "Dish|Ingredients")
+    static FText GetInstanceDisplayName(const FIngredientInstance& Instance);
+
+    // Approximate memory used by the dish and its instances, in bytes
+    UFUNCTION(BlueprintPure, Category = "Dish|Debug")
+    static int64 GetDishAllocatedBytes(const FPUDishBase& Dish);
+
     // Plating-related functions
     UFUNCTION(BlueprintCallable, Category = "Dish|Plating")
     static bool HasPlatingData(const FPUDishBase& Dish);
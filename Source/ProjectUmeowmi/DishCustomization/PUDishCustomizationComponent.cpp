@@ -8,6 +8,7 @@
 #include "Kismet/GameplayStatics.h"
 #include "../ProjectUmeowmiCharacter.h"
 #include "../PUProjectUmeowmiGameInstance.h"
+#include "../PUStats.h"
 #include "EnhancedInputSubsystems.h"
 #include "Engine/World.h"
 #include "EngineUtils.h"
@@ -22,13 +23,22 @@
 #include "Blueprint/WidgetBlueprintLibrary.h"
 #include "Components/StaticMeshComponent.h"
 #include "PUIngredientMesh.h"
+#include "PUIngredientCatalogSubsystem.h"
+#include "PUPreparationRegistrySubsystem.h"
+#include "PUTimeTempTable.h"
+#include "PUStationRegistrySubsystem.h"
 #include "Camera/CameraActor.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 
 // Debug output toggles (kept in code, but disabled by default to avoid log spam).
 namespace
 {
     // Enables logging of every ingredient tag when dish data is updated.
     constexpr bool bPU_LogDishDataIngredientTags = false;
+
+    // Enables a log line with the asset count / completion time of the customization preload.
+    constexpr bool bPU_LogCustomizationPreload = false;
 }
 
 void UPUDishCustomizationComponent::SetHUDVisible(bool bShouldBeVisible)
@@ -92,6 +102,25 @@ UPUDishCustomizationComponent::UPUDishCustomizationComponent()
 void UPUDishCustomizationComponent::BeginPlay()
 {
     Super::BeginPlay();
+
+    if (UPUStationRegistrySubsystem* StationRegistry = UPUStationRegistrySubsystem::Get(this))
+    {
+        StationRegistry->RegisterStation(this);
+    }
+}
+
+void UPUDishCustomizationComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    ClearAll3DIngredientMeshes();
+    IngredientMeshPool.DestroyAll();
+    PlatedIngredientBatches.DestroyAll();
+
+    if (UPUStationRegistrySubsystem* StationRegistry = UPUStationRegistrySubsystem::Get(this))
+    {
+        StationRegistry->UnregisterStation(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
 }
 
 void UPUDishCustomizationComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -114,10 +143,18 @@ void UPUDishCustomizationComponent::TickComponent(float DeltaTime, ELevelTick Ti
     {
         UpdateMouseDrag();
     }
+
+    if (bUseInstancedPlatingRender && bPlatingMode)
+    {
+        UpdatePlatedIngredientBatching(DeltaTime);
+    }
 }
 
 void UPUDishCustomizationComponent::StartCustomization(AProjectUmeowmiCharacter* Character)
 {
+    PU_SET_TIMING_STAGE("Customization");
+    PU_SCOPE_TIMING(StartCustomization);
+    
     //UE_LOG(LogTemp,Display, TEXT("🚀 UPUDishCustomizationComponent::StartCustomization - STARTING CUSTOMIZATION"));
     
     if (!Character)
@@ -126,6 +163,9 @@ void UPUDishCustomizationComponent::StartCustomization(AProjectUmeowmiCharacter*
         return;
     }
 
+    // Start streaming what the later stages need first, so the camera transition covers it
+    StartCustomizationPreload();
+
     // Store the original dish container mesh before any changes
     StoreOriginalDishContainerMesh();
 
@@ -296,7 +336,7 @@ void UPUDishCustomizationComponent::StartCustomization(AProjectUmeowmiCharacter*
         
         //UE_LOG(LogTemp,Display, TEXT("🎨 UPUDishCustomizationComponent::StartCustomization - World valid: %s"), *World->GetName());
         
-        CustomizationWidget = CreateWidget<UUserWidget>(World, CustomizationWidgetClass);
+        CustomizationWidget = AcquireStageWidget(CustomizationWidgetClass);
         if (CustomizationWidget)
         {
             //UE_LOG(LogTemp,Display, TEXT("✅ UPUDishCustomizationComponent::StartCustomization - Widget created successfully: %s"), *CustomizationWidget->GetName());
@@ -365,12 +405,16 @@ void UPUDishCustomizationComponent::StartCustomization(AProjectUmeowmiCharacter*
 
 void UPUDishCustomizationComponent::EndCustomization()
 {
+    PU_SET_TIMING_STAGE("None");
+    
     if (!CurrentCharacter)
     {
         //UE_LOG(LogTemp,Warning, TEXT("No current character in EndCustomization"));
         return;
     }
 
+    ReleaseCustomizationPreload();
+
     // Set HUD to HitTestInvisible when exiting customization (non-visible but non-hit testable)
     // This prevents the HUD from being visible but also prevents it from blocking input
     UWorld* World = GetWorld();
@@ -489,7 +533,7 @@ void UPUDishCustomizationComponent::EndCustomization()
     // Clean up the customization widget
     if (CustomizationWidget)
     {
-        CustomizationWidget->RemoveFromParent();
+        ReleaseStageWidget(CustomizationWidget);
         CustomizationWidget = nullptr;
         //UE_LOG(LogTemp,Log, TEXT("Customization UI Widget Removed"));
     }
@@ -497,7 +541,7 @@ void UPUDishCustomizationComponent::EndCustomization()
     // Clean up the cooking stage widget
     if (CookingStageWidget)
     {
-        CookingStageWidget->RemoveFromParent();
+        ReleaseStageWidget(CookingStageWidget);
         CookingStageWidget = nullptr;
         //UE_LOG(LogTemp,Log, TEXT("Cooking Stage Widget Removed"));
     }
@@ -962,6 +1006,11 @@ void UPUDishCustomizationComponent::HandleMouseClick(const FInputActionValue& Va
             //UE_LOG(LogTemp,Display, TEXT("🔍 Hit: %s"), Hit.GetActor() ? *Hit.GetActor()->GetName() : TEXT("NULL"));
             
             APUIngredientMesh* TestIngredient = Cast<APUIngredientMesh>(Hit.GetActor());
+            if (!TestIngredient && bUseInstancedPlatingRender)
+            {
+                // Batched pieces become actors again while grabbed
+                TestIngredient = PromoteBatchedPiece(Hit);
+            }
             if (TestIngredient)
             {
                 HitIngredient = TestIngredient;
@@ -980,6 +1029,7 @@ void UPUDishCustomizationComponent::HandleMouseClick(const FInputActionValue& Va
         bIsDragging = true;
         CurrentlyDraggedIngredient = HitIngredient;
         DragStartPosition = HitIngredient->GetActorLocation();
+        CacheDragPlane();
         
         // Calculate offset between mouse and ingredient
         FVector MouseWorldPosition = IngredientHitResult.Location;
@@ -1169,11 +1219,28 @@ void UPUDishCustomizationComponent::StartDraggingIngredient(APUIngredientMesh* I
     CurrentlyDraggedIngredient = Ingredient;
     DragStartPosition = IngredientAfterGrabPos;
     DragStartMousePosition = FVector(MouseX, MouseY, 0);
+    CacheDragPlane();
     
     //UE_LOG(LogTemp,Display, TEXT("✅ [DRAG] Started dragging ingredient: %s with offset: (%.2f,%.2f,%.2f)"), 
     //    *Ingredient->GetName(), DragOffset.X, DragOffset.Y, DragOffset.Z);
 }
 
+void UPUDishCustomizationComponent::CacheDragPlane()
+{
+    // The station doesn't move while the player is plating, so its surface plane is found once per drag
+    UPUStationRegistrySubsystem* StationRegistry = UPUStationRegistrySubsystem::Get(this);
+    AActor* DishStation = StationRegistry ? StationRegistry->FindDishStation() : nullptr;
+    bHasDragPlane = DishStation != nullptr;
+    if (!DishStation)
+    {
+        return;
+    }
+
+    DragStationLocation = DishStation->GetActorLocation();
+    const FVector StationBounds = DishStation->GetComponentsBoundingBox().GetSize();
+    DragPlaneHeight = DragStationLocation.Z + (StationBounds.Z * 0.2f);
+}
+
 void UPUDishCustomizationComponent::UpdateMouseDrag()
 {
     if (!bIsDragging || !CurrentCharacter)
@@ -1181,6 +1248,8 @@ void UPUDishCustomizationComponent::UpdateMouseDrag()
         return;
     }
     
+    PU_SCOPE_TIMING(UpdateMouseDrag);
+    
     // Check if the ingredient is still valid (not destroyed)
     if (!IsValid(CurrentlyDraggedIngredient))
     {
@@ -1217,28 +1286,10 @@ void UPUDishCustomizationComponent::UpdateMouseDrag()
     
     if (PlayerController->DeprojectScreenPositionToWorld(MouseX, MouseY, WorldLocation, WorldDirection))
     {
-        // Find the dish customization station to get the surface height
-        TArray<AActor*> FoundActors;
-        UGameplayStatics::GetAllActorsOfClass(GetWorld(), AActor::StaticClass(), FoundActors);
-        
-        AActor* DishStation = nullptr;
-        for (AActor* Actor : FoundActors)
+        if (bHasDragPlane)
         {
-            if (Actor && (Actor->GetName().Contains(TEXT("CookingStation")) || Actor->GetName().Contains(TEXT("DishCustomization"))))
-            {
-                DishStation = Actor;
-                break;
-            }
-        }
-        
-        if (DishStation)
-        {
-            // Calculate world position on the station surface
-            FVector StationLocation = DishStation->GetActorLocation();
-            FVector StationBounds = DishStation->GetComponentsBoundingBox().GetSize();
-            
-            // Calculate where the mouse ray intersects the station surface
-            float StationHeight = StationLocation.Z + (StationBounds.Z * 0.2f);
+            const FVector StationLocation = DragStationLocation;
+            const float StationHeight = DragPlaneHeight;
             
             // Calculate intersection point
             if (FMath::Abs(WorldDirection.Z) > SMALL_NUMBER)
@@ -1289,6 +1340,10 @@ void UPUDishCustomizationComponent::UpdateCurrentDishData(const FPUDishBase& New
     //    NewDishData.IngredientInstances.Num());
     
     CurrentDishData = NewDishData;
+    // May come from Blueprint, which can edit IngredientInstances directly
+    CurrentDishData.MarkAggregatesDirty();
+    CurrentDishData.ResolveIngredientDefinitions();
+    InstanceAspectBases.Reset();
     
     // Log the ingredients for debugging
     if (bPU_LogDishDataIngredientTags)
@@ -1297,7 +1352,7 @@ void UPUDishCustomizationComponent::UpdateCurrentDishData(const FPUDishBase& New
         {
             const FIngredientInstance& Instance = CurrentDishData.IngredientInstances[i];
             //UE_LOG(LogTemp,Display, TEXT("UPUDishCustomizationComponent::UpdateCurrentDishData - Ingredient %d: %s (Qty: %d)"),
-            //    i, *Instance.IngredientData.IngredientTag.ToString(), Instance.Quantity);
+            //    i, *Instance.IngredientTag.ToString(), Instance.Quantity);
         }
     }
 }
@@ -1316,6 +1371,185 @@ void UPUDishCustomizationComponent::SyncDishDataFromUI(const FPUDishBase& DishDa
     //UE_LOG(LogTemp,Display, TEXT("UPUDishCustomizationComponent::SyncDishDataFromUI - Dish data synced and broadcasted successfully"));
 }
 
+bool UPUDishCustomizationComponent::CommitIngredientInstance(const FIngredientInstance& Instance)
+{
+    const int32 InstanceIndex = CurrentDishData.FindInstanceIndexByID(Instance.InstanceID);
+    if (InstanceIndex == INDEX_NONE)
+    {
+        CurrentDishData.AddInstance(Instance);
+        FDishDelta Delta = FDishDelta::MakeForInstance(EPUDishDeltaType::InstanceAdded, Instance,
+            EPUDishDeltaField::Quantity | EPUDishDeltaField::Preparations | EPUDishDeltaField::TimeTemperature | EPUDishDeltaField::Aspects | EPUDishDeltaField::Plating);
+        BroadcastDishDelta(Delta);
+        return true;
+    }
+
+    const EPUDishDeltaField ChangedFields = FDishDelta::DiffInstances(CurrentDishData.IngredientInstances[InstanceIndex], Instance);
+    if (ChangedFields == EPUDishDeltaField::None)
+    {
+        return false;
+    }
+
+    CurrentDishData.ReplaceInstanceAt(InstanceIndex, Instance);
+    FDishDelta Delta = FDishDelta::MakeForInstance(EPUDishDeltaType::InstanceUpdated, Instance, ChangedFields);
+    BroadcastDishDelta(Delta);
+    return true;
+}
+
+bool UPUDishCustomizationComponent::RemoveIngredientInstanceByID(int32 InstanceID)
+{
+    const int32 InstanceIndex = CurrentDishData.FindInstanceIndexByID(InstanceID);
+    if (InstanceIndex == INDEX_NONE)
+    {
+        return false;
+    }
+
+    FDishDelta Delta;
+    Delta.ChangeType = EPUDishDeltaType::InstanceRemoved;
+    Delta.InstanceID = InstanceID;
+    Delta.IngredientTag = CurrentDishData.IngredientInstances[InstanceIndex].IngredientTag;
+
+    CurrentDishData.RemoveInstanceAt(InstanceIndex);
+    InstanceAspectBases.Remove(InstanceID);
+    BroadcastDishDelta(Delta);
+    return true;
+}
+
+bool UPUDishCustomizationComponent::SetInstanceTimeTemperature(int32 InstanceID, float TimeValue, float TemperatureValue)
+{
+    const int32 InstanceIndex = CurrentDishData.FindInstanceIndexByID(InstanceID);
+    if (InstanceIndex == INDEX_NONE)
+    {
+        return false;
+    }
+
+    const FIngredientInstance& Instance = CurrentDishData.IngredientInstances[InstanceIndex];
+    const FPUInstanceAspectBase* Base = FindOrBuildInstanceBase(Instance);
+    if (!Base)
+    {
+        return false;
+    }
+
+    if (Instance.TimeValue == TimeValue && Instance.TemperatureValue == TemperatureValue)
+    {
+        // Nothing moved - just make sure the stored aspects match the base (no broadcast if they already do)
+        return RecomputeInstance(InstanceID);
+    }
+
+    // Time/temp only picks a table cell, so the new aspects are one vector op away from the cached base
+    const FPUAspectVector NewAspects = CalculateInstanceAspectVector(*Base, TimeValue, TemperatureValue);
+
+    const bool bAspectsChanged = FMemory::Memcmp(NewAspects.Lanes, Instance.GetAspectVector().Lanes, sizeof(NewAspects.Lanes)) != 0;
+    CurrentDishData.ModifyInstanceAt(InstanceIndex, [&NewAspects, TimeValue, TemperatureValue](FIngredientInstance& Edited)
+    {
+        Edited.TimeValue = TimeValue;
+        Edited.TemperatureValue = TemperatureValue;
+        FPUIngredientBase::UnpackAspects(NewAspects, Edited.FlavorAspects, Edited.TextureAspects);
+    });
+
+    EPUDishDeltaField ChangedFields = EPUDishDeltaField::TimeTemperature;
+    if (bAspectsChanged)
+    {
+        ChangedFields |= EPUDishDeltaField::Aspects;
+    }
+    FDishDelta Delta = FDishDelta::MakeForInstance(EPUDishDeltaType::InstanceUpdated, CurrentDishData.IngredientInstances[InstanceIndex], ChangedFields);
+    BroadcastDishDelta(Delta);
+    return true;
+}
+
+bool UPUDishCustomizationComponent::RecomputeInstance(int32 InstanceID)
+{
+    const int32 InstanceIndex = CurrentDishData.FindInstanceIndexByID(InstanceID);
+    if (InstanceIndex == INDEX_NONE)
+    {
+        return false;
+    }
+
+    const FIngredientInstance& Instance = CurrentDishData.IngredientInstances[InstanceIndex];
+    const FPUInstanceAspectBase* Base = FindOrBuildInstanceBase(Instance);
+    if (!Base)
+    {
+        return false;
+    }
+
+    const FPUAspectVector NewAspects = CalculateInstanceAspectVector(*Base, Instance.TimeValue, Instance.TemperatureValue);
+    if (FMemory::Memcmp(NewAspects.Lanes, Instance.GetAspectVector().Lanes, sizeof(NewAspects.Lanes)) == 0)
+    {
+        return true;
+    }
+
+    CurrentDishData.ModifyInstanceAt(InstanceIndex, [&NewAspects](FIngredientInstance& Edited)
+    {
+        FPUIngredientBase::UnpackAspects(NewAspects, Edited.FlavorAspects, Edited.TextureAspects);
+    });
+
+    FDishDelta Delta = FDishDelta::MakeForInstance(EPUDishDeltaType::InstanceUpdated, CurrentDishData.IngredientInstances[InstanceIndex], EPUDishDeltaField::Aspects);
+    BroadcastDishDelta(Delta);
+    return true;
+}
+
+bool UPUDishCustomizationComponent::CalculateInstanceAspects(const FIngredientInstance& Instance, FFlavorAspects& OutFlavor, FTextureAspects& OutTexture)
+{
+    const FPUInstanceAspectBase* Base = FindOrBuildInstanceBase(Instance);
+    if (!Base)
+    {
+        return false;
+    }
+
+    FPUIngredientBase::UnpackAspects(CalculateInstanceAspectVector(*Base, Instance.TimeValue, Instance.TemperatureValue), OutFlavor, OutTexture);
+    return true;
+}
+
+const UPUDishCustomizationComponent::FPUInstanceAspectBase* UPUDishCustomizationComponent::FindOrBuildInstanceBase(const FIngredientInstance& Instance)
+{
+    const FGameplayTag IngredientTag = Instance.IngredientTag;
+    if (!IngredientTag.IsValid())
+    {
+        return nullptr;
+    }
+
+    if (const FPUInstanceAspectBase* Cached = InstanceAspectBases.Find(Instance.InstanceID))
+    {
+        if (Cached->IngredientTag == IngredientTag && Cached->Preparations == Instance.Preparations)
+        {
+            return Cached;
+        }
+    }
+
+    // Cache miss (new instance, or its ingredient/preparations changed) - resolve the row once.
+    // Fall back to the component's table if the dish doesn't name one (same as the slot used to).
+    const FPUIngredientBase* Row = CurrentDishData.IngredientDataTable.IsValid()
+        ? UPUIngredientCatalogSubsystem::ResolveIngredient(CurrentDishData.IngredientDataTable, IngredientTag)
+        : UPUIngredientCatalogSubsystem::ResolveIngredient(IngredientDataTable, IngredientTag);
+    if (!Row)
+    {
+        //UE_LOG(LogTemp,Warning, TEXT("⚠️ UPUDishCustomizationComponent::FindOrBuildInstanceBase - Could not find ingredient '%s'"), *IngredientTag.ToString());
+        return nullptr;
+    }
+
+    FPUInstanceAspectBase& Base = InstanceAspectBases.FindOrAdd(Instance.InstanceID);
+    Base.IngredientTag = IngredientTag;
+    Base.Preparations = Instance.Preparations;
+    Base.BaseAspects = Row->GetAspectVector();
+    UPUPreparationRegistrySubsystem::ApplyPreparations(Row->PreparationDataTable, Instance.Preparations, Base.BaseAspects);
+    Base.TimeTempTable = Row->GetSharedTimeTempTable();
+    return &Base;
+}
+
+FPUAspectVector UPUDishCustomizationComponent::CalculateInstanceAspectVector(const FPUInstanceAspectBase& Base, float TimeValue, float TemperatureValue) const
+{
+    FPUAspectVector Aspects = Base.BaseAspects;
+    Base.TimeTempTable->Apply(FPUIngredientBase::MapTimeValueToState(TimeValue),
+        FPUIngredientBase::MapTemperatureValueToState(TemperatureValue), Aspects);
+    return Aspects;
+}
+
+void UPUDishCustomizationComponent::BroadcastDishDelta(FDishDelta& Delta)
+{
+    Delta.Sequence = ++DishDeltaSequence;
+    FPUIngredientBase::UnpackAspects(CurrentDishData.GetTotalAspects(), Delta.DishFlavorTotals, Delta.DishTextureTotals);
+    OnDishDelta.Broadcast(Delta);
+}
+
 // This function is no longer needed - we'll use a different approach
 void UPUDishCustomizationComponent::SetDishCustomizationComponentOnWidget(UUserWidget* Widget)
 {
@@ -1355,6 +1589,38 @@ void UPUDishCustomizationComponent::SetActiveCustomizationWidget(UPUDishCustomiz
     }
 }
 
+UUserWidget* UPUDishCustomizationComponent::AcquireStageWidget(TSubclassOf<UUserWidget> WidgetClass)
+{
+    UWorld* World = GetWorld();
+    if (!WidgetClass || !World)
+    {
+        return nullptr;
+    }
+    
+    UUserWidget*& StageWidget = StageWidgets.FindOrAdd(WidgetClass);
+    if (StageWidget && StageWidget->IsInViewport())
+    {
+        // The cached one is still on screen (a stage moving to another stage of its own class) - can't share it
+        return CreateWidget<UUserWidget>(World, WidgetClass);
+    }
+    
+    if (!StageWidget)
+    {
+        StageWidget = CreateWidget<UUserWidget>(World, WidgetClass);
+    }
+    
+    return StageWidget;
+}
+
+void UPUDishCustomizationComponent::ReleaseStageWidget(UUserWidget* Widget)
+{
+    // Leaving the viewport runs the widget's NativeDestruct, which hands its slots back to its own pool
+    if (Widget)
+    {
+        Widget->RemoveFromParent();
+    }
+}
+
 void UPUDishCustomizationComponent::SetInitialDishData(const FPUDishBase& InitialDishData)
 {
     //UE_LOG(LogTemp,Display, TEXT("UPUDishCustomizationComponent::SetInitialDishData - Setting initial dish data: %s with %d ingredients"), 
@@ -1385,11 +1651,17 @@ void UPUDishCustomizationComponent::BroadcastInitialDishData(const FPUDishBase&
     //    *InitialDishData.DisplayName.ToString());
     
     CurrentDishData = InitialDishData;
+    // May come from Blueprint, which can edit IngredientInstances directly
+    CurrentDishData.MarkAggregatesDirty();
+    CurrentDishData.ResolveIngredientDefinitions();
+    InstanceAspectBases.Reset();
     OnInitialDishDataReceived.Broadcast(InitialDishData);
 }
 
 void UPUDishCustomizationComponent::StartPlanningMode()
 {
+    PU_SET_TIMING_STAGE("Planning");
+    
     //UE_LOG(LogTemp,Display, TEXT("🎯 UPUDishCustomizationComponent::StartPlanningMode - Starting planning mode"));
     
     bInPlanningMode = true;
@@ -1404,14 +1676,13 @@ void UPUDishCustomizationComponent::StartPlanningMode()
     TMap<FGameplayTag, FPUIngredientBase> UniqueIngredients;
     for (const FIngredientInstance& Instance : CurrentDishData.IngredientInstances)
     {
-        // Use convenient field if available, fallback to data field
-        FGameplayTag InstanceTag = Instance.IngredientTag.IsValid() ? Instance.IngredientTag : Instance.IngredientData.IngredientTag;
+        FGameplayTag InstanceTag = Instance.IngredientTag;
         
         // Only add if we haven't seen this ingredient tag before
         if (InstanceTag.IsValid() && !UniqueIngredients.Contains(InstanceTag))
         {
             // Use the ingredient data from the instance (which already has preparations applied)
-            UniqueIngredients.Add(InstanceTag, Instance.IngredientData);
+            UniqueIngredients.Add(InstanceTag, Instance.GetIngredientData());
             //UE_LOG(LogTemp,Display, TEXT("🎯 UPUDishCustomizationComponent::StartPlanningMode - Added existing ingredient to SelectedIngredients: %s"), 
             //    *InstanceTag.ToString());
         }
@@ -1438,10 +1709,17 @@ void UPUDishCustomizationComponent::StartPlanningMode()
 
 void UPUDishCustomizationComponent::TransitionToCookingStage(const FPUDishBase& DishData)
 {
+    PU_SET_TIMING_STAGE("Cooking");
+    PU_SCOPE_TIMING(TransitionToCookingStage);
+    
     //UE_LOG(LogTemp,Display, TEXT("🎯 UPUDishCustomizationComponent::TransitionToCookingStage - Transitioning to cooking stage"));
     
     // Store the dish data
     CurrentDishData = DishData;
+    // May come from Blueprint, which can edit IngredientInstances directly
+    CurrentDishData.MarkAggregatesDirty();
+    CurrentDishData.ResolveIngredientDefinitions();
+    InstanceAspectBases.Reset();
     
     // Switch to cooking stage camera
     SwitchToCookingCamera();
@@ -1456,7 +1734,7 @@ void UPUDishCustomizationComponent::TransitionToCookingStage(const FPUDishBase&
     // Remove the current customization widget
     if (CustomizationWidget)
     {
-        CustomizationWidget->RemoveFromParent();
+        ReleaseStageWidget(CustomizationWidget);
         CustomizationWidget = nullptr;
     }
     
@@ -1464,7 +1742,7 @@ void UPUDishCustomizationComponent::TransitionToCookingStage(const FPUDishBase&
     if (CurrentCharacter && CurrentCharacter->GetWorld())
     {
         // Create cooking stage widget (should be a subclass of PUDishCustomizationWidget)
-        if (UPUDishCustomizationWidget* CookingWidget = CreateWidget<UPUDishCustomizationWidget>(CurrentCharacter->GetWorld(), CookingStageWidgetClass))
+        if (UPUDishCustomizationWidget* CookingWidget = Cast<UPUDishCustomizationWidget>(AcquireStageWidget(CookingStageWidgetClass)))
         {
             // Store reference to cooking stage widget
             CookingStageWidget = CookingWidget;
@@ -1604,9 +1882,9 @@ void UPUDishCustomizationComponent::SpawnIngredientIn3D(const FGameplayTag& Ingr
     {
         const FIngredientInstance& Instance = CurrentDishData.IngredientInstances[i];
         //UE_LOG(LogTemp,Display, TEXT("🍽️ UPUDishCustomizationComponent::SpawnIngredientIn3D - Checking instance %d: %s vs %s"), 
-        //    i, *Instance.IngredientData.IngredientTag.ToString(), *IngredientTag.ToString());
+        //    i, *Instance.IngredientTag.ToString(), *IngredientTag.ToString());
         
-        if (Instance.IngredientData.IngredientTag == IngredientTag)
+        if (Instance.IngredientTag == IngredientTag)
         {
             // Check if we can place this ingredient (quantity limits)
             if (!CanPlaceIngredient(Instance.InstanceID))
@@ -1630,9 +1908,10 @@ void UPUDishCustomizationComponent::SpawnIngredientIn3D(const FGameplayTag& Ingr
             // Spawn visual 3D mesh
             SpawnVisualIngredientMesh(Instance, WorldPosition);
             
-            // Broadcast the updated dish data
-            //UE_LOG(LogTemp,Display, TEXT("🍽️ UPUDishCustomizationComponent::SpawnIngredientIn3D - Broadcasting OnDishDataUpdated"));
-            OnDishDataUpdated.Broadcast(CurrentDishData);
+            // Broadcast the plating change for this instance
+            //UE_LOG(LogTemp,Display, TEXT("🍽️ UPUDishCustomizationComponent::SpawnIngredientIn3D - Broadcasting OnDishDelta"));
+            FDishDelta Delta = FDishDelta::MakeForInstance(EPUDishDeltaType::InstanceUpdated, Instance, EPUDishDeltaField::Plating);
+            BroadcastDishDelta(Delta);
             
             //UE_LOG(LogTemp,Display, TEXT("🍽️ UPUDishCustomizationComponent::SpawnIngredientIn3D - END - Success"));
             return;
@@ -1655,45 +1934,44 @@ void UPUDishCustomizationComponent::SpawnIngredientIn3DByInstanceID(int32 Instan
     }
 
     // Find the specific ingredient instance by InstanceID
-    for (const FIngredientInstance& Instance : CurrentDishData.IngredientInstances)
+    if (const FIngredientInstance* FoundInstance = CurrentDishData.FindInstanceByID(InstanceID))
     {
-        if (Instance.InstanceID == InstanceID)
+        const FIngredientInstance& Instance = *FoundInstance;
+        //UE_LOG(LogTemp,Display, TEXT("🍽️ UPUDishCustomizationComponent::SpawnIngredientIn3DByInstanceID - Found instance %d: %s"), 
+        //    InstanceID, *Instance.GetDefinition().DisplayName.ToString());
+        
+        // Check if we can place this ingredient (quantity limits)
+        if (!CanPlaceIngredient(InstanceID))
         {
-            //UE_LOG(LogTemp,Display, TEXT("🍽️ UPUDishCustomizationComponent::SpawnIngredientIn3DByInstanceID - Found instance %d: %s"), 
-            //    InstanceID, *Instance.IngredientData.DisplayName.ToString());
-            
-            // Check if we can place this ingredient (quantity limits)
-            if (!CanPlaceIngredient(InstanceID))
-            {
-                //UE_LOG(LogTemp,Warning, TEXT("⚠️ UPUDishCustomizationComponent::SpawnIngredientIn3DByInstanceID - Cannot place ingredient %s (InstanceID: %d) - quantity limit reached"), 
-                //    *Instance.IngredientData.DisplayName.ToString(), InstanceID);
-                //UE_LOG(LogTemp,Display, TEXT("🍽️ UPUDishCustomizationComponent::SpawnIngredientIn3DByInstanceID - END - Failed (quantity limit)"));
-                return;
-            }
-            
-            //UE_LOG(LogTemp,Display, TEXT("🍽️ UPUDishCustomizationComponent::SpawnIngredientIn3DByInstanceID - Can place ingredient! Setting plating position"));
-            
-            // Set the plating position for this ingredient
-            CurrentDishData.SetIngredientPlating(InstanceID, WorldPosition, FRotator::ZeroRotator, FVector::OneVector);
-            
-            // Track the placement
-            PlaceIngredient(InstanceID);
-            
-            // Update the ingredient slot's quantity display (NOT buttons - we use slots in plating mode)
-            UpdateIngredientSlotQuantity(InstanceID);
-            
-            //UE_LOG(LogTemp,Display, TEXT("✅ UPUDishCustomizationComponent::SpawnIngredientIn3DByInstanceID - Set plating for instance %d"), InstanceID);
-            
-            // Spawn visual 3D mesh
-            SpawnVisualIngredientMesh(Instance, WorldPosition);
-            
-            // Broadcast the updated dish data
-            //UE_LOG(LogTemp,Display, TEXT("🍽️ UPUDishCustomizationComponent::SpawnIngredientIn3DByInstanceID - Broadcasting OnDishDataUpdated"));
-            OnDishDataUpdated.Broadcast(CurrentDishData);
-            
-            //UE_LOG(LogTemp,Display, TEXT("🍽️ UPUDishCustomizationComponent::SpawnIngredientIn3DByInstanceID - END - Success"));
+            //UE_LOG(LogTemp,Warning, TEXT("⚠️ UPUDishCustomizationComponent::SpawnIngredientIn3DByInstanceID - Cannot place ingredient %s (InstanceID: %d) - quantity limit reached"), 
+            //    *Instance.GetDefinition().DisplayName.ToString(), InstanceID);
+            //UE_LOG(LogTemp,Display, TEXT("🍽️ UPUDishCustomizationComponent::SpawnIngredientIn3DByInstanceID - END - Failed (quantity limit)"));
             return;
         }
+        
+        //UE_LOG(LogTemp,Display, TEXT("🍽️ UPUDishCustomizationComponent::SpawnIngredientIn3DByInstanceID - Can place ingredient! Setting plating position"));
+        
+        // Set the plating position for this ingredient
+        CurrentDishData.SetIngredientPlating(InstanceID, WorldPosition, FRotator::ZeroRotator, FVector::OneVector);
+        
+        // Track the placement
+        PlaceIngredient(InstanceID);
+        
+        // Update the ingredient slot's quantity display (NOT buttons - we use slots in plating mode)
+        UpdateIngredientSlotQuantity(InstanceID);
+        
+        //UE_LOG(LogTemp,Display, TEXT("✅ UPUDishCustomizationComponent::SpawnIngredientIn3DByInstanceID - Set plating for instance %d"), InstanceID);
+        
+        // Spawn visual 3D mesh
+        SpawnVisualIngredientMesh(Instance, WorldPosition);
+        
+        // Broadcast the plating change for this instance
+        //UE_LOG(LogTemp,Display, TEXT("🍽️ UPUDishCustomizationComponent::SpawnIngredientIn3DByInstanceID - Broadcasting OnDishDelta"));
+        FDishDelta Delta = FDishDelta::MakeForInstance(EPUDishDeltaType::InstanceUpdated, Instance, EPUDishDeltaField::Plating);
+        BroadcastDishDelta(Delta);
+        
+        //UE_LOG(LogTemp,Display, TEXT("🍽️ UPUDishCustomizationComponent::SpawnIngredientIn3DByInstanceID - END - Success"));
+        return;
     }
 
     //UE_LOG(LogTemp,Warning, TEXT("⚠️ UPUDishCustomizationComponent::SpawnIngredientIn3DByInstanceID - InstanceID %d not found in current dish"), InstanceID);
@@ -1715,6 +1993,9 @@ bool UPUDishCustomizationComponent::IsPlatingMode() const
 
 void UPUDishCustomizationComponent::TransitionToPlatingStage(const FPUDishBase& DishData)
 {
+    PU_SET_TIMING_STAGE("Plating");
+    PU_SCOPE_TIMING(TransitionToPlatingStage);
+    
     //UE_LOG(LogTemp,Display, TEXT("🍽️ UPUDishCustomizationComponent::TransitionToPlatingStage - Transitioning to plating stage"));
     
     // Set plating mode
@@ -1725,6 +2006,10 @@ void UPUDishCustomizationComponent::TransitionToPlatingStage(const FPUDishBase&
     
     // Update the current dish data
     CurrentDishData = DishData;
+    // May come from Blueprint, which can edit IngredientInstances directly
+    CurrentDishData.MarkAggregatesDirty();
+    CurrentDishData.ResolveIngredientDefinitions();
+    InstanceAspectBases.Reset();
     
     // Switch to plating widget class if available
     if (PlatingWidgetClass)
@@ -1738,7 +2023,7 @@ void UPUDishCustomizationComponent::TransitionToPlatingStage(const FPUDishBase&
         if (CustomizationWidget)
         {
             //UE_LOG(LogTemp,Display, TEXT("🍽️ UPUDishCustomizationComponent::TransitionToPlatingStage - Removing current widget"));
-            CustomizationWidget->RemoveFromParent();
+            ReleaseStageWidget(CustomizationWidget);
             CustomizationWidget = nullptr;
         }
         
@@ -1747,7 +2032,7 @@ void UPUDishCustomizationComponent::TransitionToPlatingStage(const FPUDishBase&
         if (World)
         {
             //UE_LOG(LogTemp,Display, TEXT("🍽️ UPUDishCustomizationComponent::TransitionToPlatingStage - Creating new plating widget"));
-            CustomizationWidget = CreateWidget<UUserWidget>(World, CustomizationWidgetClass);
+            CustomizationWidget = AcquireStageWidget(CustomizationWidgetClass);
             
             if (CustomizationWidget)
             {
@@ -1829,6 +2114,9 @@ void UPUDishCustomizationComponent::TransitionToPlatingStage(const FPUDishBase&
             //UE_LOG(LogTemp,Warning, TEXT("⚠️ UPUDishCustomizationComponent::TransitionToPlatingStage - Failed to load mesh directly by path"));
         }
     }
+
+    // Have ingredient mesh actors ready before the first placement
+    IngredientMeshPool.Prewarm(GetWorld(), GetOwner(), IngredientMeshPoolPrewarmCount);
     
     //UE_LOG(LogTemp,Display, TEXT("🍽️ UPUDishCustomizationComponent::TransitionToPlatingStage - Plating stage transition complete"));
 }
@@ -1844,7 +2132,7 @@ void UPUDishCustomizationComponent::EndPlatingStage()
     if (CustomizationWidget)
     {
         //UE_LOG(LogTemp,Display, TEXT("🍽️ UPUDishCustomizationComponent::EndPlatingStage - Removing plating widget from viewport"));
-        CustomizationWidget->RemoveFromParent();
+        ReleaseStageWidget(CustomizationWidget);
         CustomizationWidget = nullptr;
     }
 
@@ -1886,7 +2174,7 @@ void UPUDishCustomizationComponent::SpawnVisualIngredientMesh(const FIngredientI
     }
 
     // Check if the ingredient has a mesh
-    UStaticMesh* IngredientMesh = IngredientInstance.IngredientData.IngredientMesh.LoadSynchronous();
+    UStaticMesh* IngredientMesh = IngredientInstance.GetDefinition().IngredientMesh.LoadSynchronous();
     
     if (!IngredientMesh)
     {
@@ -1904,17 +2192,14 @@ void UPUDishCustomizationComponent::SpawnVisualIngredientMesh(const FIngredientI
     // Since ingredients have physics, they'll settle naturally on the surface
     FVector SpawnPosition = WorldPosition + FVector(0, 0, 20); // Offset above the surface for visibility and clickability
 
-    // Spawn the interactive ingredient mesh actor
-    FActorSpawnParameters SpawnParams;
-    SpawnParams.Owner = OwnerActor;
-    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-
-    APUIngredientMesh* SpawnedIngredient = World->SpawnActor<APUIngredientMesh>(APUIngredientMesh::StaticClass(), SpawnPosition, FRotator::ZeroRotator, SpawnParams);
+    // Take an interactive ingredient mesh actor from the pool (spawns one if none are free)
+    APUIngredientMesh* SpawnedIngredient = IngredientMeshPool.Acquire(World, OwnerActor, SpawnPosition, FRotator::ZeroRotator);
     
     if (SpawnedIngredient)
     {
         // Initialize the ingredient with its data
-        SpawnedIngredient->InitializeWithIngredient(IngredientInstance.IngredientData);
+        SpawnedIngredient->InitializeWithIngredient(IngredientInstance.GetIngredientData());
+        SpawnedIngredient->SetInstanceID(IngredientInstance.InstanceID);
         
         // Set the mesh manually if needed
         UStaticMeshComponent* MeshComponent = SpawnedIngredient->FindComponentByClass<UStaticMeshComponent>();
@@ -1930,7 +2215,7 @@ void UPUDishCustomizationComponent::SpawnVisualIngredientMesh(const FIngredientI
         SpawnedIngredientMeshes.Add(SpawnedIngredient);
         
         //UE_LOG(LogTemp,Display, TEXT("✅ Spawned interactive ingredient: %s (Total spawned: %d) - Scaled to (%.2f,%.2f,%.2f)"), 
-        //    *IngredientInstance.IngredientData.IngredientTag.ToString(), SpawnedIngredientMeshes.Num(),
+        //    *IngredientInstance.IngredientTag.ToString(), SpawnedIngredientMeshes.Num(),
         //    IngredientMeshScale.X, IngredientMeshScale.Y, IngredientMeshScale.Z);
     }
 }
@@ -2184,18 +2469,16 @@ void UPUDishCustomizationComponent::SetPlatingCameraPositionOffset(const FVector
 bool UPUDishCustomizationComponent::CanPlaceIngredient(int32 InstanceID) const
 {
     // Find the ingredient instance
-    for (const FIngredientInstance& Instance : CurrentDishData.IngredientInstances)
+    if (const FIngredientInstance* FoundInstance = CurrentDishData.FindInstanceByID(InstanceID))
     {
-        if (Instance.InstanceID == InstanceID)
-        {
-            int32 PlacedQuantity = GetPlacedQuantity(InstanceID);
-            bool bCanPlace = PlacedQuantity < Instance.Quantity;
-            
-            //UE_LOG(LogTemp,Display, TEXT("🍽️ UPUDishCustomizationComponent::CanPlaceIngredient - Instance %d: Placed %d/%d, Can place: %s"), 
-            //    InstanceID, PlacedQuantity, Instance.Quantity, bCanPlace ? TEXT("Yes") : TEXT("No"));
-            
-            return bCanPlace;
-        }
+        const FIngredientInstance& Instance = *FoundInstance;
+        int32 PlacedQuantity = GetPlacedQuantity(InstanceID);
+        bool bCanPlace = PlacedQuantity < Instance.Quantity;
+        
+        //UE_LOG(LogTemp,Display, TEXT("🍽️ UPUDishCustomizationComponent::CanPlaceIngredient - Instance %d: Placed %d/%d, Can place: %s"), 
+        //    InstanceID, PlacedQuantity, Instance.Quantity, bCanPlace ? TEXT("Yes") : TEXT("No"));
+        
+        return bCanPlace;
     }
     
     //UE_LOG(LogTemp,Warning, TEXT("⚠️ UPUDishCustomizationComponent::CanPlaceIngredient - Instance %d not found"), InstanceID);
@@ -2204,18 +2487,16 @@ bool UPUDishCustomizationComponent::CanPlaceIngredient(int32 InstanceID) const
 
 int32 UPUDishCustomizationComponent::GetRemainingQuantity(int32 InstanceID) const
 {
-    for (const FIngredientInstance& Instance : CurrentDishData.IngredientInstances)
+    if (const FIngredientInstance* FoundInstance = CurrentDishData.FindInstanceByID(InstanceID))
     {
-        if (Instance.InstanceID == InstanceID)
-        {
-            int32 PlacedQuantity = GetPlacedQuantity(InstanceID);
-            int32 Remaining = Instance.Quantity - PlacedQuantity;
-            
-            //UE_LOG(LogTemp,Display, TEXT("🍽️ UPUDishCustomizationComponent::GetRemainingQuantity - Instance %d: %d remaining"), 
-            //    InstanceID, Remaining);
-            
-            return Remaining;
-        }
+        const FIngredientInstance& Instance = *FoundInstance;
+        int32 PlacedQuantity = GetPlacedQuantity(InstanceID);
+        int32 Remaining = Instance.Quantity - PlacedQuantity;
+        
+        //UE_LOG(LogTemp,Display, TEXT("🍽️ UPUDishCustomizationComponent::GetRemainingQuantity - Instance %d: %d remaining"), 
+        //    InstanceID, Remaining);
+        
+        return Remaining;
     }
     
     //UE_LOG(LogTemp,Warning, TEXT("⚠️ UPUDishCustomizationComponent::GetRemainingQuantity - Instance %d not found"), InstanceID);
@@ -2264,7 +2545,7 @@ bool UPUDishCustomizationComponent::CanPlaceIngredientByTag(const FGameplayTag&
 {
     for (const FIngredientInstance& Instance : CurrentDishData.IngredientInstances)
     {
-        if (Instance.IngredientData.IngredientTag == IngredientTag)
+        if (Instance.IngredientTag == IngredientTag)
         {
             return CanPlaceIngredient(Instance.InstanceID);
         }
@@ -2278,7 +2559,7 @@ int32 UPUDishCustomizationComponent::GetRemainingQuantityByTag(const FGameplayTa
 {
     for (const FIngredientInstance& Instance : CurrentDishData.IngredientInstances)
     {
-        if (Instance.IngredientData.IngredientTag == IngredientTag)
+        if (Instance.IngredientTag == IngredientTag)
         {
             return GetRemainingQuantity(Instance.InstanceID);
         }
@@ -2292,7 +2573,7 @@ int32 UPUDishCustomizationComponent::GetPlacedQuantityByTag(const FGameplayTag&
 {
     for (const FIngredientInstance& Instance : CurrentDishData.IngredientInstances)
     {
-        if (Instance.IngredientData.IngredientTag == IngredientTag)
+        if (Instance.IngredientTag == IngredientTag)
         {
             return GetPlacedQuantity(Instance.InstanceID);
         }
@@ -2309,19 +2590,13 @@ void UPUDishCustomizationComponent::UpdateIngredientSlotQuantity(int32 InstanceI
     // Find the ingredient slot and update its quantity
     if (UPUDishCustomizationWidget* DishWidget = Cast<UPUDishCustomizationWidget>(CustomizationWidget))
     {
-        // Get the created ingredient slots from the widget
-        const TArray<class UPUIngredientSlot*>& IngredientSlots = DishWidget->GetCreatedIngredientSlots();
-        
-        // Find the slot with matching InstanceID
-        for (UPUIngredientSlot* IngredientSlot : IngredientSlots)
+        // Find the slot with matching InstanceID (the widget keeps them indexed by ID)
+        if (UPUIngredientSlot* IngredientSlot = DishWidget->FindIngredientSlotByInstanceID(InstanceID))
         {
-            if (IngredientSlot && IngredientSlot->GetIngredientInstance().InstanceID == InstanceID)
-            {
-                // Decrease the slot's remaining quantity
-                IngredientSlot->DecreaseQuantity();
-                //UE_LOG(LogTemp,Display, TEXT("🍽️ UPUDishCustomizationComponent::UpdateIngredientSlotQuantity - Decreased quantity for slot (InstanceID: %d)"), InstanceID);
-                return;
-            }
+            // Decrease the slot's remaining quantity
+            IngredientSlot->DecreaseQuantity();
+            //UE_LOG(LogTemp,Display, TEXT("🍽️ UPUDishCustomizationComponent::UpdateIngredientSlotQuantity - Decreased quantity for slot (InstanceID: %d)"), InstanceID);
+            return;
         }
         
         //UE_LOG(LogTemp,Warning, TEXT("⚠️ UPUDishCustomizationComponent::UpdateIngredientSlotQuantity - No slot found for InstanceID: %d"), InstanceID);
@@ -2390,7 +2665,7 @@ void UPUDishCustomizationComponent::ClearAll3DIngredientMeshes()
         CurrentlyDraggedIngredient = nullptr;
     }
     
-    // Destroy all tracked ingredient meshes
+    // Return all tracked ingredient meshes to the pool
     int32 ValidCount = 0;
     int32 InvalidCount = 0;
     
@@ -2406,10 +2681,10 @@ void UPUDishCustomizationComponent::ClearAll3DIngredientMeshes()
                 MeshName = IngredientMesh->GetName();
             }
             
-            //UE_LOG(LogTemp,Display, TEXT("🍽️ [CLEANUP] ClearAll3DIngredientMeshes - Destroying ingredient mesh: %s"), 
+            //UE_LOG(LogTemp,Display, TEXT("🍽️ [CLEANUP] ClearAll3DIngredientMeshes - Returning ingredient mesh to the pool: %s"), 
             //    *MeshName);
             
-            IngredientMesh->Destroy();
+            IngredientMeshPool.Release(IngredientMesh);
             ValidCount++;
         }
         else
@@ -2423,14 +2698,98 @@ void UPUDishCustomizationComponent::ClearAll3DIngredientMeshes()
         //UE_LOG(LogTemp,Warning, TEXT("⚠️ [CLEANUP] ClearAll3DIngredientMeshes - Found %d invalid ingredient mesh pointers"), InvalidCount);
     }
     
-    //UE_LOG(LogTemp,Display, TEXT("🍽️ [CLEANUP] ClearAll3DIngredientMeshes - Destroyed %d valid meshes"), ValidCount);
+    //UE_LOG(LogTemp,Display, TEXT("🍽️ [CLEANUP] ClearAll3DIngredientMeshes - Pooled %d valid meshes"), ValidCount);
     
     // Clear the tracking array
     SpawnedIngredientMeshes.Empty();
+
+    // Batched (settled) pieces go too
+    PlatedIngredientBatches.Clear();
+    PlatingSettleTimers.Reset();
     
     //UE_LOG(LogTemp,Display, TEXT("🍽️ [CLEANUP] ClearAll3DIngredientMeshes - All 3D ingredient meshes cleared"));
 }
 
+void UPUDishCustomizationComponent::UpdatePlatedIngredientBatching(float DeltaTime)
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    for (int32 Index = SpawnedIngredientMeshes.Num() - 1; Index >= 0; --Index)
+    {
+        APUIngredientMesh* Piece = SpawnedIngredientMeshes[Index];
+        if (!IsValid(Piece))
+        {
+            SpawnedIngredientMeshes.RemoveAtSwap(Index);
+            continue;
+        }
+
+        UStaticMeshComponent* MeshComponent = Piece->GetMeshComponent();
+        if (!MeshComponent || Piece == CurrentlyDraggedIngredient || Piece->IsGrabbed() || Piece->IsHovered())
+        {
+            PlatingSettleTimers.Remove(Piece);
+            continue;
+        }
+
+        bool bSettled = !MeshComponent->RigidBodyIsAwake();
+        if (!bSettled)
+        {
+            float& SettleTimer = PlatingSettleTimers.FindOrAdd(Piece);
+            SettleTimer = MeshComponent->GetPhysicsLinearVelocity().Size() < PlatingSettleSpeed ? SettleTimer + DeltaTime : 0.0f;
+            bSettled = SettleTimer >= PlatingSettleTime;
+        }
+
+        if (bSettled && PlatedIngredientBatches.AddPiece(World, GetOwner(), Piece))
+        {
+            PlatingSettleTimers.Remove(Piece);
+            SpawnedIngredientMeshes.RemoveAtSwap(Index);
+            IngredientMeshPool.Release(Piece);
+        }
+    }
+}
+
+APUIngredientMesh* UPUDishCustomizationComponent::PromoteBatchedPiece(const FHitResult& Hit)
+{
+    if (!PlatedIngredientBatches.IsBatchComponent(Hit.GetComponent()))
+    {
+        return nullptr;
+    }
+
+    FTransform PieceTransform;
+    int32 PieceInstanceID = 0;
+    FPUIngredientBase PieceIngredientData;
+    UStaticMesh* PieceMesh = nullptr;
+    UMaterialInterface* PieceMaterial = nullptr;
+    if (!PlatedIngredientBatches.TakePiece(Hit, PieceTransform, PieceInstanceID, PieceIngredientData, PieceMesh, PieceMaterial))
+    {
+        return nullptr;
+    }
+
+    APUIngredientMesh* Piece = IngredientMeshPool.Acquire(GetWorld(), GetOwner(), PieceTransform.GetLocation(), PieceTransform.Rotator());
+    if (Piece)
+    {
+        Piece->InitializeWithIngredient(PieceIngredientData);
+        Piece->SetInstanceID(PieceInstanceID);
+
+        // Look exactly like the batched instance did: the ingredient data may not name the mesh (cube fallback) or
+        // material it was drawn with, and a pooled actor would otherwise keep the previous piece's mesh
+        if (UStaticMeshComponent* MeshComponent = Piece->GetMeshComponent())
+        {
+            MeshComponent->SetStaticMesh(PieceMesh);
+            if (PieceMaterial)
+            {
+                MeshComponent->SetMaterial(0, PieceMaterial);
+            }
+        }
+        Piece->SetActorScale3D(PieceTransform.GetScale3D());
+        SpawnedIngredientMeshes.Add(Piece);
+    }
+    return Piece;
+}
+
 void UPUDishCustomizationComponent::SwapDishContainerMesh(UStaticMesh* NewDishMesh)
 {
     //UE_LOG(LogTemp,Display, TEXT("🍽️ UPUDishCustomizationComponent::SwapDishContainerMesh - Swapping dish container mesh"));
@@ -2707,4 +3066,68 @@ void UPUDishCustomizationComponent::StoreOriginalDishContainerMesh()
     
     //UE_LOG(LogTemp,Display, TEXT("🍽️ UPUDishCustomizationComponent::StoreOriginalDishContainerMesh - Stored %d child meshes"), 
     //    OriginalDishContainerChildren.Num());
-}
\ No newline at end of file
+}
+
+void UPUDishCustomizationComponent::StartCustomizationPreload()
+{
+    ReleaseCustomizationPreload();
+
+    TArray<FSoftObjectPath> AssetsToLoad;
+    auto AddAsset = [&AssetsToLoad](const FSoftObjectPath& Path)
+    {
+        // Resident assets are requested too: the handle is what keeps them from being collected until customization ends
+        if (!Path.IsNull())
+        {
+            AssetsToLoad.AddUnique(Path);
+        }
+    };
+
+    // Only unlocked ingredients (same filter as the pantry)
+    for (const FPUIngredientBase& Ingredient : GetIngredientData())
+    {
+        AddAsset(Ingredient.IngredientMesh.ToSoftObjectPath());
+        AddAsset(Ingredient.MaterialInstance.ToSoftObjectPath());
+        AddAsset(Ingredient.PreparationDataTable.ToSoftObjectPath());
+    }
+
+    AddAsset(PlatingDishMesh.ToSoftObjectPath());
+
+    UWorld* World = GetWorld();
+    if (UPUProjectUmeowmiGameInstance* GameInstance = World ? Cast<UPUProjectUmeowmiGameInstance>(World->GetGameInstance()) : nullptr)
+    {
+        AddAsset(GameInstance->GetPopupWidgetClass().ToSoftObjectPath());
+    }
+
+    if (AssetsToLoad.Num() == 0)
+    {
+        return;
+    }
+
+    const double PreloadStartTime = FPlatformTime::Seconds();
+    const int32 NumAssets = AssetsToLoad.Num();
+    CustomizationPreloadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(MoveTemp(AssetsToLoad),
+        FStreamableDelegate::CreateLambda([PreloadStartTime, NumAssets]()
+        {
+            if (bPU_LogCustomizationPreload)
+            {
+                UE_LOG(LogTemp, Display, TEXT("UPUDishCustomizationComponent::StartCustomizationPreload - %d asset(s) resident after %.1f ms"),
+                    NumAssets, (FPlatformTime::Seconds() - PreloadStartTime) * 1000.0);
+            }
+        }),
+        FStreamableManager::AsyncLoadHighPriority, false, false, TEXT("DishCustomizationPreload"));
+}
+
+void UPUDishCustomizationComponent::ReleaseCustomizationPreload()
+{
+    if (CustomizationPreloadHandle.IsValid())
+    {
+        // Anything still referenced (spawned meshes, open widgets) stays loaded; the rest can be collected
+        CustomizationPreloadHandle->ReleaseHandle();
+        CustomizationPreloadHandle.Reset();
+    }
+}
+
+float UPUDishCustomizationComponent::GetCustomizationPreloadProgress() const
+{
+    return CustomizationPreloadHandle.IsValid() ? CustomizationPreloadHandle->GetProgress() : 1.0f;
+}
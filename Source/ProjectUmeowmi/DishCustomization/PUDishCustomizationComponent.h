@@ -3,21 +3,28 @@
 #include "CoreMinimal.h"
 #include "Components/SceneComponent.h"
 #include "PUDishBase.h"
+#include "PUDishDelta.h"
 #include "PUPreparationBase.h"
+#include "PUAspectVector.h"
+#include "PUIngredientMeshPool.h"
+#include "PUPlatedIngredientBatches.h"
 #include "../ProjectUmeowmiCharacter.h"
 #include "../UI/PUDishCustomizationWidget.h"
 #include "Components/SlateWrapperTypes.h"
 #include "PUDishCustomizationComponent.generated.h"
 
 // Forward declarations
+struct FPUTimeTempTable;
 class UUserWidget;
 class UInputAction;
 class UEnhancedInputComponent;
 class UInputMappingContext;
+class APUIngredientMesh;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnCustomizationEnded);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnDishDataUpdated, const FPUDishBase&, NewDishData);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnInitialDishDataReceived, const FPUDishBase&, InitialDishData);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnDishDelta, const FDishDelta&, Delta);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPlanningCompleted, const FPUPlanningData&, InPlanningData);
 
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
@@ -29,6 +36,7 @@ public:
     UPUDishCustomizationComponent();
 
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
     // Activation/Deactivation
@@ -42,6 +50,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Dish Customization")
     bool IsCustomizing() const { return CurrentCharacter != nullptr; }
 
+    // Progress (0-1) of the asset preload started by StartCustomization (1 when nothing is streaming)
+    UFUNCTION(BlueprintCallable, Category = "Dish Customization")
+    float GetCustomizationPreloadProgress() const;
+
     // Dish data management
     UFUNCTION(BlueprintCallable, Category = "Dish Customization")
     void UpdateCurrentDishData(const FPUDishBase& NewDishData);
@@ -49,10 +61,32 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Dish Customization")
     const FPUDishBase& GetCurrentDishData() const { return CurrentDishData; }
 
-    // Blueprint-callable function for UI to sync dish data
+    // Blueprint-callable function for UI to sync dish data (full snapshot - prefer the instance functions below)
     UFUNCTION(BlueprintCallable, Category = "Dish Customization|UI")
     void SyncDishDataFromUI(const FPUDishBase& DishDataFromUI);
 
+    // Add or update one ingredient instance in the current dish and broadcast only what changed (OnDishDelta)
+    UFUNCTION(BlueprintCallable, Category = "Dish Customization|UI")
+    bool CommitIngredientInstance(const FIngredientInstance& Instance);
+
+    // Remove one ingredient instance from the current dish and broadcast the removal (OnDishDelta)
+    UFUNCTION(BlueprintCallable, Category = "Dish Customization|UI")
+    bool RemoveIngredientInstanceByID(int32 InstanceID);
+
+    // Set an instance's time/temperature and recompute its aspects in place (slider drags).
+    // Returns false if the instance is not in the current dish or its ingredient row can't be found.
+    UFUNCTION(BlueprintCallable, Category = "Dish Customization|UI")
+    bool SetInstanceTimeTemperature(int32 InstanceID, float TimeValue, float TemperatureValue);
+
+    // Recompute an instance's per-unit aspects from its cached base (row + preparations) and its time/temperature.
+    // Broadcasts a delta only if the aspects changed. Returns false if the instance can't be recomputed.
+    UFUNCTION(BlueprintCallable, Category = "Dish Customization|UI")
+    bool RecomputeInstance(int32 InstanceID);
+
+    // Per-unit aspects an instance would have (base + preparations + time/temperature), without touching the dish
+    UFUNCTION(BlueprintCallable, Category = "Dish Customization|UI")
+    bool CalculateInstanceAspects(const FIngredientInstance& Instance, FFlavorAspects& OutFlavor, FTextureAspects& OutTexture);
+
     // Function to set the dish customization component reference on the widget
     UFUNCTION(BlueprintCallable, Category = "Dish Customization|UI")
     void SetWidgetComponentReference(UPUDishCustomizationWidget* Widget);
@@ -65,6 +99,12 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Dish Customization|UI")
     void SetActiveCustomizationWidget(UPUDishCustomizationWidget* ActiveWidget);
 
+    // Stage widget of WidgetClass, reused if this component has shown that stage before (created otherwise)
+    UUserWidget* AcquireStageWidget(TSubclassOf<UUserWidget> WidgetClass);
+
+    // Take a stage widget off screen. It stays cached for the next AcquireStageWidget of its class.
+    void ReleaseStageWidget(UUserWidget* Widget);
+
     // Function to set the initial dish data from an order
     UFUNCTION(BlueprintCallable, Category = "Dish Customization|Orders")
     void SetInitialDishData(const FPUDishBase& InitialDishData);
@@ -147,6 +187,10 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "Dish Customization|Events")
     FOnInitialDishDataReceived OnInitialDishDataReceived;
 
+    // Per-instance changes to the current dish. Full snapshots (OnDishDataUpdated) only go out on stage transitions.
+    UPROPERTY(BlueprintAssignable, Category = "Dish Customization|Events")
+    FOnDishDelta OnDishDelta;
+
     UPROPERTY(BlueprintAssignable, Category = "Dish Customization|Events")
     FOnPlanningCompleted OnPlanningCompleted;
 
@@ -269,6 +313,27 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dish Customization|Data")
     FPUDishBase CurrentDishData;
 
+    // Sequence number of the last broadcast dish delta
+    int32 DishDeltaSequence = 0;
+
+    // Stamp a delta with the dish totals and sequence number, then broadcast it
+    void BroadcastDishDelta(FDishDelta& Delta);
+
+    // An instance's aspects before time/temperature (row + preparations), cached so slider edits skip the tables
+    struct FPUInstanceAspectBase
+    {
+        FGameplayTag IngredientTag;
+        FGameplayTagContainer Preparations;
+        FPUAspectVector BaseAspects;
+        TSharedPtr<const FPUTimeTempTable> TimeTempTable;
+    };
+
+    // InstanceID -> cached base (validated against the instance's tag and preparations on every lookup)
+    TMap<int32, FPUInstanceAspectBase> InstanceAspectBases;
+
+    const FPUInstanceAspectBase* FindOrBuildInstanceBase(const FIngredientInstance& Instance);
+    FPUAspectVector CalculateInstanceAspectVector(const FPUInstanceAspectBase& Base, float TimeValue, float TemperatureValue) const;
+
     // Planning data
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Planning Data")
     FPUPlanningData CurrentPlanningData;
@@ -292,6 +357,22 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dish Customization|Plating")
     FVector IngredientMeshScale = FVector(1.0f, 1.0f, 1.0f);
 
+    // Ingredient mesh actors spawned up front when plating starts (placements beyond this grow the pool)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dish Customization|Plating", meta = (ClampMin = "0"))
+    int32 IngredientMeshPoolPrewarmCount = 16;
+
+    // Draw plated pieces that have come to rest as instanced batches (one per mesh/material) instead of one actor each.
+    // A batched piece becomes a full actor again while it is grabbed.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dish Customization|Plating")
+    bool bUseInstancedPlatingRender = false;
+
+    // A piece counts as settled once it has moved slower than this (cm/s) for PlatingSettleTime seconds, or its body sleeps
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dish Customization|Plating", meta = (ClampMin = "0.0", EditCondition = "bUseInstancedPlatingRender"))
+    float PlatingSettleSpeed = 2.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dish Customization|Plating", meta = (ClampMin = "0.0", EditCondition = "bUseInstancedPlatingRender"))
+    float PlatingSettleTime = 0.5f;
+
     // Original dish container mesh (stored when customization starts)
     UPROPERTY()
     UStaticMesh* OriginalDishContainerMesh = nullptr;
@@ -308,6 +389,10 @@ protected:
     UPROPERTY()
     UPUDishCustomizationWidget* CookingStageWidget;
 
+    // One widget per stage class, kept across stage changes and customizations (their slot pools come along)
+    UPROPERTY(Transient)
+    TMap<TSubclassOf<UUserWidget>, UUserWidget*> StageWidgets;
+
     UPROPERTY()
     AProjectUmeowmiCharacter* CurrentCharacter;
 
@@ -329,6 +414,11 @@ protected:
     FVector DragStartMousePosition;
     FVector DragOffset; // Offset between mouse and ingredient when grabbed
 
+    // Drag plane, resolved once per drag (CacheDragPlane) so UpdateMouseDrag never searches the level
+    bool bHasDragPlane = false;
+    float DragPlaneHeight = 0.0f;
+    FVector DragStationLocation = FVector::ZeroVector;
+
     // Camera transition state
     bool bIsTransitioningCamera = false;
     float OriginalCameraDistance = 0.0f;
@@ -368,6 +458,23 @@ private:
     // Track spawned 3D ingredient meshes for cleanup
     TArray<class APUIngredientMesh*> SpawnedIngredientMeshes;
 
+    // Recycled ingredient mesh actors (SpawnedIngredientMeshes go back here on reset / end of plating)
+    UPROPERTY()
+    FPUIngredientMeshPool IngredientMeshPool;
+
+    // Settled plated pieces drawn instanced (bUseInstancedPlatingRender)
+    UPROPERTY()
+    FPUPlatedIngredientBatches PlatedIngredientBatches;
+
+    // How long each live piece has been below PlatingSettleSpeed
+    TMap<TObjectKey<APUIngredientMesh>, float> PlatingSettleTimers;
+
+    // Fold settled, idle pieces into the instanced batches
+    void UpdatePlatedIngredientBatching(float DeltaTime);
+
+    // Turn a batched piece under the cursor back into an actor (nullptr if the hit is not a batched piece)
+    class APUIngredientMesh* PromoteBatchedPiece(const FHitResult& Hit);
+
     // Plating camera transition state
     bool bPlatingCameraTransitioning = false;
     float PlatingCameraTransitionTime = 0.0f;
@@ -387,6 +494,7 @@ private:
     void HandleNextStage();
     void HandlePreviousStage();
     void UpdateMouseDrag();
+    void CacheDragPlane();
 
     // Camera handling
     void StartCameraTransition(bool bToCustomization);
@@ -431,4 +539,11 @@ private:
 
     // Store original dish container mesh
     void StoreOriginalDishContainerMesh();
+
+    // Stream in the unlocked ingredients' meshes, materials and prep tables plus the plating mesh while the
+    // camera moves in, so later stages resolve them without hitching. Kept resident until EndCustomization.
+    void StartCustomizationPreload();
+    void ReleaseCustomizationPreload();
+
+    TSharedPtr<struct FStreamableHandle> CustomizationPreloadHandle;
 }; 
\ No newline at end of file
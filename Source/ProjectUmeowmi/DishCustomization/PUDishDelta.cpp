@@ -0,0 +1,114 @@
+#include "PUDishDelta.h"
+#include "PUDishBase.h"
+
+FDishDelta FDishDelta::MakeForInstance(EPUDishDeltaType ChangeType, const FIngredientInstance& Instance, EPUDishDeltaField ChangedFields)
+{
+    FDishDelta Delta;
+    Delta.ChangeType = ChangeType;
+    Delta.InstanceID = Instance.InstanceID;
+    Delta.ChangedFields = static_cast<int32>(ChangedFields);
+    Delta.IngredientTag = Instance.IngredientTag;
+    Delta.Quantity = Instance.Quantity;
+    Delta.TimeValue = Instance.TimeValue;
+    Delta.TemperatureValue = Instance.TemperatureValue;
+    Delta.FlavorAspects = Instance.FlavorAspects;
+    Delta.TextureAspects = Instance.TextureAspects;
+    Delta.PlatingPosition = Instance.PlatingPosition;
+    Delta.PlatingRotation = Instance.PlatingRotation;
+    Delta.PlatingScale = Instance.PlatingScale;
+    Delta.bIsPlated = Instance.bIsPlated;
+
+    // Tag containers allocate, so only carry them when they changed
+    if (EnumHasAnyFlags(ChangedFields, EPUDishDeltaField::Preparations))
+    {
+        Delta.Preparations = Instance.Preparations;
+    }
+    return Delta;
+}
+
+EPUDishDeltaField FDishDelta::DiffInstances(const FIngredientInstance& OldInstance, const FIngredientInstance& NewInstance)
+{
+    EPUDishDeltaField Changed = EPUDishDeltaField::None;
+
+    if (OldInstance.Quantity != NewInstance.Quantity)
+    {
+        Changed |= EPUDishDeltaField::Quantity;
+    }
+    if (OldInstance.Preparations != NewInstance.Preparations)
+    {
+        Changed |= EPUDishDeltaField::Preparations;
+    }
+    if (OldInstance.TimeValue != NewInstance.TimeValue || OldInstance.TemperatureValue != NewInstance.TemperatureValue)
+    {
+        Changed |= EPUDishDeltaField::TimeTemperature;
+    }
+
+    const FPUAspectVector OldAspects = OldInstance.GetAspectVector();
+    const FPUAspectVector NewAspects = NewInstance.GetAspectVector();
+    if (FMemory::Memcmp(OldAspects.Lanes, NewAspects.Lanes, sizeof(OldAspects.Lanes)) != 0)
+    {
+        Changed |= EPUDishDeltaField::Aspects;
+    }
+
+    if (OldInstance.bIsPlated != NewInstance.bIsPlated
+        || !OldInstance.PlatingPosition.Equals(NewInstance.PlatingPosition, 0.0)
+        || !OldInstance.PlatingRotation.Equals(NewInstance.PlatingRotation, 0.0)
+        || !OldInstance.PlatingScale.Equals(NewInstance.PlatingScale, 0.0))
+    {
+        Changed |= EPUDishDeltaField::Plating;
+    }
+
+    return Changed;
+}
+
+void FDishDelta::ApplyTo(FPUDishBase& View, const FPUDishBase& Source) const
+{
+    const int32 ViewIndex = View.FindInstanceIndexByID(InstanceID);
+
+    if (ChangeType == EPUDishDeltaType::InstanceRemoved)
+    {
+        View.RemoveInstanceAt(ViewIndex);
+        return;
+    }
+
+    if (ViewIndex == INDEX_NONE)
+    {
+        // New to this view - take the full instance (ingredient data included) from the authoritative dish
+        const int32 SourceIndex = Source.FindInstanceIndexByID(InstanceID);
+        if (Source.IngredientInstances.IsValidIndex(SourceIndex))
+        {
+            View.AddInstance(Source.IngredientInstances[SourceIndex]);
+        }
+        return;
+    }
+
+    const EPUDishDeltaField Fields = static_cast<EPUDishDeltaField>(ChangedFields);
+    View.ModifyInstanceAt(ViewIndex, [this, Fields](FIngredientInstance& Instance)
+    {
+        if (EnumHasAnyFlags(Fields, EPUDishDeltaField::Quantity))
+        {
+            Instance.Quantity = Quantity;
+        }
+        if (EnumHasAnyFlags(Fields, EPUDishDeltaField::Preparations))
+        {
+            Instance.Preparations = Preparations;
+        }
+        if (EnumHasAnyFlags(Fields, EPUDishDeltaField::TimeTemperature))
+        {
+            Instance.TimeValue = TimeValue;
+            Instance.TemperatureValue = TemperatureValue;
+        }
+        if (EnumHasAnyFlags(Fields, EPUDishDeltaField::Aspects))
+        {
+            Instance.FlavorAspects = FlavorAspects;
+            Instance.TextureAspects = TextureAspects;
+        }
+        if (EnumHasAnyFlags(Fields, EPUDishDeltaField::Plating))
+        {
+            Instance.PlatingPosition = PlatingPosition;
+            Instance.PlatingRotation = PlatingRotation;
+            Instance.PlatingScale = PlatingScale;
+            Instance.bIsPlated = bIsPlated;
+        }
+    });
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "PUIngredientBase.h"
+#include "PUDishDelta.generated.h"
+
+struct FPUDishBase;
+struct FIngredientInstance;
+
+// What happened to the instance named by a dish delta
+UENUM(BlueprintType)
+enum class EPUDishDeltaType : uint8
+{
+    InstanceAdded     UMETA(DisplayName = "Instance Added"),
+    InstanceRemoved   UMETA(DisplayName = "Instance Removed"),
+    InstanceUpdated   UMETA(DisplayName = "Instance Updated")
+};
+
+// Which parts of an instance changed (bit flags, combined in FDishDelta::ChangedFields)
+UENUM(BlueprintType, meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "true"))
+enum class EPUDishDeltaField : uint8
+{
+    None             = 0 UMETA(Hidden),
+    Quantity         = 1 << 0,
+    Preparations     = 1 << 1,
+    TimeTemperature  = 1 << 2,
+    Aspects          = 1 << 3,
+    Plating          = 1 << 4
+};
+ENUM_CLASS_FLAGS(EPUDishDeltaField);
+
+// A single change to the authoritative dish, broadcast instead of a whole-dish snapshot.
+// Carries the instance's new mutable state plus the dish's new aspect totals, so listeners can patch
+// their views (and the radar chart can redraw) without copying the dish.
+USTRUCT(BlueprintType)
+struct PROJECTUMEOWMI_API FDishDelta
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Dish Delta")
+    EPUDishDeltaType ChangeType = EPUDishDeltaType::InstanceUpdated;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Dish Delta")
+    int32 InstanceID = 0;
+
+    // Increments with every delta the component broadcasts (lets listeners spot a missed delta)
+    UPROPERTY(BlueprintReadOnly, Category = "Dish Delta")
+    int32 Sequence = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Dish Delta", meta = (Bitmask, BitmaskEnum = "/Script/ProjectUmeowmi.EPUDishDeltaField"))
+    int32 ChangedFields = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Dish Delta", meta = (Categories = "Ingredient"))
+    FGameplayTag IngredientTag;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Dish Delta")
+    int32 Quantity = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Dish Delta", meta = (Categories = "Preparation"))
+    FGameplayTagContainer Preparations;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Dish Delta")
+    float TimeValue = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Dish Delta")
+    float TemperatureValue = 0.0f;
+
+    // New per-unit aspects of the instance
+    UPROPERTY(BlueprintReadOnly, Category = "Dish Delta")
+    FFlavorAspects FlavorAspects;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Dish Delta")
+    FTextureAspects TextureAspects;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Dish Delta")
+    FVector PlatingPosition = FVector::ZeroVector;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Dish Delta")
+    FRotator PlatingRotation = FRotator::ZeroRotator;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Dish Delta")
+    FVector PlatingScale = FVector::OneVector;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Dish Delta")
+    bool bIsPlated = false;
+
+    // Quantity-weighted dish totals after the change
+    UPROPERTY(BlueprintReadOnly, Category = "Dish Delta")
+    FFlavorAspects DishFlavorTotals;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Dish Delta")
+    FTextureAspects DishTextureTotals;
+
+    FORCEINLINE bool HasField(EPUDishDeltaField Field) const
+    {
+        return (ChangedFields & static_cast<int32>(Field)) != 0;
+    }
+
+    // Build a delta carrying the instance's current state
+    static FDishDelta MakeForInstance(EPUDishDeltaType ChangeType, const FIngredientInstance& Instance, EPUDishDeltaField ChangedFields);
+
+    // Which fields differ between two versions of the same instance
+    static EPUDishDeltaField DiffInstances(const FIngredientInstance& OldInstance, const FIngredientInstance& NewInstance);
+
+    // Patch a listener's copy of the dish. Instances the view does not have yet are copied from Source
+    // (the authoritative dish); everything else is patched field by field. Safe to apply twice.
+    void ApplyTo(FPUDishBase& View, const FPUDishBase& Source) const;
+};
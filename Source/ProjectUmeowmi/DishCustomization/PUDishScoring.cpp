@@ -0,0 +1,499 @@
+#include "PUDishScoring.h"
+#include "PUIngredientCatalogSubsystem.h"
+#include "PUPreparationRegistrySubsystem.h"
+#include "PUTimeTempTable.h"
+#include "Async/ParallelFor.h"
+#include "Engine/DataTable.h"
+
+// Debug output toggles (kept in code, but disabled by default to avoid log spam).
+namespace
+{
+    // Enables a summary log line for every prepared search space.
+    constexpr bool bPU_LogDishSearchPrepare = false;
+}
+
+namespace
+{
+    // Candidates scored per ParallelFor task (one unrank, then cheap in-order advances)
+    constexpr uint64 CandidatesPerBlock = 16384;
+
+    // Smaller blocks when sampling, so a capped sample is spread over more of the space
+    constexpr uint64 SamplesPerBlock = 1024;
+
+    // Keep index math well clear of uint64 overflow
+    constexpr uint64 MaxIndexableCandidates = 1ull << 62;
+
+    FORCEINLINE bool CheckedMultiply(uint64 A, uint64 B, uint64& Out)
+    {
+        if (A != 0 && B > MaxIndexableCandidates / A)
+        {
+            return false;
+        }
+        Out = A * B;
+        return true;
+    }
+
+    struct FRankedCandidate
+    {
+        float Score = 0.0f;
+        bool bValid = false;
+        uint64 CandidateIndex = 0;
+    };
+
+    // Higher score wins; equal scores keep enumeration order
+    FORCEINLINE bool IsBetter(const FRankedCandidate& A, const FRankedCandidate& B)
+    {
+        return A.Score > B.Score || (A.Score == B.Score && A.CandidateIndex < B.CandidateIndex);
+    }
+
+    // Heap predicate - the worst kept candidate sits at the top so it can be replaced cheaply
+    struct FWorseFirst
+    {
+        FORCEINLINE bool operator()(const FRankedCandidate& A, const FRankedCandidate& B) const
+        {
+            return IsBetter(B, A);
+        }
+    };
+
+    struct FBlockResult
+    {
+        TArray<FRankedCandidate> Best;
+        int64 NumEvaluated = 0;
+        int64 NumValid = 0;
+    };
+}
+
+bool FPUDishScoringEngine::Prepare(const FPUDishSearchSpace& InSpace, const UDataTable* IngredientDataTable)
+{
+    Space = InSpace;
+    Space.MinQuantity = FMath::Max(1, Space.MinQuantity);
+    Space.MaxQuantity = FMath::Max(Space.MinQuantity, Space.MaxQuantity);
+    Space.MaxIngredientsPerDish = FMath::Clamp(Space.MaxIngredientsPerDish, 1, MaxSlots);
+    Space.MaxCandidates = FMath::Max<int64>(1, Space.MaxCandidates);
+    Space.TopN = FMath::Max(1, Space.TopN);
+
+    IngredientTags.Reset();
+    PreparationTags.Reset();
+    Variants.Reset();
+    BinomialTable.Reset();
+    TotalCandidates = 0;
+    NumQuantities = Space.MaxQuantity - Space.MinQuantity + 1;
+
+    Space.Preparations.GetGameplayTagArray(PreparationTags);
+
+    const int32 NumTimeTempCells = Space.bIncludeTimeTemperature ? FPUTimeTempTable::NumTimeStates * FPUTimeTempTable::NumTemperatureStates : 1;
+
+    for (const FGameplayTag& IngredientTag : Space.Ingredients)
+    {
+        const FPUIngredientBase* Row = UPUIngredientCatalogSubsystem::ResolveIngredient(IngredientDataTable, IngredientTag);
+        if (!Row)
+        {
+            //UE_LOG(LogTemp,Warning, TEXT("⚠️ FPUDishScoringEngine::Prepare - Could not find ingredient '%s'"), *IngredientTag.ToString());
+            continue;
+        }
+
+        const int32 IngredientIndex = IngredientTags.Add(IngredientTag);
+        const int32 FirstVariant = Variants.Num();
+
+        // Fetch (or bake) the row's time/temp table here on the game thread, so Search never has to
+        const FPUTimeTempTable& TimeTempTable = Row->GetTimeTempTable();
+        const UDataTable* PreparationDataTable = UPUPreparationRegistrySubsystem::ResolvePreparationTable(Row->PreparationDataTable);
+
+        // Same compatibility input as the preparation menu: the ingredient's tag plus what the row already has applied
+        FGameplayTagContainer CompatibilityTags = Row->ActivePreparations;
+        CompatibilityTags.AddTag(IngredientTag);
+
+        for (int32 PreparationIndex = INDEX_NONE; PreparationIndex < PreparationTags.Num(); ++PreparationIndex)
+        {
+            FPUAspectVector Prepared = Row->GetAspectVector();
+            if (PreparationIndex != INDEX_NONE)
+            {
+                // Skip preparations the player couldn't apply to this ingredient (RequiredTags / IncompatibleTags)
+                const FPUPreparationBase* Preparation = UPUPreparationRegistrySubsystem::ResolvePreparation(PreparationDataTable, PreparationTags[PreparationIndex]);
+                if (!Preparation || !Preparation->CanApplyToIngredient(CompatibilityTags))
+                {
+                    continue;
+                }
+                UPUPreparationRegistrySubsystem::ApplyPreparations(PreparationDataTable, FGameplayTagContainer(PreparationTags[PreparationIndex]), Prepared);
+            }
+
+            for (int32 Cell = 0; Cell < NumTimeTempCells; ++Cell)
+            {
+                FPUAspectVector Aspects = Prepared;
+                TimeTempTable.Apply(static_cast<ETimeState>(Cell / FPUTimeTempTable::NumTemperatureStates),
+                    static_cast<ETemperatureState>(Cell % FPUTimeTempTable::NumTemperatureStates), Aspects);
+
+                // Drop variants that end up identical to one already kept for this ingredient
+                // (preparations or time/temp cells without modifiers) - they can only score the same
+                bool bDuplicate = false;
+                for (int32 Existing = FirstVariant; Existing < Variants.Num() && !bDuplicate; ++Existing)
+                {
+                    bDuplicate = FMemory::Memcmp(Variants[Existing].Aspects.Lanes, Aspects.Lanes, sizeof(Aspects.Lanes)) == 0;
+                }
+                if (bDuplicate)
+                {
+                    continue;
+                }
+
+                FVariant& Variant = Variants.AddDefaulted_GetRef();
+                Variant.Aspects = Aspects;
+                Variant.IngredientIndex = IngredientIndex;
+                Variant.PreparationIndex = PreparationIndex;
+                Variant.TimeTempCell = static_cast<uint8>(Cell);
+            }
+        }
+    }
+
+    const int32 NumVariants = Variants.Num();
+    if (NumVariants == 0)
+    {
+        return false;
+    }
+
+    // Pascal's triangle up to MaxSlots columns (saturates instead of wrapping)
+    BinomialTable.SetNumZeroed((NumVariants + 1) * (MaxSlots + 1));
+    for (int32 N = 0; N <= NumVariants; ++N)
+    {
+        BinomialTable[N * (MaxSlots + 1)] = 1;
+        for (int32 K = 1; K <= FMath::Min(N, MaxSlots); ++K)
+        {
+            const uint64 Sum = Binomial(N - 1, K - 1) + Binomial(N - 1, K);
+            BinomialTable[N * (MaxSlots + 1) + K] = FMath::Min(Sum, MaxIndexableCandidates);
+        }
+    }
+
+    const int32 MaxDishSlots = FMath::Min(Space.MaxIngredientsPerDish, NumVariants);
+    QuantityPowers[0] = 1;
+    SlotOffsets[1] = 0;
+    for (int32 NumSlots = 1; NumSlots <= MaxSlots; ++NumSlots)
+    {
+        QuantityPowers[NumSlots] = 0;
+        SlotOffsets[NumSlots + 1] = SlotOffsets[NumSlots];
+        if (NumSlots > MaxDishSlots)
+        {
+            continue;
+        }
+
+        uint64 NumWithSlots = 0;
+        if (!CheckedMultiply(QuantityPowers[NumSlots - 1], static_cast<uint64>(NumQuantities), QuantityPowers[NumSlots])
+            || !CheckedMultiply(Binomial(NumVariants, NumSlots), QuantityPowers[NumSlots], NumWithSlots)
+            || NumWithSlots > MaxIndexableCandidates - SlotOffsets[NumSlots])
+        {
+            //UE_LOG(LogTemp,Warning, TEXT("⚠️ FPUDishScoringEngine::Prepare - Search space too large to index (%d variants, %d slots) - narrow it"), NumVariants, NumSlots);
+            TotalCandidates = 0;
+            return false;
+        }
+        SlotOffsets[NumSlots + 1] = SlotOffsets[NumSlots] + NumWithSlots;
+    }
+    TotalCandidates = SlotOffsets[MaxDishSlots + 1];
+
+    if (bPU_LogDishSearchPrepare)
+    {
+        UE_LOG(LogTemp, Display, TEXT("FPUDishScoringEngine::Prepare - %d ingredients, %d variants, %llu candidate dishes"),
+            IngredientTags.Num(), NumVariants, TotalCandidates);
+    }
+
+    return true;
+}
+
+void FPUDishScoringEngine::Unrank(uint64 CandidateIndex, FCandidateCursor& OutCursor) const
+{
+    const int32 NumVariants = Variants.Num();
+
+    int32 NumSlots = 1;
+    while (NumSlots < MaxSlots && CandidateIndex >= SlotOffsets[NumSlots + 1])
+    {
+        ++NumSlots;
+    }
+    OutCursor.NumSlots = NumSlots;
+
+    const uint64 Rank = CandidateIndex - SlotOffsets[NumSlots];
+    uint64 CombinationRank = Rank / QuantityPowers[NumSlots];
+    uint64 QuantityRank = Rank % QuantityPowers[NumSlots];
+
+    // Variant combination in lexicographic order
+    int32 NextVariant = 0;
+    for (int32 Slot = 0; Slot < NumSlots; ++Slot)
+    {
+        for (;;)
+        {
+            const uint64 NumStartingHere = Binomial(NumVariants - NextVariant - 1, NumSlots - Slot - 1);
+            if (CombinationRank < NumStartingHere)
+            {
+                break;
+            }
+            CombinationRank -= NumStartingHere;
+            ++NextVariant;
+        }
+        OutCursor.VariantIndices[Slot] = NextVariant++;
+    }
+
+    // Quantities (last slot changes fastest)
+    for (int32 Slot = NumSlots - 1; Slot >= 0; --Slot)
+    {
+        OutCursor.Quantities[Slot] = Space.MinQuantity + static_cast<int32>(QuantityRank % NumQuantities);
+        QuantityRank /= NumQuantities;
+    }
+}
+
+bool FPUDishScoringEngine::Advance(FCandidateCursor& Cursor) const
+{
+    const int32 NumSlots = Cursor.NumSlots;
+
+    // Next quantity combination
+    for (int32 Slot = NumSlots - 1; Slot >= 0; --Slot)
+    {
+        if (++Cursor.Quantities[Slot] <= Space.MaxQuantity)
+        {
+            return true;
+        }
+        Cursor.Quantities[Slot] = Space.MinQuantity;
+    }
+
+    // Next variant combination
+    const int32 NumVariants = Variants.Num();
+    int32 Slot = NumSlots - 1;
+    while (Slot >= 0 && Cursor.VariantIndices[Slot] == NumVariants - NumSlots + Slot)
+    {
+        --Slot;
+    }
+    if (Slot >= 0)
+    {
+        ++Cursor.VariantIndices[Slot];
+        for (int32 Later = Slot + 1; Later < NumSlots; ++Later)
+        {
+            Cursor.VariantIndices[Later] = Cursor.VariantIndices[Later - 1] + 1;
+        }
+        return true;
+    }
+
+    // Next dish size
+    if (NumSlots >= FMath::Min(Space.MaxIngredientsPerDish, NumVariants))
+    {
+        return false;
+    }
+    Cursor.NumSlots = NumSlots + 1;
+    for (int32 NewSlot = 0; NewSlot < Cursor.NumSlots; ++NewSlot)
+    {
+        Cursor.VariantIndices[NewSlot] = NewSlot;
+        Cursor.Quantities[NewSlot] = Space.MinQuantity;
+    }
+    return true;
+}
+
+FPUDishSearchResult FPUDishScoringEngine::Search(const FPUOrderBase& Order) const
+{
+    FPUDishSearchResult Result;
+    Result.CandidateSpaceSize = static_cast<int64>(TotalCandidates);
+    if (TotalCandidates == 0)
+    {
+        return Result;
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    // Split the space into equal ranges, one block per range. When the space is bigger than MaxCandidates
+    // only the first CandidatesPerBlock of each range are scored, which samples the whole space evenly.
+    const uint64 NumToEvaluate = FMath::Min(TotalCandidates, static_cast<uint64>(Space.MaxCandidates));
+    const int32 NumBlocks = static_cast<int32>((NumToEvaluate + CandidatesPerBlock - 1) / CandidatesPerBlock);
+    const uint64 RangeSize = TotalCandidates / NumBlocks;
+    const uint64 RangeRemainder = TotalCandidates % NumBlocks;
+
+    const int32 FlavorIndex = Order.GetTargetFlavorIndex();
+    const int32 TopN = Space.TopN;
+
+    TArray<FBlockResult> BlockResults;
+    BlockResults.SetNum(NumBlocks);
+
+    ParallelFor(NumBlocks, [&](int32 BlockIndex)
+    {
+        const uint64 RangeStart = BlockIndex * RangeSize + FMath::Min(static_cast<uint64>(BlockIndex), RangeRemainder);
+        const uint64 RangeLength = RangeSize + (static_cast<uint64>(BlockIndex) < RangeRemainder ? 1 : 0);
+        const uint64 NumInBlock = FMath::Min(RangeLength, CandidatesPerBlock);
+
+        FBlockResult& Block = BlockResults[BlockIndex];
+        Block.Best.Reserve(TopN + 1);
+
+        FCandidateCursor Cursor;
+        Unrank(RangeStart, Cursor);
+
+        for (uint64 Offset = 0; Offset < NumInBlock; ++Offset)
+        {
+            // Quantity-weighted totals, same as FPUDishBase's running totals
+            FPUAspectVector Totals;
+            int32 TotalQuantity = 0;
+            for (int32 Slot = 0; Slot < Cursor.NumSlots; ++Slot)
+            {
+                Totals.AddScaled(Variants[Cursor.VariantIndices[Slot]].Aspects, static_cast<float>(Cursor.Quantities[Slot]));
+                TotalQuantity += Cursor.Quantities[Slot];
+            }
+
+            const float TargetFlavor = FlavorIndex != INDEX_NONE ? Totals[FlavorIndex] : 0.0f;
+
+            FRankedCandidate Candidate;
+            Candidate.Score = Order.GetSatisfactionScoreFromTotals(TotalQuantity, TargetFlavor);
+            Candidate.bValid = Order.ValidateTotals(TotalQuantity, TargetFlavor);
+            Candidate.CandidateIndex = RangeStart + Offset;
+            Block.NumValid += Candidate.bValid ? 1 : 0;
+
+            if (Block.Best.Num() < TopN)
+            {
+                Block.Best.HeapPush(Candidate, FWorseFirst());
+            }
+            else if (IsBetter(Candidate, Block.Best.HeapTop()))
+            {
+                Block.Best.HeapPopDiscard(FWorseFirst(), EAllowShrinking::No);
+                Block.Best.HeapPush(Candidate, FWorseFirst());
+            }
+
+            ++Block.NumEvaluated;
+            if (!Advance(Cursor))
+            {
+                break;
+            }
+        }
+    });
+
+    // Merge the per-block winners
+    TArray<FRankedCandidate> Best;
+    Best.Reserve(NumBlocks * TopN);
+    for (const FBlockResult& Block : BlockResults)
+    {
+        Best.Append(Block.Best);
+        Result.CandidatesEvaluated += Block.NumEvaluated;
+        Result.NumValid += Block.NumValid;
+    }
+    Best.Sort([](const FRankedCandidate& A, const FRankedCandidate& B) { return IsBetter(A, B); });
+
+    const int32 NumResults = FMath::Min(TopN, Best.Num());
+    Result.TopCandidates.Reserve(NumResults);
+    for (int32 ResultIndex = 0; ResultIndex < NumResults; ++ResultIndex)
+    {
+        Result.TopCandidates.Add(MakeResult(Best[ResultIndex].CandidateIndex, Best[ResultIndex].Score, Best[ResultIndex].bValid));
+    }
+
+    Result.ElapsedSeconds = static_cast<float>(FPlatformTime::Seconds() - StartTime);
+    return Result;
+}
+
+int64 FPUDishScoringEngine::SampleLaneTotals(int32 LaneIndex, int32 MinTotalQuantity, int64 MaxSamples, double Deadline, TArray<float>& OutTotals, uint64* OutBestCandidateIndex) const
+{
+    OutTotals.Reset();
+    if (TotalCandidates == 0 || LaneIndex < 0 || LaneIndex >= PUAspects::NumLanes)
+    {
+        return 0;
+    }
+
+    // Same even spread as Search, with smaller blocks
+    const uint64 NumToSample = FMath::Min(TotalCandidates, static_cast<uint64>(FMath::Max<int64>(1, MaxSamples)));
+    const int32 NumBlocks = static_cast<int32>((NumToSample + SamplesPerBlock - 1) / SamplesPerBlock);
+    const uint64 RangeSize = TotalCandidates / NumBlocks;
+    const uint64 RangeRemainder = TotalCandidates % NumBlocks;
+
+    TArray<TArray<float>> BlockTotals;
+    BlockTotals.SetNum(NumBlocks);
+    TArray<int64> BlockEvaluated;
+    BlockEvaluated.SetNumZeroed(NumBlocks);
+
+    // Highest kept total per block and the candidate it belongs to (for OutBestCandidateIndex)
+    TArray<float> BlockBestTotal;
+    BlockBestTotal.Init(TNumericLimits<float>::Lowest(), NumBlocks);
+    TArray<uint64> BlockBestIndex;
+    BlockBestIndex.Init(TNumericLimits<uint64>::Max(), NumBlocks);
+
+    ParallelFor(NumBlocks, [&](int32 BlockIndex)
+    {
+        if (FPlatformTime::Seconds() >= Deadline)
+        {
+            return;
+        }
+
+        const uint64 RangeStart = BlockIndex * RangeSize + FMath::Min(static_cast<uint64>(BlockIndex), RangeRemainder);
+        const uint64 RangeLength = RangeSize + (static_cast<uint64>(BlockIndex) < RangeRemainder ? 1 : 0);
+        const uint64 NumInBlock = FMath::Min(RangeLength, SamplesPerBlock);
+
+        TArray<float>& Totals = BlockTotals[BlockIndex];
+        Totals.Reserve(NumInBlock);
+
+        FCandidateCursor Cursor;
+        Unrank(RangeStart, Cursor);
+
+        for (uint64 Offset = 0; Offset < NumInBlock; ++Offset)
+        {
+            float LaneTotal = 0.0f;
+            int32 TotalQuantity = 0;
+            for (int32 Slot = 0; Slot < Cursor.NumSlots; ++Slot)
+            {
+                LaneTotal += Variants[Cursor.VariantIndices[Slot]].Aspects[LaneIndex] * static_cast<float>(Cursor.Quantities[Slot]);
+                TotalQuantity += Cursor.Quantities[Slot];
+            }
+
+            if (TotalQuantity >= MinTotalQuantity)
+            {
+                Totals.Add(LaneTotal);
+                if (LaneTotal > BlockBestTotal[BlockIndex])
+                {
+                    BlockBestTotal[BlockIndex] = LaneTotal;
+                    BlockBestIndex[BlockIndex] = RangeStart + Offset;
+                }
+            }
+
+            ++BlockEvaluated[BlockIndex];
+            if (!Advance(Cursor))
+            {
+                break;
+            }
+        }
+    });
+
+    int64 NumEvaluated = 0;
+    int32 NumKept = 0;
+    int32 BestBlock = INDEX_NONE;
+    for (int32 BlockIndex = 0; BlockIndex < NumBlocks; ++BlockIndex)
+    {
+        NumEvaluated += BlockEvaluated[BlockIndex];
+        NumKept += BlockTotals[BlockIndex].Num();
+        if (BlockTotals[BlockIndex].Num() > 0 && (BestBlock == INDEX_NONE || BlockBestTotal[BlockIndex] > BlockBestTotal[BestBlock]))
+        {
+            BestBlock = BlockIndex;
+        }
+    }
+
+    if (OutBestCandidateIndex)
+    {
+        *OutBestCandidateIndex = BestBlock != INDEX_NONE ? BlockBestIndex[BestBlock] : TNumericLimits<uint64>::Max();
+    }
+
+    OutTotals.Reserve(NumKept);
+    for (const TArray<float>& Totals : BlockTotals)
+    {
+        OutTotals.Append(Totals);
+    }
+    return NumEvaluated;
+}
+
+FPUScoredDishCandidate FPUDishScoringEngine::MakeResult(uint64 CandidateIndex, float Score, bool bValid) const
+{
+    FCandidateCursor Cursor;
+    Unrank(CandidateIndex, Cursor);
+
+    FPUScoredDishCandidate Candidate;
+    Candidate.SatisfactionScore = Score;
+    Candidate.bValid = bValid;
+    Candidate.Items.Reserve(Cursor.NumSlots);
+
+    for (int32 Slot = 0; Slot < Cursor.NumSlots; ++Slot)
+    {
+        const FVariant& Variant = Variants[Cursor.VariantIndices[Slot]];
+        FPUDishCandidateItem& Item = Candidate.Items.AddDefaulted_GetRef();
+        Item.IngredientTag = IngredientTags[Variant.IngredientIndex];
+        Item.PreparationTag = PreparationTags.IsValidIndex(Variant.PreparationIndex) ? PreparationTags[Variant.PreparationIndex] : FGameplayTag();
+
+        // Slider values that map back to the cell's states (0.0, 0.33, 0.66, 1.0)
+        Item.TimeValue = static_cast<float>(Variant.TimeTempCell / FPUTimeTempTable::NumTemperatureStates) / 3.0f;
+        Item.TemperatureValue = static_cast<float>(Variant.TimeTempCell % FPUTimeTempTable::NumTemperatureStates) / 3.0f;
+        Item.Quantity = Cursor.Quantities[Slot];
+    }
+
+    return Candidate;
+}
@@ -0,0 +1,181 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "PUAspectVector.h"
+#include "PUOrderBase.h"
+#include "PUDishScoring.generated.h"
+
+class UDataTable;
+
+// What to try when searching for dishes that satisfy an order
+USTRUCT(BlueprintType)
+struct PROJECTUMEOWMI_API FPUDishSearchSpace
+{
+    GENERATED_BODY()
+
+    // Unlocked ingredients the candidates can use
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dish Search", meta = (Categories = "Ingredient"))
+    TArray<FGameplayTag> Ingredients;
+
+    // Unlocked preparations. Each candidate ingredient uses none or one of these (only those it can take, per
+    // the preparation's RequiredTags / IncompatibleTags).
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dish Search", meta = (Categories = "Preparation"))
+    FGameplayTagContainer Preparations;
+
+    // Try every time/temperature state (otherwise ingredients stay raw)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dish Search")
+    bool bIncludeTimeTemperature = true;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dish Search", meta = (ClampMin = "1"))
+    int32 MinQuantity = 1;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dish Search", meta = (ClampMin = "1"))
+    int32 MaxQuantity = 3;
+
+    // Most ingredient instances in one candidate dish
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dish Search", meta = (ClampMin = "1", ClampMax = "6"))
+    int32 MaxIngredientsPerDish = 3;
+
+    // Upper bound on dishes scored. Larger spaces are sampled in evenly spaced contiguous blocks.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dish Search", meta = (ClampMin = "1"))
+    int64 MaxCandidates = 50000000;
+
+    // How many of the best dishes to return
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dish Search", meta = (ClampMin = "1"))
+    int32 TopN = 10;
+};
+
+// One ingredient instance of a candidate dish
+USTRUCT(BlueprintType)
+struct PROJECTUMEOWMI_API FPUDishCandidateItem
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Dish Search", meta = (Categories = "Ingredient"))
+    FGameplayTag IngredientTag;
+
+    // Empty if the ingredient is unprepared
+    UPROPERTY(BlueprintReadOnly, Category = "Dish Search", meta = (Categories = "Preparation"))
+    FGameplayTag PreparationTag;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Dish Search")
+    float TimeValue = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Dish Search")
+    float TemperatureValue = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Dish Search")
+    int32 Quantity = 1;
+};
+
+USTRUCT(BlueprintType)
+struct PROJECTUMEOWMI_API FPUScoredDishCandidate
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Dish Search")
+    float SatisfactionScore = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Dish Search")
+    bool bValid = false;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Dish Search")
+    TArray<FPUDishCandidateItem> Items;
+};
+
+USTRUCT(BlueprintType)
+struct PROJECTUMEOWMI_API FPUDishSearchResult
+{
+    GENERATED_BODY()
+
+    // Best candidates, highest score first (ties keep enumeration order)
+    UPROPERTY(BlueprintReadOnly, Category = "Dish Search")
+    TArray<FPUScoredDishCandidate> TopCandidates;
+
+    // Size of the whole candidate space (may be larger than CandidatesEvaluated)
+    UPROPERTY(BlueprintReadOnly, Category = "Dish Search")
+    int64 CandidateSpaceSize = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Dish Search")
+    int64 CandidatesEvaluated = 0;
+
+    // How many evaluated candidates pass ValidateDish
+    UPROPERTY(BlueprintReadOnly, Category = "Dish Search")
+    int64 NumValid = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Dish Search")
+    float ElapsedSeconds = 0.0f;
+};
+
+/**
+ * Headless batch dish scorer - enumerates candidate dishes from a search space and scores them against an order.
+ *
+ * Prepare() runs on the game thread: it resolves every (ingredient, preparation, time/temp state) variant through
+ * the catalog, the compiled preparations and the baked time/temp tables, and stores its per-unit aspect vector.
+ * Search() then never touches a data table - candidates are unranked from an index, summed with vector ops and
+ * scored in parallel, so it can run on any thread and reuse one prepared space for many orders.
+ */
+class PROJECTUMEOWMI_API FPUDishScoringEngine
+{
+public:
+    // Bake the variants for a search space. Returns false if no ingredient could be resolved or the space is too big to index.
+    bool Prepare(const FPUDishSearchSpace& InSpace, const UDataTable* IngredientDataTable);
+
+    // Score candidates against the order and return the best ones
+    FPUDishSearchResult Search(const FPUOrderBase& Order) const;
+
+    // Sample the dish totals of one aspect lane across the space (evenly spaced blocks, in parallel), keeping only
+    // candidates with at least MinTotalQuantity units. Blocks that start after Deadline (FPlatformTime::Seconds) are
+    // skipped. Returns how many candidates were looked at; every value in OutTotals belongs to a real candidate.
+    // OutBestCandidateIndex (optional) receives the kept candidate with the highest total.
+    int64 SampleLaneTotals(int32 LaneIndex, int32 MinTotalQuantity, int64 MaxSamples, double Deadline, TArray<float>& OutTotals, uint64* OutBestCandidateIndex = nullptr) const;
+
+    // The ingredient instances of one candidate (index as returned by SampleLaneTotals)
+    TArray<FPUDishCandidateItem> GetCandidateItems(uint64 CandidateIndex) const { return MakeResult(CandidateIndex, 0.0f, false).Items; }
+
+    // Total number of candidate dishes in the prepared space
+    int64 GetCandidateSpaceSize() const { return static_cast<int64>(TotalCandidates); }
+
+    int32 GetNumVariants() const { return Variants.Num(); }
+
+private:
+    static constexpr int32 MaxSlots = 6;
+
+    // One ingredient in one preparation and time/temp state (per-unit aspects, fully baked)
+    struct FVariant
+    {
+        FPUAspectVector Aspects;
+        int32 IngredientIndex = INDEX_NONE;
+        int32 PreparationIndex = INDEX_NONE;
+        uint8 TimeTempCell = 0;
+    };
+
+    // A decoded candidate: NumSlots strictly increasing variant indices, each with a quantity
+    struct FCandidateCursor
+    {
+        int32 NumSlots = 0;
+        int32 VariantIndices[MaxSlots] = {};
+        int32 Quantities[MaxSlots] = {};
+    };
+
+    void Unrank(uint64 CandidateIndex, FCandidateCursor& OutCursor) const;
+    bool Advance(FCandidateCursor& Cursor) const;
+    uint64 Binomial(int32 N, int32 K) const { return BinomialTable[N * (MaxSlots + 1) + K]; }
+
+    FPUScoredDishCandidate MakeResult(uint64 CandidateIndex, float Score, bool bValid) const;
+
+    FPUDishSearchSpace Space;
+    TArray<FGameplayTag> IngredientTags;
+    TArray<FGameplayTag> PreparationTags;
+    TArray<FVariant> Variants;
+
+    // C(n, k) for n <= Variants.Num(), k <= MaxSlots
+    TArray<uint64> BinomialTable;
+
+    // Candidates with k slots start at SlotOffsets[k] (index 0 unused)
+    uint64 SlotOffsets[MaxSlots + 2] = {};
+    uint64 QuantityPowers[MaxSlots + 1] = {};
+    uint64 TotalCandidates = 0;
+    int32 NumQuantities = 0;
+};
@@ -2,6 +2,8 @@
 #include "Engine/DataTable.h"
 #include "GameplayTagsManager.h"
 #include "PUPreparationBase.h"
+#include "PUPreparationRegistrySubsystem.h"
+#include "PUTimeTempTable.h"
 
 FPUIngredientBase::FPUIngredientBase()
     : IngredientName(NAME_None)
@@ -17,88 +19,87 @@ FPUIngredientBase::FPUIngredientBase()
 {
 }
 
-float FPUIngredientBase::GetFlavorAspect(const FName& AspectName) const
+static_assert(sizeof(FFlavorAspects) == PUAspects::NumFlavorLanes * sizeof(float), "FFlavorAspects must stay a packed block of flavor lanes");
+static_assert(sizeof(FTextureAspects) == PUAspects::NumTextureLanes * sizeof(float), "FTextureAspects must stay a packed block of texture lanes");
+
+namespace
 {
-    FString AspectStr = AspectName.ToString().ToLower();
-    
-    if (AspectStr == TEXT("umami"))
-        return FlavorAspects.Umami;
-    else if (AspectStr == TEXT("sweet"))
-        return FlavorAspects.Sweet;
-    else if (AspectStr == TEXT("salt"))
-        return FlavorAspects.Salt;
-    else if (AspectStr == TEXT("sour"))
-        return FlavorAspects.Sour;
-    else if (AspectStr == TEXT("bitter"))
-        return FlavorAspects.Bitter;
-    else if (AspectStr == TEXT("spicy"))
-        return FlavorAspects.Spicy;
-    
+    // Clamp value to 0.0-5.0 range and round to nearest 0.5 increment
+    FORCEINLINE float ClampAndRoundAspectValue(float Value)
+    {
+        Value = FMath::Clamp(Value, 0.0f, 5.0f);
+        return FMath::RoundToFloat(Value * 2.0f) / 2.0f; // Round to nearest 0.5
+    }
+}
+
+FPUAspectVector FPUIngredientBase::PackAspects(const FFlavorAspects& Flavor, const FTextureAspects& Texture)
+{
+    // Lane order matches member order (Umami..Spicy, Rich..Crumbly), so this is two straight copies
+    FPUAspectVector Result;
+    FMemory::Memcpy(&Result.Lanes[0], &Flavor, sizeof(FFlavorAspects));
+    FMemory::Memcpy(&Result.Lanes[PUAspects::NumFlavorLanes], &Texture, sizeof(FTextureAspects));
+    return Result;
+}
+
+void FPUIngredientBase::UnpackAspects(const FPUAspectVector& Aspects, FFlavorAspects& OutFlavor, FTextureAspects& OutTexture)
+{
+    FMemory::Memcpy(&OutFlavor, &Aspects.Lanes[0], sizeof(FFlavorAspects));
+    FMemory::Memcpy(&OutTexture, &Aspects.Lanes[PUAspects::NumFlavorLanes], sizeof(FTextureAspects));
+}
+
+FPUAspectVector FPUIngredientBase::GetAspectVector() const
+{
+    return PackAspects(FlavorAspects, TextureAspects);
+}
+
+void FPUIngredientBase::SetAspectVector(const FPUAspectVector& Aspects)
+{
+    UnpackAspects(Aspects, FlavorAspects, TextureAspects);
+}
+
+float FPUIngredientBase::GetAspectByIndex(int32 AspectIndex) const
+{
+    if (PUAspects::IsFlavorIndex(AspectIndex))
+    {
+        return reinterpret_cast<const float*>(&FlavorAspects)[AspectIndex];
+    }
+    if (PUAspects::IsTextureIndex(AspectIndex))
+    {
+        return reinterpret_cast<const float*>(&TextureAspects)[AspectIndex - PUAspects::NumFlavorLanes];
+    }
     return 0.0f;
 }
 
+void FPUIngredientBase::SetAspectByIndex(int32 AspectIndex, float Value)
+{
+    if (PUAspects::IsFlavorIndex(AspectIndex))
+    {
+        reinterpret_cast<float*>(&FlavorAspects)[AspectIndex] = ClampAndRoundAspectValue(Value);
+    }
+    else if (PUAspects::IsTextureIndex(AspectIndex))
+    {
+        reinterpret_cast<float*>(&TextureAspects)[AspectIndex - PUAspects::NumFlavorLanes] = ClampAndRoundAspectValue(Value);
+    }
+}
+
+float FPUIngredientBase::GetFlavorAspect(const FName& AspectName) const
+{
+    return GetAspectByIndex(PUAspects::ResolveFlavorIndex(AspectName));
+}
+
 float FPUIngredientBase::GetTextureAspect(const FName& AspectName) const
 {
-    FString AspectStr = AspectName.ToString().ToLower();
-    
-    if (AspectStr == TEXT("rich"))
-        return TextureAspects.Rich;
-    else if (AspectStr == TEXT("juicy"))
-        return TextureAspects.Juicy;
-    else if (AspectStr == TEXT("tender"))
-        return TextureAspects.Tender;
-    else if (AspectStr == TEXT("chewy"))
-        return TextureAspects.Chewy;
-    else if (AspectStr == TEXT("crispy"))
-        return TextureAspects.Crispy;
-    else if (AspectStr == TEXT("crumbly"))
-        return TextureAspects.Crumbly;
-    
-    return 0.0f;
+    return GetAspectByIndex(PUAspects::ResolveTextureIndex(AspectName));
 }
 
 void FPUIngredientBase::SetFlavorAspect(const FName& AspectName, float Value)
 {
-    // Clamp value to 0.0-5.0 range and round to nearest 0.5 increment
-    Value = FMath::Clamp(Value, 0.0f, 5.0f);
-    Value = FMath::RoundToFloat(Value * 2.0f) / 2.0f; // Round to nearest 0.5
-    
-    FString AspectStr = AspectName.ToString().ToLower();
-    
-    if (AspectStr == TEXT("umami"))
-        FlavorAspects.Umami = Value;
-    else if (AspectStr == TEXT("sweet"))
-        FlavorAspects.Sweet = Value;
-    else if (AspectStr == TEXT("salt"))
-        FlavorAspects.Salt = Value;
-    else if (AspectStr == TEXT("sour"))
-        FlavorAspects.Sour = Value;
-    else if (AspectStr == TEXT("bitter"))
-        FlavorAspects.Bitter = Value;
-    else if (AspectStr == TEXT("spicy"))
-        FlavorAspects.Spicy = Value;
+    SetAspectByIndex(PUAspects::ResolveFlavorIndex(AspectName), Value);
 }
 
 void FPUIngredientBase::SetTextureAspect(const FName& AspectName, float Value)
 {
-    // Clamp value to 0.0-5.0 range and round to nearest 0.5 increment
-    Value = FMath::Clamp(Value, 0.0f, 5.0f);
-    Value = FMath::RoundToFloat(Value * 2.0f) / 2.0f; // Round to nearest 0.5
-    
-    FString AspectStr = AspectName.ToString().ToLower();
-    
-    if (AspectStr == TEXT("rich"))
-        TextureAspects.Rich = Value;
-    else if (AspectStr == TEXT("juicy"))
-        TextureAspects.Juicy = Value;
-    else if (AspectStr == TEXT("tender"))
-        TextureAspects.Tender = Value;
-    else if (AspectStr == TEXT("chewy"))
-        TextureAspects.Chewy = Value;
-    else if (AspectStr == TEXT("crispy"))
-        TextureAspects.Crispy = Value;
-    else if (AspectStr == TEXT("crumbly"))
-        TextureAspects.Crumbly = Value;
+    SetAspectByIndex(PUAspects::ResolveTextureIndex(AspectName), Value);
 }
 
 float FPUIngredientBase::GetTotalFlavorValue() const
@@ -164,16 +165,21 @@ bool FPUIngredientBase::HasPreparation(const FGameplayTag& PreparationTag) const
 }
 
 FText FPUIngredientBase::GetCurrentDisplayName() const
+{
+    return GetDisplayNameWithPreparations(ActivePreparations);
+}
+
+FText FPUIngredientBase::GetDisplayNameWithPreparations(const FGameplayTagContainer& Preparations) const
 {
     // If we have active preparations, try to get a modified name
-    if (ActivePreparations.Num() > 0 && PreparationDataTable.IsValid())
+    if (Preparations.Num() > 0 && PreparationDataTable.IsValid())
     {
         UDataTable* LoadedPreparationDataTable = PreparationDataTable.LoadSynchronous();
         if (LoadedPreparationDataTable)
         {
             // Get all preparation tags
             TArray<FGameplayTag> PrepTags;
-            ActivePreparations.GetGameplayTagArray(PrepTags);
+            Preparations.GetGameplayTagArray(PrepTags);
             
             if (PrepTags.Num() > 0)
             {
@@ -193,62 +199,53 @@ FText FPUIngredientBase::GetCurrentDisplayName() const
                 // Process all preparations to combine their prefixes and suffixes
                 for (const FGameplayTag& PrepTag : PrepTags)
                 {
-                    // Get the preparation name from the tag (everything after the last period) and convert to lowercase
-                    FString PrepFullTag = PrepTag.ToString();
-                    int32 PrepLastPeriodIndex;
-                    if (PrepFullTag.FindLastChar('.', PrepLastPeriodIndex))
+                    ////UE_LOG(LogTemp,Display, TEXT("🔍 FPUIngredientBase::GetCurrentDisplayName - Looking up preparation: Tag=%s"), *PrepTag.ToString());
+                    
+                    if (const FPUPreparationBase* Preparation = UPUPreparationRegistrySubsystem::ResolvePreparation(LoadedPreparationDataTable, PrepTag))
                     {
-                        FString PrepName = PrepFullTag.RightChop(PrepLastPeriodIndex + 1).ToLower();
-                        FName PrepRowName = FName(*PrepName);
+                        //UE_LOG(LogTemp,Display, TEXT("🔍 FPUIngredientBase::GetCurrentDisplayName - Found preparation: DisplayName=%s, NamePrefix=%s, NameSuffix=%s"), 
+                        //    *Preparation->DisplayName.ToString(), 
+                        //    *Preparation->NamePrefix.ToString(), 
+                        //    *Preparation->NameSuffix.ToString());
                         
-                        ////UE_LOG(LogTemp,Display, TEXT("🔍 FPUIngredientBase::GetCurrentDisplayName - Looking up preparation: Tag=%s, RowName=%s"), *PrepFullTag, *PrepRowName.ToString());
+                        // If any preparation overrides the base name, use the special name
+                        if (Preparation->OverridesBaseName)
+                        {
+                            SpecialOverrideName = Preparation->SpecialName.ToString();
+                            bHasSpecialOverride = true;
+                            ////UE_LOG(LogTemp,Display, TEXT("🔍 FPUIngredientBase::GetCurrentDisplayName - Preparation overrides base name with: %s"), 
+                            //    *SpecialOverrideName);
+                            break; // Special override takes precedence, stop processing
+                        }
                         
-                        if (FPUPreparationBase* Preparation = LoadedPreparationDataTable->FindRow<FPUPreparationBase>(PrepRowName, TEXT("GetCurrentDisplayName")))
+                        // Combine prefixes and suffixes
+                        if (!Preparation->NamePrefix.IsEmpty())
                         {
-                            //UE_LOG(LogTemp,Display, TEXT("🔍 FPUIngredientBase::GetCurrentDisplayName - Found preparation: DisplayName=%s, NamePrefix=%s, NameSuffix=%s"), 
-                            //    *Preparation->DisplayName.ToString(), 
-                            //    *Preparation->NamePrefix.ToString(), 
-                            //    *Preparation->NameSuffix.ToString());
-                            
-                            // If any preparation overrides the base name, use the special name
-                            if (Preparation->OverridesBaseName)
-                            {
-                                SpecialOverrideName = Preparation->SpecialName.ToString();
-                                bHasSpecialOverride = true;
-                                ////UE_LOG(LogTemp,Display, TEXT("🔍 FPUIngredientBase::GetCurrentDisplayName - Preparation overrides base name with: %s"), 
-                                //    *SpecialOverrideName);
-                                break; // Special override takes precedence, stop processing
-                            }
-                            
-                            // Combine prefixes and suffixes
-                            if (!Preparation->NamePrefix.IsEmpty())
-                            {
-                                if (!CombinedPrefix.IsEmpty())
-                                {
-                                    CombinedPrefix += " ";
-                                }
-                                CombinedPrefix += Preparation->NamePrefix.ToString();
-                                ////UE_LOG(LogTemp,Display, TEXT("🔍 FPUIngredientBase::GetCurrentDisplayName - Added prefix '%s', CombinedPrefix now: '%s'"), 
-                                //    *Preparation->NamePrefix.ToString(), *CombinedPrefix);
-                            }
-                            
-                            if (!Preparation->NameSuffix.IsEmpty())
+                            if (!CombinedPrefix.IsEmpty())
                             {
-                                if (!CombinedSuffix.IsEmpty())
-                                {
-                                    CombinedSuffix = " " + CombinedSuffix;
-                                }
-                                CombinedSuffix = Preparation->NameSuffix.ToString() + CombinedSuffix;
-                                ////UE_LOG(LogTemp,Display, TEXT("🔍 FPUIngredientBase::GetCurrentDisplayName - Added suffix '%s', CombinedSuffix now: '%s'"), 
-                                //    *Preparation->NameSuffix.ToString(), *CombinedSuffix);
+                                CombinedPrefix += " ";
                             }
+                            CombinedPrefix += Preparation->NamePrefix.ToString();
+                            ////UE_LOG(LogTemp,Display, TEXT("🔍 FPUIngredientBase::GetCurrentDisplayName - Added prefix '%s', CombinedPrefix now: '%s'"), 
+                            //    *Preparation->NamePrefix.ToString(), *CombinedPrefix);
                         }
-                        else
+                        
+                        if (!Preparation->NameSuffix.IsEmpty())
                         {
-                            ////UE_LOG(LogTemp,Warning, TEXT("⚠️ FPUIngredientBase::GetCurrentDisplayName - Could not find preparation row '%s' in data table!"), 
-                            //    *PrepRowName.ToString());
+                            if (!CombinedSuffix.IsEmpty())
+                            {
+                                CombinedSuffix = " " + CombinedSuffix;
+                            }
+                            CombinedSuffix = Preparation->NameSuffix.ToString() + CombinedSuffix;
+                            ////UE_LOG(LogTemp,Display, TEXT("🔍 FPUIngredientBase::GetCurrentDisplayName - Added suffix '%s', CombinedSuffix now: '%s'"), 
+                            //    *Preparation->NameSuffix.ToString(), *CombinedSuffix);
                         }
                     }
+                    else
+                    {
+                        ////UE_LOG(LogTemp,Warning, TEXT("⚠️ FPUIngredientBase::GetCurrentDisplayName - Could not find preparation row '%s' in data table!"), 
+                        //    *PrepTag.ToString());
+                    }
                 }
                 
                 // Return the appropriate modified name
@@ -310,7 +307,7 @@ ETemperatureState FPUIngredientBase::MapTemperatureValueToState(float Temperatur
 
 // Get default time/temperature modifiers (universal rules)
 // These are applied when an ingredient doesn't have custom modifiers
-static TArray<FTimeTempModifier> GetDefaultTimeTempModifiers()
+TArray<FTimeTempModifier> FPUIngredientBase::GetDefaultTimeTempModifiers()
 {
     TArray<FTimeTempModifier> DefaultModifiers;
     
@@ -368,147 +365,99 @@ static TArray<FTimeTempModifier> GetDefaultTimeTempModifiers()
     return DefaultModifiers;
 }
 
-// Calculate modified aspects based on time and temperature
-void FPUIngredientBase::CalculateTimeTempModifiedAspects(float TimeValue, float TemperatureValue, FFlavorAspects& OutFlavor, FTextureAspects& OutTexture) const
+const FPUTimeTempTable& FPUIngredientBase::GetTimeTempTable() const
+{
+    // Setters invalidate explicitly. The flag and count check is O(1) and only catches Blueprint writes that bypass
+    // them (toggling custom modifiers, adding or removing one); values edited in place need InvalidateTimeTempTable.
+    const bool bCustom = bUseCustomTimeTempModifiers && TimeTemperatureModifiers.Num() > 0;
+    if (!TimeTempTable.IsValid() || TimeTempTable->bCustom != bCustom
+        || (bCustom && TimeTempTable->NumSourceModifiers != TimeTemperatureModifiers.Num()))
+    {
+        checkf(IsInGameThread(), TEXT("FPUIngredientBase::GetTimeTempTable - %s needs a rebake off the game thread; fetch the table on the game thread first"),
+            *IngredientTag.ToString());
+        BakeTimeTempTable();
+    }
+
+    return *TimeTempTable;
+}
+
+void FPUIngredientBase::BakeTimeTempTable() const
 {
-    // Start with base aspects (already includes preparations)
-    OutFlavor = FlavorAspects;
-    OutTexture = TextureAspects;
-    
-    // Map slider values to discrete states
-    ETimeState TimeState = MapTimeValueToState(TimeValue);
-    ETemperatureState TempState = MapTemperatureValueToState(TemperatureValue);
-    
-    // Get modifiers to apply (either custom or default)
-    TArray<FTimeTempModifier> ModifiersToApply;
-    
     if (bUseCustomTimeTempModifiers && TimeTemperatureModifiers.Num() > 0)
     {
         // Use custom modifiers for this ingredient
-        ModifiersToApply = TimeTemperatureModifiers;
+        TimeTempTable = FPUTimeTempTable::Bake(TimeTemperatureModifiers, true);
     }
     else
     {
         // Use default universal rules
-        ModifiersToApply = GetDefaultTimeTempModifiers();
+        TimeTempTable = FPUTimeTempTable::GetDefault();
     }
-    
-    // Apply modifiers that match the current time/temp state
-    ////UE_LOG(LogTemp,Display, TEXT("🔍 FPUIngredientBase::CalculateTimeTempModifiedAspects - TimeState: %d, TempState: %d, Checking %d modifiers"),
-    //    (int32)TimeState, (int32)TempState, ModifiersToApply.Num());
-    
-    for (const FTimeTempModifier& Modifier : ModifiersToApply)
+}
+
+void FPUIngredientBase::SetTimeTemperatureModifiers(const TArray<FTimeTempModifier>& Modifiers)
+{
+    TimeTemperatureModifiers = Modifiers;
+    InvalidateTimeTempTable();
+}
+
+void FPUIngredientBase::SetUseCustomTimeTempModifiers(bool bUseCustom)
+{
+    bUseCustomTimeTempModifiers = bUseCustom;
+    InvalidateTimeTempTable();
+}
+
+void FPUIngredientBase::OnDataTableChanged(const UDataTable* InDataTable, const FName InRowName)
+{
+    Super::OnDataTableChanged(InDataTable, InRowName);
+    BakeTimeTempTable();
+}
+
+TSharedRef<const FPUTimeTempTable> FPUIngredientBase::GetSharedTimeTempTable() const
+{
+    GetTimeTempTable();
+    return TimeTempTable.ToSharedRef();
+}
+
+SIZE_T FPUIngredientBase::GetAllocatedSize() const
+{
+    SIZE_T Bytes = DefaultPlacementPositions.GetAllocatedSize()
+        + DefaultPlacementRotations.GetAllocatedSize()
+        + TimeTemperatureModifiers.GetAllocatedSize()
+        + QuantitySpecialEffects.GetAllocatedSize()
+        + ActivePreparations.Num() * sizeof(FGameplayTag);
+
+    for (const TPair<int32, FGameplayTagContainer>& Pair : QuantitySpecialEffects)
     {
-        // Match exact states (for "any" state behavior, add multiple modifiers)
-        bool bTimeMatches = (Modifier.TimeState == TimeState);
-        bool bTempMatches = (Modifier.TemperatureState == TempState);
-        
-        ////UE_LOG(LogTemp,Display, TEXT("🔍   Modifier: Time=%d (match: %s), Temp=%d (match: %s), Aspect=%s, Value=%.2f"),
-        //    (int32)Modifier.TimeState, bTimeMatches ? TEXT("YES") : TEXT("NO"),
-        //    (int32)Modifier.TemperatureState, bTempMatches ? TEXT("YES") : TEXT("NO"),
-        //    *Modifier.AspectName.ToString(), Modifier.ModificationValue);
-        
-        if (bTimeMatches && bTempMatches)
-        {
-            FString AspectStr = Modifier.AspectName.ToString().ToLower();
-            float CurrentValue = 0.0f;
-            bool bFound = false;
-            
-            // Get current aspect value from OutFlavor/OutTexture structs directly (allows chaining modifiers)
-            if (Modifier.AspectType == 0) // Flavor
-            {
-                if (AspectStr == TEXT("umami"))
-                    CurrentValue = OutFlavor.Umami;
-                else if (AspectStr == TEXT("sweet"))
-                    CurrentValue = OutFlavor.Sweet;
-                else if (AspectStr == TEXT("salt"))
-                    CurrentValue = OutFlavor.Salt;
-                else if (AspectStr == TEXT("sour"))
-                    CurrentValue = OutFlavor.Sour;
-                else if (AspectStr == TEXT("bitter"))
-                    CurrentValue = OutFlavor.Bitter;
-                else if (AspectStr == TEXT("spicy"))
-                    CurrentValue = OutFlavor.Spicy;
-                bFound = true;
-            }
-            else if (Modifier.AspectType == 1) // Texture
-            {
-                if (AspectStr == TEXT("rich"))
-                    CurrentValue = OutTexture.Rich;
-                else if (AspectStr == TEXT("juicy"))
-                    CurrentValue = OutTexture.Juicy;
-                else if (AspectStr == TEXT("tender"))
-                    CurrentValue = OutTexture.Tender;
-                else if (AspectStr == TEXT("chewy"))
-                    CurrentValue = OutTexture.Chewy;
-                else if (AspectStr == TEXT("crispy"))
-                    CurrentValue = OutTexture.Crispy;
-                else if (AspectStr == TEXT("crumbly"))
-                    CurrentValue = OutTexture.Crumbly;
-                bFound = true;
-            }
-            
-            if (bFound)
-            {
-                ////UE_LOG(LogTemp,Display, TEXT("🔍   Applying modifier: Current=%f, Modifier=%f, Type=%d"),
-                //    CurrentValue, Modifier.ModificationValue, (int32)Modifier.ModificationType);
-                
-                // Apply modification
-                float ModifiedValue = CurrentValue;
-                if (Modifier.ModificationType == 0) // Additive
-                {
-                    ModifiedValue = CurrentValue + Modifier.ModificationValue;
-                }
-                else if (Modifier.ModificationType == 1) // Multiplicative
-                {
-                    ModifiedValue = CurrentValue * Modifier.ModificationValue;
-                }
-                
-                ////UE_LOG(LogTemp,Display, TEXT("🔍   After modification: %f"), ModifiedValue);
-                
-                // Only clamp minimum to 0 (allow values above 5.0 for visibility on radar chart)
-                // Round to 0.5 increments
-                ModifiedValue = FMath::Max(ModifiedValue, 0.0f);
-                ModifiedValue = FMath::RoundToFloat(ModifiedValue * 2.0f) / 2.0f;
-                
-                ////UE_LOG(LogTemp,Display, TEXT("🔍   After rounding: %f"), ModifiedValue);
-                
-                // Set the modified value directly in output (don't modify const object)
-                if (Modifier.AspectType == 0) // Flavor
-                {
-                    if (AspectStr == TEXT("umami"))
-                        OutFlavor.Umami = ModifiedValue;
-                    else if (AspectStr == TEXT("sweet"))
-                        OutFlavor.Sweet = ModifiedValue;
-                    else if (AspectStr == TEXT("salt"))
-                        OutFlavor.Salt = ModifiedValue;
-                    else if (AspectStr == TEXT("sour"))
-                        OutFlavor.Sour = ModifiedValue;
-                    else if (AspectStr == TEXT("bitter"))
-                        OutFlavor.Bitter = ModifiedValue;
-                    else if (AspectStr == TEXT("spicy"))
-                        OutFlavor.Spicy = ModifiedValue;
-                }
-                else if (Modifier.AspectType == 1) // Texture
-                {
-                    if (AspectStr == TEXT("rich"))
-                        OutTexture.Rich = ModifiedValue;
-                    else if (AspectStr == TEXT("juicy"))
-                        OutTexture.Juicy = ModifiedValue;
-                    else if (AspectStr == TEXT("tender"))
-                        OutTexture.Tender = ModifiedValue;
-                    else if (AspectStr == TEXT("chewy"))
-                        OutTexture.Chewy = ModifiedValue;
-                    else if (AspectStr == TEXT("crispy"))
-                        OutTexture.Crispy = ModifiedValue;
-                    else if (AspectStr == TEXT("crumbly"))
-                        OutTexture.Crumbly = ModifiedValue;
-                }
-            }
-        }
+        Bytes += Pair.Value.Num() * sizeof(FGameplayTag);
+    }
+    return Bytes;
+}
+
+void FPUIngredientBase::PostSerialize(const FArchive& Ar)
+{
+    if (Ar.IsLoading())
+    {
+        // Bake at load time so slider changes never have to. Called directly (no game thread check): this copy is
+        // still being loaded, possibly on the async loading thread, and nothing else can see it yet.
+        BakeTimeTempTable();
     }
 }
 
+// Calculate modified aspects based on time and temperature
+FPUAspectVector FPUIngredientBase::CalculateTimeTempModifiedAspectVector(float TimeValue, float TemperatureValue) const
+{
+    // Start with base aspects (already includes preparations)
+    FPUAspectVector Aspects = GetAspectVector();
+    GetTimeTempTable().Apply(MapTimeValueToState(TimeValue), MapTemperatureValueToState(TemperatureValue), Aspects);
+    return Aspects;
+}
+
+void FPUIngredientBase::CalculateTimeTempModifiedAspects(float TimeValue, float TemperatureValue, FFlavorAspects& OutFlavor, FTextureAspects& OutTexture) const
+{
+    UnpackAspects(CalculateTimeTempModifiedAspectVector(TimeValue, TemperatureValue), OutFlavor, OutTexture);
+}
+
 // Get modified flavor aspects
 FFlavorAspects FPUIngredientBase::GetModifiedFlavorAspects(float TimeValue, float TemperatureValue) const
 {
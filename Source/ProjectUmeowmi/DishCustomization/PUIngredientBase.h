@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "Engine/DataTable.h"
 #include "GameplayTagContainer.h"
+#include "PUAspectVector.h"
 #include "PUIngredientBase.generated.h"
 
 // Forward declarations
@@ -11,6 +12,7 @@ class UMaterialInterface;
 class UDataTable;
 class UStaticMesh;
 struct FPUPreparationBase;
+struct FPUTimeTempTable;
 
 // Forward declare enums from PUPreparationBase (to avoid circular dependency)
 enum class EAspectType : uint8;
@@ -65,6 +67,46 @@ struct FTimeTempModifier
     // Modification value
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Time/Temp Modifier")
     float ModificationValue = 0.0f;
+
+    // Lane index in FPUAspectVector for AspectName/AspectType (INDEX_NONE if unknown).
+    // Resolved when the row is loaded and re-resolved only if AspectName/AspectType are edited afterwards.
+    int32 GetAspectIndex() const
+    {
+        if (ResolvedAspectName != AspectName || ResolvedAspectType != AspectType)
+        {
+            ResolveAspectIndex();
+        }
+        return ResolvedAspectIndex;
+    }
+
+    void ResolveAspectIndex() const
+    {
+        ResolvedAspectName = AspectName;
+        ResolvedAspectType = AspectType;
+        ResolvedAspectIndex = static_cast<int8>(PUAspects::ResolveAspectIndex(AspectType, AspectName));
+    }
+
+    void PostSerialize(const FArchive& Ar)
+    {
+        if (Ar.IsLoading())
+        {
+            ResolveAspectIndex();
+        }
+    }
+
+private:
+    mutable FName ResolvedAspectName = NAME_None;
+    mutable uint8 ResolvedAspectType = 0;
+    mutable int8 ResolvedAspectIndex = INDEX_NONE;
+};
+
+template<>
+struct TStructOpsTypeTraits<FTimeTempModifier> : public TStructOpsTypeTraitsBase2<FTimeTempModifier>
+{
+    enum
+    {
+        WithPostSerialize = true,
+    };
 };
 
 // Flavor aspects - the six basic flavors
@@ -193,6 +235,7 @@ public:
 
     // Time/Temperature Modifiers (per-ingredient overrides)
     // If empty, will use default rules. If populated, these override defaults for this ingredient.
+    // Change through SetTimeTemperatureModifiers (or call InvalidateTimeTempTable) so the baked table follows.
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ingredient|Time/Temperature")
     TArray<FTimeTempModifier> TimeTemperatureModifiers;
 
@@ -209,6 +252,14 @@ public:
     void SetFlavorAspect(const FName& AspectName, float Value);
     // Set texture aspect value by name
     void SetTextureAspect(const FName& AspectName, float Value);
+    // Get aspect value by FPUAspectVector lane index (no name lookup)
+    float GetAspectByIndex(int32 AspectIndex) const;
+    // Set aspect value by FPUAspectVector lane index (same clamping/rounding as the named setters)
+    void SetAspectByIndex(int32 AspectIndex, float Value);
+    // Pack flavor + texture aspects into a 12-lane vector
+    FPUAspectVector GetAspectVector() const;
+    // Unpack a 12-lane vector back into the flavor/texture aspect structs
+    void SetAspectVector(const FPUAspectVector& Aspects);
     // Get total flavor value (sum of all flavor aspects)
     float GetTotalFlavorValue() const;
     // Get total texture value (sum of all texture aspects)
@@ -220,6 +271,8 @@ public:
     bool RemovePreparation(const FPUPreparationBase& Preparation);
     bool HasPreparation(const FGameplayTag& PreparationTag) const;
     FText GetCurrentDisplayName() const;
+    // Display name of this ingredient with the given preparations (prefixes/suffixes from PreparationDataTable)
+    FText GetDisplayNameWithPreparations(const FGameplayTagContainer& Preparations) const;
 
     // Time/Temperature Functions
     // Calculate modified aspects based on time and temperature values (0.0 to 1.0)
@@ -236,4 +289,54 @@ public:
     
     // Helper: Map slider value (0.0-1.0) to discrete temperature state
     static ETemperatureState MapTemperatureValueToState(float TemperatureValue);
+
+    // Helpers: Convert between the Blueprint-facing aspect structs and the packed vector
+    static FPUAspectVector PackAspects(const FFlavorAspects& Flavor, const FTextureAspects& Texture);
+    static void UnpackAspects(const FPUAspectVector& Aspects, FFlavorAspects& OutFlavor, FTextureAspects& OutTexture);
+
+    // Apply time/temp modifiers to this ingredient's packed aspects (one table lookup, no modifier scan)
+    FPUAspectVector CalculateTimeTempModifiedAspectVector(float TimeValue, float TemperatureValue) const;
+
+    // Baked time/temp table for this ingredient (custom modifiers or the shared default rules).
+    // Baked when the row loads and rebaked after the setters below, InvalidateTimeTempTable or an editor edit of the
+    // row. Game thread only whenever the table may need a rebake: the write is not synchronized, and copies of a row
+    // share it. Worker threads must read a table fetched on the game thread (see FPUDishScoringEngine::Prepare).
+    const FPUTimeTempTable& GetTimeTempTable() const;
+
+    // Same table as a shared reference (for caches that outlive this copy of the row)
+    TSharedRef<const FPUTimeTempTable> GetSharedTimeTempTable() const;
+
+    // Drop the baked table so the next lookup rebakes it (call after editing TimeTemperatureModifiers in place)
+    void InvalidateTimeTempTable() { TimeTempTable.Reset(); }
+
+    // Replace the custom modifiers / switch them on or off, and invalidate the baked table
+    void SetTimeTemperatureModifiers(const TArray<FTimeTempModifier>& Modifiers);
+    void SetUseCustomTimeTempModifiers(bool bUseCustom);
+
+    // Default time/temperature modifiers (universal rules used when an ingredient has no custom modifiers)
+    static TArray<FTimeTempModifier> GetDefaultTimeTempModifiers();
+
+    // Heap bytes owned by this copy (approximate - gameplay tag containers are counted by tag)
+    SIZE_T GetAllocatedSize() const;
+
+    void PostSerialize(const FArchive& Ar);
+
+    // Row edited in the data table editor (or reimported): rebake from the new modifiers
+    virtual void OnDataTableChanged(const UDataTable* InDataTable, const FName InRowName) override;
+
+private:
+    // (Re)bake TimeTempTable from the current modifiers
+    void BakeTimeTempTable() const;
+
+    // Shared between copies of the row, so copying an ingredient never copies the table
+    mutable TSharedPtr<const FPUTimeTempTable> TimeTempTable;
+};
+
+template<>
+struct TStructOpsTypeTraits<FPUIngredientBase> : public TStructOpsTypeTraitsBase2<FPUIngredientBase>
+{
+    enum
+    {
+        WithPostSerialize = true,
+    };
 }; 
\ No newline at end of file
@@ -0,0 +1,344 @@
+#include "PUIngredientCatalogSubsystem.h"
+#include "PUDishBlueprintLibrary.h"
+#include "Engine/DataTable.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/GCObject.h"
+
+// Debug output toggles (kept in code, but disabled by default to avoid log spam).
+namespace
+{
+    // Enables a summary log line whenever an ingredient table is indexed.
+    constexpr bool bPU_LogCatalogIndexing = false;
+
+    // Interned ingredient definitions by tag. Usually one per tag; more only if differing rows share a tag.
+    // Reports the definitions' UObject references (textures, tables) to GC, since no UPROPERTY owns them.
+    struct FDefinitionRegistry : public FGCObject
+    {
+        FRWLock Lock;
+        TMap<FGameplayTag, TArray<TSharedRef<const FPUIngredientBase>>> DefinitionsByTag;
+
+        virtual void AddReferencedObjects(FReferenceCollector& Collector) override
+        {
+            FReadScopeLock ReadLock(Lock);
+            for (const TPair<FGameplayTag, TArray<TSharedRef<const FPUIngredientBase>>>& Pair : DefinitionsByTag)
+            {
+                for (const TSharedRef<const FPUIngredientBase>& Definition : Pair.Value)
+                {
+                    Collector.AddPropertyReferencesWithStructARO(FPUIngredientBase::StaticStruct(), const_cast<FPUIngredientBase*>(&Definition.Get()));
+                }
+            }
+        }
+
+        virtual FString GetReferencerName() const override
+        {
+            return TEXT("UPUIngredientCatalogSubsystem::DefinitionRegistry");
+        }
+    };
+
+    FDefinitionRegistry& GetDefinitionRegistry()
+    {
+        // Leaked on purpose: instances may still hold definitions while statics are torn down
+        static FDefinitionRegistry* Registry = new FDefinitionRegistry();
+        return *Registry;
+    }
+
+    // Same definition unless something other than the per-instance fields differs
+    bool IsSameDefinition(const FPUIngredientBase& Definition, const FPUIngredientBase& Ingredient)
+    {
+        FPUIngredientBase Candidate = Ingredient;
+        Candidate.FlavorAspects = Definition.FlavorAspects;
+        Candidate.TextureAspects = Definition.TextureAspects;
+        Candidate.ActivePreparations = Definition.ActivePreparations;
+        return FPUIngredientBase::StaticStruct()->CompareScriptStruct(&Candidate, &Definition, PPF_None);
+    }
+}
+
+UPUIngredientCatalogSubsystem* UPUIngredientCatalogSubsystem::ActiveCatalog = nullptr;
+
+UPUIngredientCatalogSubsystem::UPUIngredientCatalogSubsystem()
+    : CoreIngredientDataTablePath(FSoftObjectPath(TEXT("/Game/LuckyFatCatDiner/Core/DataTables/DT_DC_Ingredients_Core.DT_DC_Ingredients_Core")))
+{
+}
+
+void UPUIngredientCatalogSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    ActiveCatalog = this;
+
+    // Load and index the core ingredient table once, up front
+    CoreIngredientDataTable = CoreIngredientDataTablePath.LoadSynchronous();
+    if (CoreIngredientDataTable)
+    {
+        FindOrBuildIndex(CoreIngredientDataTable);
+    }
+    else
+    {
+        UE_LOG(LogTemp, Warning, TEXT("UPUIngredientCatalogSubsystem::Initialize - Core ingredient data table '%s' could not be loaded"),
+            *CoreIngredientDataTablePath.ToString());
+    }
+}
+
+void UPUIngredientCatalogSubsystem::Deinitialize()
+{
+#if WITH_EDITOR
+    for (TPair<const UDataTable*, FIngredientTableIndex>& Pair : TableIndices)
+    {
+        if (IsValid(Pair.Key))
+        {
+            const_cast<UDataTable*>(Pair.Key)->OnDataTableChanged().Remove(Pair.Value.TableChangedHandle);
+        }
+    }
+#endif
+
+    TableIndices.Empty();
+    IndexedTables.Empty();
+    CoreIngredientDataTable = nullptr;
+
+    if (ActiveCatalog == this)
+    {
+        ActiveCatalog = nullptr;
+    }
+
+    Super::Deinitialize();
+}
+
+UPUIngredientCatalogSubsystem* UPUIngredientCatalogSubsystem::Get()
+{
+    return ActiveCatalog;
+}
+
+const FPUIngredientBase* UPUIngredientCatalogSubsystem::ResolveIngredient(const UDataTable* IngredientDataTable, const FGameplayTag& IngredientTag)
+{
+    if (!IngredientDataTable || !IngredientTag.IsValid())
+    {
+        return nullptr;
+    }
+
+    if (UPUIngredientCatalogSubsystem* Catalog = Get())
+    {
+        return Catalog->FindIngredient(IngredientTag, IngredientDataTable);
+    }
+
+    // No game instance (editor utilities, commandlets) - fall back to a direct row lookup
+    const FName RowName = UPUDishBlueprintLibrary::GetIngredientRowNameFromTag(IngredientTag);
+    return IngredientDataTable->FindRow<FPUIngredientBase>(RowName, TEXT("ResolveIngredient"), false);
+}
+
+const FPUIngredientBase* UPUIngredientCatalogSubsystem::ResolveIngredient(const TSoftObjectPtr<UDataTable>& IngredientDataTable, const FGameplayTag& IngredientTag)
+{
+    // Resident tables skip the path resolve. A table that is not loaded yet is loaded once here; the catalog
+    // then holds it with its index (IndexedTables), so later calls for it stay on the Get() path.
+    const UDataTable* Table = IngredientDataTable.Get();
+    if (!Table && !IngredientDataTable.IsNull())
+    {
+        Table = IngredientDataTable.LoadSynchronous();
+        if (!Table)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("UPUIngredientCatalogSubsystem::ResolveIngredient - Ingredient data table '%s' could not be loaded"),
+                *IngredientDataTable.ToString());
+        }
+    }
+    return ResolveIngredient(Table, IngredientTag);
+}
+
+TSharedRef<const FPUIngredientBase> UPUIngredientCatalogSubsystem::InternDefinition(const FPUIngredientBase& Ingredient)
+{
+    FDefinitionRegistry& Registry = GetDefinitionRegistry();
+    {
+        FReadScopeLock ReadLock(Registry.Lock);
+        if (const TArray<TSharedRef<const FPUIngredientBase>>* Definitions = Registry.DefinitionsByTag.Find(Ingredient.IngredientTag))
+        {
+            for (const TSharedRef<const FPUIngredientBase>& Definition : *Definitions)
+            {
+                if (IsSameDefinition(*Definition, Ingredient))
+                {
+                    return Definition;
+                }
+            }
+        }
+    }
+
+    FWriteScopeLock WriteLock(Registry.Lock);
+    TArray<TSharedRef<const FPUIngredientBase>>& Definitions = Registry.DefinitionsByTag.FindOrAdd(Ingredient.IngredientTag);
+    // Another thread may have registered it between the locks
+    for (const TSharedRef<const FPUIngredientBase>& Definition : Definitions)
+    {
+        if (IsSameDefinition(*Definition, Ingredient))
+        {
+            return Definition;
+        }
+    }
+    return Definitions.Add_GetRef(MakeShared<FPUIngredientBase>(Ingredient));
+}
+
+TSharedPtr<const FPUIngredientBase> UPUIngredientCatalogSubsystem::FindDefinition(const FGameplayTag& IngredientTag, const TSoftObjectPtr<UDataTable>& IngredientDataTable)
+{
+    if (!IngredientTag.IsValid())
+    {
+        return nullptr;
+    }
+
+    // A specific table may have its own row for the tag - intern that one (loading the table needs the game thread)
+    if (!IngredientDataTable.IsNull() && IsInGameThread())
+    {
+        if (const FPUIngredientBase* Row = ResolveIngredient(IngredientDataTable, IngredientTag))
+        {
+            return InternDefinition(*Row);
+        }
+    }
+
+    {
+        FDefinitionRegistry& Registry = GetDefinitionRegistry();
+        FReadScopeLock ReadLock(Registry.Lock);
+        if (const TArray<TSharedRef<const FPUIngredientBase>>* Definitions = Registry.DefinitionsByTag.Find(IngredientTag))
+        {
+            if (Definitions->Num() > 0)
+            {
+                return (*Definitions)[0];
+            }
+        }
+    }
+
+    if (IsInGameThread())
+    {
+        const TSoftObjectPtr<UDataTable>& CoreTable = GetDefault<UPUIngredientCatalogSubsystem>()->CoreIngredientDataTablePath;
+        if (const FPUIngredientBase* Row = ResolveIngredient(CoreTable, IngredientTag))
+        {
+            return InternDefinition(*Row);
+        }
+    }
+    return nullptr;
+}
+
+int32 UPUIngredientCatalogSubsystem::FindRowIndex(const FGameplayTag& IngredientTag, const UDataTable* IngredientDataTable)
+{
+    if (!IngredientDataTable)
+    {
+        IngredientDataTable = CoreIngredientDataTable;
+    }
+
+    FIngredientTableIndex* Index = FindOrBuildIndex(IngredientDataTable);
+    if (!Index || !IngredientTag.IsValid())
+    {
+        return INDEX_NONE;
+    }
+
+    if (const int32* RowIndex = Index->TagToRowIndex.Find(IngredientTag))
+    {
+        return *RowIndex;
+    }
+
+    // Tag was not declared on any row - resolve it by row name once and remember the result (including misses)
+    const FName RowName = UPUDishBlueprintLibrary::GetIngredientRowNameFromTag(IngredientTag);
+    int32 ResolvedIndex = INDEX_NONE;
+    if (const FPUIngredientBase* Row = IngredientDataTable->FindRow<FPUIngredientBase>(RowName, TEXT("FindRowIndex"), false))
+    {
+        ResolvedIndex = Index->Rows.Find(Row);
+    }
+    Index->TagToRowIndex.Add(IngredientTag, ResolvedIndex);
+    return ResolvedIndex;
+}
+
+const FPUIngredientBase* UPUIngredientCatalogSubsystem::GetRowByIndex(int32 RowIndex, const UDataTable* IngredientDataTable)
+{
+    FIngredientTableIndex* Index = FindOrBuildIndex(IngredientDataTable ? IngredientDataTable : CoreIngredientDataTable.Get());
+    if (!Index || !Index->Rows.IsValidIndex(RowIndex))
+    {
+        return nullptr;
+    }
+    return Index->Rows[RowIndex];
+}
+
+const FPUIngredientBase* UPUIngredientCatalogSubsystem::FindIngredient(const FGameplayTag& IngredientTag, const UDataTable* IngredientDataTable)
+{
+    if (!IngredientDataTable)
+    {
+        IngredientDataTable = CoreIngredientDataTable;
+    }
+    return GetRowByIndex(FindRowIndex(IngredientTag, IngredientDataTable), IngredientDataTable);
+}
+
+int32 UPUIngredientCatalogSubsystem::GetNumRows(const UDataTable* IngredientDataTable)
+{
+    FIngredientTableIndex* Index = FindOrBuildIndex(IngredientDataTable ? IngredientDataTable : CoreIngredientDataTable.Get());
+    return Index ? Index->Rows.Num() : 0;
+}
+
+bool UPUIngredientCatalogSubsystem::GetIngredientByTag(const FGameplayTag& IngredientTag, FPUIngredientBase& OutIngredient)
+{
+    if (const FPUIngredientBase* Row = FindIngredient(IngredientTag))
+    {
+        OutIngredient = *Row;
+        return true;
+    }
+    return false;
+}
+
+UPUIngredientCatalogSubsystem::FIngredientTableIndex* UPUIngredientCatalogSubsystem::FindOrBuildIndex(const UDataTable* IngredientDataTable)
+{
+    if (!IngredientDataTable)
+    {
+        return nullptr;
+    }
+
+    if (FIngredientTableIndex* Existing = TableIndices.Find(IngredientDataTable))
+    {
+        return Existing;
+    }
+
+    const UScriptStruct* RowStruct = IngredientDataTable->GetRowStruct();
+    if (!RowStruct || !RowStruct->IsChildOf(FPUIngredientBase::StaticStruct()))
+    {
+        return nullptr;
+    }
+
+    FIngredientTableIndex& NewIndex = TableIndices.Add(IngredientDataTable);
+    BuildIndex(IngredientDataTable, NewIndex);
+    IndexedTables.AddUnique(const_cast<UDataTable*>(IngredientDataTable));
+
+#if WITH_EDITOR
+    // Reindex if the table is edited or reimported while the game is running (row memory is reallocated)
+    NewIndex.TableChangedHandle = const_cast<UDataTable*>(IngredientDataTable)->OnDataTableChanged().AddUObject(
+        this, &UPUIngredientCatalogSubsystem::HandleTableChanged, IngredientDataTable);
+#endif
+
+    return &NewIndex;
+}
+
+void UPUIngredientCatalogSubsystem::BuildIndex(const UDataTable* IngredientDataTable, FIngredientTableIndex& OutIndex) const
+{
+    OutIndex.Rows.Reset();
+    OutIndex.TagToRowIndex.Reset();
+
+    const TMap<FName, uint8*>& RowMap = IngredientDataTable->GetRowMap();
+    OutIndex.Rows.Reserve(RowMap.Num());
+    OutIndex.TagToRowIndex.Reserve(RowMap.Num());
+
+    for (const TPair<FName, uint8*>& Pair : RowMap)
+    {
+        const FPUIngredientBase* Row = reinterpret_cast<const FPUIngredientBase*>(Pair.Value);
+        const int32 RowIndex = OutIndex.Rows.Add(Row);
+
+        // Only pre-map tags whose row name follows the tag naming rule, so lookups resolve exactly like
+        // GetIngredientRowNameFromTag + FindRow did. Anything else is resolved by name on first use.
+        if (Row->IngredientTag.IsValid() && UPUDishBlueprintLibrary::GetIngredientRowNameFromTag(Row->IngredientTag) == Pair.Key)
+        {
+            OutIndex.TagToRowIndex.Add(Row->IngredientTag, RowIndex);
+        }
+    }
+
+    if (bPU_LogCatalogIndexing)
+    {
+        UE_LOG(LogTemp, Display, TEXT("UPUIngredientCatalogSubsystem - Indexed %s: %d rows, %d tags"),
+            *IngredientDataTable->GetName(), OutIndex.Rows.Num(), OutIndex.TagToRowIndex.Num());
+    }
+}
+
+void UPUIngredientCatalogSubsystem::HandleTableChanged(const UDataTable* IngredientDataTable)
+{
+    if (FIngredientTableIndex* Index = TableIndices.Find(IngredientDataTable))
+    {
+        BuildIndex(IngredientDataTable, *Index);
+    }
+}
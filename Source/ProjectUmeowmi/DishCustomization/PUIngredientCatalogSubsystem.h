@@ -0,0 +1,97 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "PUIngredientBase.h"
+#include "PUIngredientCatalogSubsystem.generated.h"
+
+class UDataTable;
+
+/**
+ * Ingredient catalog - resolves ingredient gameplay tags to data table rows in O(1).
+ *
+ * The core ingredient table (DT_DC_Ingredients_Core) is indexed once when the GameInstance starts.
+ * Any other ingredient table handed to the catalog is indexed the first time it is seen.
+ * Row pointers stay valid for the lifetime of the catalog (tables are rooted here and reindexed if edited).
+ *
+ * Struct helpers (FPUDishBase, UPUDishBlueprintLibrary) use the static ResolveIngredient() helpers,
+ * which fall back to a plain row lookup when no game instance is running (e.g. editor utilities).
+ */
+UCLASS(Config = Game)
+class PROJECTUMEOWMI_API UPUIngredientCatalogSubsystem : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    UPUIngredientCatalogSubsystem();
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // Get the active catalog (nullptr if no game instance is running)
+    static UPUIngredientCatalogSubsystem* Get();
+
+    // Resolve an ingredient row for a tag. Uses the catalog when available, otherwise a direct row lookup.
+    // The soft overload loads a table that is not resident yet (once - the catalog keeps indexed tables loaded).
+    static const FPUIngredientBase* ResolveIngredient(const UDataTable* IngredientDataTable, const FGameplayTag& IngredientTag);
+    static const FPUIngredientBase* ResolveIngredient(const TSoftObjectPtr<UDataTable>& IngredientDataTable, const FGameplayTag& IngredientTag);
+
+    // Shared ingredient definitions held by FIngredientInstance (one copy per ingredient instead of one per instance).
+    // InternDefinition returns the registered definition for the ingredient's tag if it matches in everything but the
+    // per-instance fields (aspects, ActivePreparations, which are not compared), otherwise registers a copy.
+    // Thread safe; definitions never change once registered (a table edited in the editor registers new ones).
+    static TSharedRef<const FPUIngredientBase> InternDefinition(const FPUIngredientBase& Ingredient);
+
+    // Definition for a tag: the row in IngredientDataTable if given, otherwise the first one registered for the tag.
+    // On the game thread a tag with nothing registered falls back to the core table. nullptr if nothing is found.
+    static TSharedPtr<const FPUIngredientBase> FindDefinition(const FGameplayTag& IngredientTag, const TSoftObjectPtr<UDataTable>& IngredientDataTable = nullptr);
+
+    // Find the dense row index for a tag in the given table (core table if nullptr). INDEX_NONE if not found.
+    int32 FindRowIndex(const FGameplayTag& IngredientTag, const UDataTable* IngredientDataTable = nullptr);
+
+    // Get a row by dense index in the given table (core table if nullptr)
+    const FPUIngredientBase* GetRowByIndex(int32 RowIndex, const UDataTable* IngredientDataTable = nullptr);
+
+    // Find a row by tag in the given table (core table if nullptr)
+    const FPUIngredientBase* FindIngredient(const FGameplayTag& IngredientTag, const UDataTable* IngredientDataTable = nullptr);
+
+    // Number of rows in the given table's index (core table if nullptr)
+    int32 GetNumRows(const UDataTable* IngredientDataTable = nullptr);
+
+    // Blueprint-friendly lookup (copies the row)
+    UFUNCTION(BlueprintCallable, Category = "Ingredient|Catalog")
+    bool GetIngredientByTag(const FGameplayTag& IngredientTag, FPUIngredientBase& OutIngredient);
+
+    UFUNCTION(BlueprintCallable, Category = "Ingredient|Catalog")
+    UDataTable* GetCoreIngredientDataTable() const { return CoreIngredientDataTable; }
+
+    // Core ingredient table. Override in DefaultGame.ini under [/Script/ProjectUmeowmi.PUIngredientCatalogSubsystem]:
+    // CoreIngredientDataTablePath=/Game/Path/To/DT_Ingredients.DT_Ingredients
+    UPROPERTY(Config, EditAnywhere, Category = "Ingredient|Catalog")
+    TSoftObjectPtr<UDataTable> CoreIngredientDataTablePath;
+
+private:
+    // Dense index over one ingredient data table
+    struct FIngredientTableIndex
+    {
+        TArray<const FPUIngredientBase*> Rows;
+        TMap<FGameplayTag, int32> TagToRowIndex;
+        FDelegateHandle TableChangedHandle;
+    };
+
+    FIngredientTableIndex* FindOrBuildIndex(const UDataTable* IngredientDataTable);
+    void BuildIndex(const UDataTable* IngredientDataTable, FIngredientTableIndex& OutIndex) const;
+    void HandleTableChanged(const UDataTable* IngredientDataTable);
+
+    UPROPERTY()
+    TObjectPtr<UDataTable> CoreIngredientDataTable;
+
+    // Tables referenced by the indices below (kept alive so row pointers stay valid)
+    UPROPERTY()
+    TArray<TObjectPtr<UDataTable>> IndexedTables;
+
+    TMap<const UDataTable*, FIngredientTableIndex> TableIndices;
+
+    static UPUIngredientCatalogSubsystem* ActiveCatalog;
+};
@@ -1,6 +1,6 @@
 #include "PUIngredientMesh.h"
 #include "Components/StaticMeshComponent.h"
-#include "Kismet/GameplayStatics.h"
+#include "PUStationRegistrySubsystem.h"
 #include "PUDishCustomizationComponent.h"
 #include "Engine/Engine.h"
 
@@ -96,6 +96,11 @@ void APUIngredientMesh::InitializeWithIngredient(const FPUIngredientBase& InIngr
     {
         MeshComponent->SetMaterial(0, DefaultMaterial);
     }
+    else
+    {
+        // Pooled actors may still carry the previous ingredient's material
+        MeshComponent->EmptyOverrideMaterials();
+    }
 
     // Store initial position and rotation
     OriginalPosition = GetActorLocation();
@@ -350,38 +355,30 @@ void APUIngredientMesh::NotifyActorOnClicked(FKey ButtonPressed)
     if (ButtonPressed == EKeys::LeftMouseButton)
     {
         // Find the dish customization component to handle the drag
-        TArray<AActor*> FoundActors;
-        UGameplayStatics::GetAllActorsOfClass(GetWorld(), AActor::StaticClass(), FoundActors);
-        
-        for (AActor* Actor : FoundActors)
+        UPUStationRegistrySubsystem* StationRegistry = UPUStationRegistrySubsystem::Get(this);
+        if (UPUDishCustomizationComponent* DishComponent = StationRegistry ? StationRegistry->FindPlatingComponent() : nullptr)
         {
-            if (UPUDishCustomizationComponent* DishComponent = Actor->FindComponentByClass<UPUDishCustomizationComponent>())
+            //UE_LOG(LogTemp,Display, TEXT("🖱️ [CLICK] Notifying dish customization component of ingredient click for %s"), *GetName());
+            
+            // Verify ingredient is still valid before proceeding
+            if (!IsValid(this))
+            {
+                //UE_LOG(LogTemp,Error, TEXT("❌ [CLICK] Ingredient %s is no longer valid!"), *GetName());
+                return;
+            }
+            
+            // Notify the component to start dragging this ingredient
+            // Don't call OnMouseGrab here - let StartDraggingIngredient handle it
+            DishComponent->StartDraggingIngredient(this);
+            
+            // Verify position after starting drag
+            if (IsValid(this))
             {
-                if (DishComponent->IsPlatingMode())
-                {
-                    //UE_LOG(LogTemp,Display, TEXT("🖱️ [CLICK] Notifying dish customization component of ingredient click for %s"), *GetName());
-                    
-                    // Verify ingredient is still valid before proceeding
-                    if (!IsValid(this))
-                    {
-                        //UE_LOG(LogTemp,Error, TEXT("❌ [CLICK] Ingredient %s is no longer valid!"), *GetName());
-                        return;
-                    }
-                    
-                    // Notify the component to start dragging this ingredient
-                    // Don't call OnMouseGrab here - let StartDraggingIngredient handle it
-                    DishComponent->StartDraggingIngredient(this);
-                    
-                    // Verify position after starting drag
-                    if (IsValid(this))
-                    {
-                        FVector PosAfterStartDrag = GetActorLocation();
-                        //UE_LOG(LogTemp,Display, TEXT("🖱️ [CLICK] After StartDraggingIngredient - %s at position (%.2f,%.2f,%.2f)"), 
-                        //    *GetName(), PosAfterStartDrag.X, PosAfterStartDrag.Y, PosAfterStartDrag.Z);
-                    }
-                    return;
-                }
+                FVector PosAfterStartDrag = GetActorLocation();
+                //UE_LOG(LogTemp,Display, TEXT("🖱️ [CLICK] After StartDraggingIngredient - %s at position (%.2f,%.2f,%.2f)"), 
+                //    *GetName(), PosAfterStartDrag.X, PosAfterStartDrag.Y, PosAfterStartDrag.Z);
             }
+            return;
         }
         
         //UE_LOG(LogTemp,Warning, TEXT("⚠️ [CLICK] Could not find dish customization component in plating mode"));
@@ -421,4 +418,55 @@ void APUIngredientMesh::TestMouseInteraction()
             //UE_LOG(LogTemp,Display, TEXT("🧪 No hit under cursor"));
         }
     }
-} 
\ No newline at end of file
+} 
+
+void APUIngredientMesh::ActivateFromPool(const FVector& Location, const FRotator& Rotation)
+{
+    bIsInPool = false;
+    bIsHovered = false;
+    bIsGrabbed = false;
+
+    SetActorLocationAndRotation(Location, Rotation, false, nullptr, ETeleportType::ResetPhysics);
+    SetActorHiddenInGame(false);
+    SetActorEnableCollision(true);
+    SetActorTickEnabled(true);
+
+    if (MeshComponent)
+    {
+        // Same physics setup as PostInitializeComponents (a previous drag may have changed the damping)
+        MeshComponent->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+        MeshComponent->SetSimulatePhysics(true);
+        MeshComponent->SetEnableGravity(true);
+        MeshComponent->SetLinearDamping(2.0f);
+        MeshComponent->SetAngularDamping(5.0f);
+        MeshComponent->SetPhysicsLinearVelocity(FVector::ZeroVector);
+        MeshComponent->SetPhysicsAngularVelocityInDegrees(FVector::ZeroVector);
+    }
+
+    OriginalPosition = Location;
+    OriginalRotation = Rotation;
+}
+
+void APUIngredientMesh::DeactivateToPool()
+{
+    bIsInPool = true;
+    bIsHovered = false;
+    bIsGrabbed = false;
+    InstanceID = 0;
+
+    if (MeshComponent)
+    {
+        MeshComponent->SetSimulatePhysics(false);
+        MeshComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    }
+
+    SetActorHiddenInGame(true);
+    SetActorEnableCollision(false);
+    SetActorTickEnabled(false);
+
+    // Listeners belong to the previous placement
+    OnIngredientMoved.Clear();
+    OnIngredientRotated.Clear();
+    OnIngredientGrabbed.Clear();
+    OnIngredientReleased.Clear();
+}
@@ -53,6 +53,19 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Ingredient|Interaction")
     void UpdateRotation(const FRotator& NewRotation);
 
+    // Pooling (see FPUIngredientMeshPool): wake a pooled actor at a new spot, or park it hidden with physics and collision off
+    void ActivateFromPool(const FVector& Location, const FRotator& Rotation);
+    void DeactivateToPool();
+
+    bool IsPooledAndInactive() const { return bIsInPool; }
+
+    UStaticMeshComponent* GetMeshComponent() const { return MeshComponent; }
+    const FPUIngredientBase& GetIngredientData() const { return IngredientData; }
+    int32 GetInstanceID() const { return InstanceID; }
+    void SetInstanceID(int32 InInstanceID) { InstanceID = InInstanceID; }
+    bool IsGrabbed() const { return bIsGrabbed; }
+    bool IsHovered() const { return bIsHovered; }
+
 protected:
     // Components
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
@@ -91,10 +104,18 @@ protected:
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State")
     FRotator OriginalRotation;
 
+    // Parked in a pool, waiting to be reused
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State")
+    bool bIsInPool = false;
+
     // Ingredient data
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data")
     FPUIngredientBase IngredientData;
 
+    // The dish ingredient instance this piece was spawned for (0 if none)
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data")
+    int32 InstanceID = 0;
+
 public:
     // Event dispatchers
     UPROPERTY(BlueprintAssignable, Category = "Events")
@@ -0,0 +1,93 @@
+#include "PUIngredientMeshPool.h"
+#include "PUIngredientMesh.h"
+#include "Engine/World.h"
+
+namespace
+{
+    // Spawn location for parked actors (well away from anything the player can see)
+    const FVector PooledMeshParkingLocation(0.0f, 0.0f, -100000.0f);
+}
+
+APUIngredientMesh* FPUIngredientMeshPool::SpawnParked(UWorld* World, AActor* Owner)
+{
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.Owner = Owner;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+    APUIngredientMesh* IngredientMesh = World->SpawnActor<APUIngredientMesh>(APUIngredientMesh::StaticClass(), PooledMeshParkingLocation, FRotator::ZeroRotator, SpawnParams);
+    if (IngredientMesh)
+    {
+        ++NumSpawned;
+        IngredientMesh->DeactivateToPool();
+    }
+    return IngredientMesh;
+}
+
+void FPUIngredientMeshPool::Prewarm(UWorld* World, AActor* Owner, int32 Count)
+{
+    if (!World)
+    {
+        return;
+    }
+
+    FreeMeshes.RemoveAll([](const TObjectPtr<APUIngredientMesh>& IngredientMesh) { return !IsValid(IngredientMesh); });
+    while (FreeMeshes.Num() < Count)
+    {
+        APUIngredientMesh* IngredientMesh = SpawnParked(World, Owner);
+        if (!IngredientMesh)
+        {
+            break;
+        }
+        FreeMeshes.Add(IngredientMesh);
+    }
+}
+
+APUIngredientMesh* FPUIngredientMeshPool::Acquire(UWorld* World, AActor* Owner, const FVector& Location, const FRotator& Rotation)
+{
+    APUIngredientMesh* IngredientMesh = nullptr;
+    while (!IngredientMesh && FreeMeshes.Num() > 0)
+    {
+        // Parked actors can be destroyed from outside (level teardown), skip those
+        APUIngredientMesh* Candidate = FreeMeshes.Pop(EAllowShrinking::No);
+        if (IsValid(Candidate) && Candidate->GetWorld() == World)
+        {
+            IngredientMesh = Candidate;
+        }
+    }
+
+    if (!IngredientMesh && World)
+    {
+        IngredientMesh = SpawnParked(World, Owner);
+    }
+
+    if (IngredientMesh)
+    {
+        IngredientMesh->SetOwner(Owner);
+        IngredientMesh->ActivateFromPool(Location, Rotation);
+    }
+    return IngredientMesh;
+}
+
+void FPUIngredientMeshPool::Release(APUIngredientMesh* IngredientMesh)
+{
+    if (!IsValid(IngredientMesh) || IngredientMesh->IsPooledAndInactive())
+    {
+        return;
+    }
+
+    IngredientMesh->DeactivateToPool();
+    IngredientMesh->SetActorLocation(PooledMeshParkingLocation);
+    FreeMeshes.Add(IngredientMesh);
+}
+
+void FPUIngredientMeshPool::DestroyAll()
+{
+    for (APUIngredientMesh* IngredientMesh : FreeMeshes)
+    {
+        if (IsValid(IngredientMesh))
+        {
+            IngredientMesh->Destroy();
+        }
+    }
+    FreeMeshes.Empty();
+}
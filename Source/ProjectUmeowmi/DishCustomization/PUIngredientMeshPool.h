@@ -0,0 +1,45 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PUIngredientMeshPool.generated.h"
+
+class AActor;
+class APUIngredientMesh;
+class UWorld;
+
+/**
+ * Recycles APUIngredientMesh actors for plating, so place / reset cycles do not spawn and destroy actors.
+ *
+ * Released actors are parked hidden with physics, collision and tick off, and are rebound to a new ingredient
+ * through InitializeWithIngredient when acquired again. Owned by UPUDishCustomizationComponent.
+ */
+USTRUCT()
+struct PROJECTUMEOWMI_API FPUIngredientMeshPool
+{
+    GENERATED_BODY()
+
+    // Spawn parked actors until at least Count are free
+    void Prewarm(UWorld* World, AActor* Owner, int32 Count);
+
+    // Reuse a parked actor (or spawn one if the pool is empty) and wake it at the given transform
+    APUIngredientMesh* Acquire(UWorld* World, AActor* Owner, const FVector& Location, const FRotator& Rotation);
+
+    // Park an actor for reuse
+    void Release(APUIngredientMesh* IngredientMesh);
+
+    // Destroy every parked actor (actors still in use are left alone)
+    void DestroyAll();
+
+    int32 GetNumFree() const { return FreeMeshes.Num(); }
+
+    // Actors this pool has spawned over its lifetime
+    int32 GetNumSpawned() const { return NumSpawned; }
+
+private:
+    APUIngredientMesh* SpawnParked(UWorld* World, AActor* Owner);
+
+    UPROPERTY()
+    TArray<TObjectPtr<APUIngredientMesh>> FreeMeshes;
+
+    int32 NumSpawned = 0;
+};
@@ -1,5 +1,6 @@
 #include "PUOrderBase.h"
 #include "Engine/Engine.h"
+#include "Async/ParallelFor.h"
 
 // Debug output toggles (kept in code, but disabled by default to avoid log spam).
 namespace
@@ -7,6 +8,12 @@ namespace
     constexpr bool bPU_LogOrderDishDebug = false;
 }
 
+namespace
+{
+    // Below this many dishes the batch functions score on the calling thread (task overhead dominates)
+    constexpr int32 BatchParallelThreshold = 256;
+}
+
 FPUOrderBase::FPUOrderBase()
     : OrderID(NAME_None)
     , OrderDescription(FText::GetEmpty())
@@ -21,21 +28,14 @@ bool FPUOrderBase::ValidateDish(const FPUDishBase& Dish) const
 {
     //UE_LOG(LogTemp,Log, TEXT("FPUOrderBase::ValidateDish - Starting validation for order: %s"), *OrderID.ToString());
     
-    // Check ingredient count - sum up all quantities, not just unique types
-    int32 CurrentIngredientCount = Dish.GetTotalIngredientQuantity();
-    bool bIngredientCountValid = CurrentIngredientCount >= MinIngredientCount;
-    
-    //UE_LOG(LogTemp,Log, TEXT("FPUOrderBase::ValidateDish - Ingredient count: %d/%d (Required: %d) - Valid: %s"), 
-    //    CurrentIngredientCount, MinIngredientCount, MinIngredientCount, bIngredientCountValid ? TEXT("YES") : TEXT("NO"));
+    // Ingredient count sums up all quantities, not just unique types; flavor resolves the aspect lane once, then sums by index
+    const int32 CurrentIngredientCount = Dish.GetTotalIngredientQuantity();
+    const float CurrentFlavorValue = Dish.GetTotalAspectByIndex(GetTargetFlavorIndex());
     
-    // Check flavor requirement
-    float CurrentFlavorValue = Dish.GetTotalFlavorAspect(TargetFlavorProperty);
-    bool bFlavorValid = CurrentFlavorValue >= MinFlavorValue;
+    //UE_LOG(LogTemp,Log, TEXT("FPUOrderBase::ValidateDish - Ingredient count: %d/%d, Flavor %s: %.2f/%.2f"), 
+    //    CurrentIngredientCount, MinIngredientCount, *TargetFlavorProperty.ToString(), CurrentFlavorValue, MinFlavorValue);
     
-    //UE_LOG(LogTemp,Log, TEXT("FPUOrderBase::ValidateDish - Flavor %s: %.2f/%.2f (Required: %.2f) - Valid: %s"), 
-    //    *TargetFlavorProperty.ToString(), CurrentFlavorValue, MinFlavorValue, MinFlavorValue, bFlavorValid ? TEXT("YES") : TEXT("NO"));
-    
-    bool bOverallValid = bIngredientCountValid && bFlavorValid;
+    const bool bOverallValid = ValidateTotals(CurrentIngredientCount, CurrentFlavorValue);
     
     //UE_LOG(LogTemp,Log, TEXT("FPUOrderBase::ValidateDish - Overall validation result: %s"), bOverallValid ? TEXT("PASS") : TEXT("FAIL"));
     
@@ -46,29 +46,41 @@ float FPUOrderBase::GetSatisfactionScore(const FPUDishBase& Dish) const
 {
     //UE_LOG(LogTemp,Log, TEXT("FPUOrderBase::GetSatisfactionScore - Calculating satisfaction for order: %s"), *OrderID.ToString());
     
-    float Score = 0.0f;
-    
-    // Ingredient count satisfaction (50% of score) - sum up all quantities
-    int32 CurrentIngredientCount = Dish.GetTotalIngredientQuantity();
-    float IngredientScore = FMath::Clamp(static_cast<float>(CurrentIngredientCount) / static_cast<float>(MinIngredientCount), 0.0f, 1.0f);
-    Score += IngredientScore * 0.5f;
-    
-    //UE_LOG(LogTemp,Log, TEXT("FPUOrderBase::GetSatisfactionScore - Ingredient score: %.2f (Count: %d/%d)"), 
-    //    IngredientScore, CurrentIngredientCount, MinIngredientCount);
-    
-    // Flavor satisfaction (50% of score)
-    float CurrentFlavor = Dish.GetTotalFlavorAspect(TargetFlavorProperty);
-    float FlavorScore = FMath::Clamp(CurrentFlavor / MinFlavorValue, 0.0f, 1.0f);
-    Score += FlavorScore * 0.5f;
-    
-    //UE_LOG(LogTemp,Log, TEXT("FPUOrderBase::GetSatisfactionScore - Flavor score: %.2f (Value: %.2f/%.2f)"), 
-    //    FlavorScore, CurrentFlavor, MinFlavorValue);
+    const int32 CurrentIngredientCount = Dish.GetTotalIngredientQuantity();
+    const float CurrentFlavor = Dish.GetTotalAspectByIndex(GetTargetFlavorIndex());
+    const float Score = GetSatisfactionScoreFromTotals(CurrentIngredientCount, CurrentFlavor);
     
-    //UE_LOG(LogTemp,Log, TEXT("FPUOrderBase::GetSatisfactionScore - Final satisfaction score: %.2f"), Score);
+    //UE_LOG(LogTemp,Log, TEXT("FPUOrderBase::GetSatisfactionScore - Final satisfaction score: %.2f (Count: %d/%d, Flavor: %.2f/%.2f)"), 
+    //    Score, CurrentIngredientCount, MinIngredientCount, CurrentFlavor, MinFlavorValue);
     
     return Score;
 }
 
+void FPUOrderBase::ValidateDishes(TConstArrayView<FPUDishBase> Dishes, TArrayView<bool> OutValid) const
+{
+    check(Dishes.Num() == OutValid.Num());
+
+    // Each dish is only touched by one worker, so the lazily rebuilt running totals are safe to build here
+    const int32 FlavorIndex = GetTargetFlavorIndex();
+    ParallelFor(Dishes.Num(), [this, &Dishes, &OutValid, FlavorIndex](int32 DishIndex)
+    {
+        const FPUDishBase& Dish = Dishes[DishIndex];
+        OutValid[DishIndex] = ValidateTotals(Dish.GetTotalIngredientQuantity(), Dish.GetTotalAspectByIndex(FlavorIndex));
+    }, Dishes.Num() < BatchParallelThreshold ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+}
+
+void FPUOrderBase::GetSatisfactionScores(TConstArrayView<FPUDishBase> Dishes, TArrayView<float> OutScores) const
+{
+    check(Dishes.Num() == OutScores.Num());
+
+    const int32 FlavorIndex = GetTargetFlavorIndex();
+    ParallelFor(Dishes.Num(), [this, &Dishes, &OutScores, FlavorIndex](int32 DishIndex)
+    {
+        const FPUDishBase& Dish = Dishes[DishIndex];
+        OutScores[DishIndex] = GetSatisfactionScoreFromTotals(Dish.GetTotalIngredientQuantity(), Dish.GetTotalAspectByIndex(FlavorIndex));
+    }, Dishes.Num() < BatchParallelThreshold ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+}
+
 void FPUOrderBase::LogOrderDetails() const
 {
     if (!bPU_LogOrderDishDebug)
@@ -139,13 +151,13 @@ void FPUOrderBase::LogCompletionDetails() const
     {
         const FIngredientInstance& Instance = CompletedDish.IngredientInstances[i];
         //UE_LOG(LogTemp,Display, TEXT("  - Ingredient %d: %s (Qty: %d)"), 
-        //    i, *Instance.IngredientData.IngredientTag.ToString(), Instance.Quantity);
+        //    i, *Instance.IngredientTag.ToString(), Instance.Quantity);
         
         // Log preparations if any
-        if (Instance.IngredientData.ActivePreparations.Num() > 0)
+        if (Instance.Preparations.Num() > 0)
         {
             TArray<FGameplayTag> PreparationTags;
-            Instance.IngredientData.ActivePreparations.GetGameplayTagArray(PreparationTags);
+            Instance.Preparations.GetGameplayTagArray(PreparationTags);
             FString PrepString = TEXT("    Preparations: ");
             for (const FGameplayTag& PrepTag : PreparationTags)
             {
@@ -25,7 +25,7 @@ public:
     int32 MinIngredientCount = 3;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Order|Requirements")
-    FName TargetFlavorProperty = FName(TEXT("Saltiness"));
+    FName TargetFlavorProperty = FName(TEXT("Salt"));
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Order|Requirements")
     float MinFlavorValue = 5.0f;
@@ -50,6 +50,28 @@ public:
 
     float GetSatisfactionScore(const FPUDishBase& Dish) const;
 
+    // Batch equivalents (scored in parallel; output views must be the same size as Dishes)
+    void ValidateDishes(TConstArrayView<FPUDishBase> Dishes, TArrayView<bool> OutValid) const;
+
+    void GetSatisfactionScores(TConstArrayView<FPUDishBase> Dishes, TArrayView<float> OutScores) const;
+
+    // Lane of TargetFlavorProperty in FPUAspectVector (INDEX_NONE if unknown) - resolve once per batch
+    int32 GetTargetFlavorIndex() const { return PUAspects::ResolveFlavorIndex(TargetFlavorProperty); }
+
+    // Scoring from dish totals (shared by the single-dish, batch and search paths so they always agree)
+    FORCEINLINE bool ValidateTotals(int32 TotalQuantity, float TargetFlavorTotal) const
+    {
+        return TotalQuantity >= MinIngredientCount && TargetFlavorTotal >= MinFlavorValue;
+    }
+
+    FORCEINLINE float GetSatisfactionScoreFromTotals(int32 TotalQuantity, float TargetFlavorTotal) const
+    {
+        // Ingredient count and flavor each make up 50% of the score
+        const float IngredientScore = FMath::Clamp(static_cast<float>(TotalQuantity) / static_cast<float>(MinIngredientCount), 0.0f, 1.0f);
+        const float FlavorScore = FMath::Clamp(TargetFlavorTotal / MinFlavorValue, 0.0f, 1.0f);
+        return IngredientScore * 0.5f + FlavorScore * 0.5f;
+    }
+
     // Debug methods
     void LogOrderDetails() const;
 
@@ -13,6 +13,33 @@ float UPUOrderBlueprintLibrary::GetSatisfactionScore(const FPUOrderBase& Order,
     return Order.GetSatisfactionScore(Dish);
 }
 
+TArray<bool> UPUOrderBlueprintLibrary::ValidateDishes(const FPUOrderBase& Order, const TArray<FPUDishBase>& Dishes)
+{
+    TArray<bool> Results;
+    Results.SetNumZeroed(Dishes.Num());
+    Order.ValidateDishes(Dishes, Results);
+    return Results;
+}
+
+TArray<float> UPUOrderBlueprintLibrary::GetSatisfactionScores(const FPUOrderBase& Order, const TArray<FPUDishBase>& Dishes)
+{
+    TArray<float> Results;
+    Results.SetNumZeroed(Dishes.Num());
+    Order.GetSatisfactionScores(Dishes, Results);
+    return Results;
+}
+
+FPUDishSearchResult UPUOrderBlueprintLibrary::FindBestDishesForOrder(const FPUOrderBase& Order, const FPUDishSearchSpace& SearchSpace, UDataTable* IngredientDataTable)
+{
+    FPUDishScoringEngine Engine;
+    if (!Engine.Prepare(SearchSpace, IngredientDataTable))
+    {
+        //UE_LOG(LogTemp,Warning, TEXT("UPUOrderBlueprintLibrary::FindBestDishesForOrder - Nothing to search (no ingredients resolved or space too large)"));
+        return FPUDishSearchResult();
+    }
+    return Engine.Search(Order);
+}
+
 void UPUOrderBlueprintLibrary::LogOrderDetails(const FPUOrderBase& Order)
 {
     //UE_LOG(LogTemp,Log, TEXT("UPUOrderBlueprintLibrary::LogOrderDetails - Called from Blueprint"));
@@ -4,6 +4,7 @@
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "PUOrderBase.h"
 #include "PUDishBase.h"
+#include "PUDishScoring.h"
 #include "PUOrderBlueprintLibrary.generated.h"
 
 /**
@@ -23,6 +24,19 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Order|Validation")
     static float GetSatisfactionScore(const FPUOrderBase& Order, const FPUDishBase& Dish);
 
+    /** Validate many dishes against an order (scored in parallel) */
+    UFUNCTION(BlueprintCallable, Category = "Order|Validation")
+    static TArray<bool> ValidateDishes(const FPUOrderBase& Order, const TArray<FPUDishBase>& Dishes);
+
+    /** Calculate satisfaction scores for many dishes against an order (scored in parallel) */
+    UFUNCTION(BlueprintCallable, Category = "Order|Validation")
+    static TArray<float> GetSatisfactionScores(const FPUOrderBase& Order, const TArray<FPUDishBase>& Dishes);
+
+    /** Search combinations of unlocked ingredients, preparations, quantities and time/temp states for the dishes
+     *  that best satisfy an order. Blocks until done - meant for difficulty tuning, tools and hints. */
+    UFUNCTION(BlueprintCallable, Category = "Order|Validation")
+    static FPUDishSearchResult FindBestDishesForOrder(const FPUOrderBase& Order, const FPUDishSearchSpace& SearchSpace, UDataTable* IngredientDataTable);
+
     /** Log order details for debugging */
     UFUNCTION(BlueprintCallable, Category = "Order|Debug")
     static void LogOrderDetails(const FPUOrderBase& Order);
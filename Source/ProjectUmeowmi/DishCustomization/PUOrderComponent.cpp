@@ -2,7 +2,9 @@
 #include "PUOrderBlueprintLibrary.h"
 #include "PUDishBlueprintLibrary.h"
 #include "Engine/Engine.h"
+#include "Async/Async.h"
 #include "../ProjectUmeowmiCharacter.h"
+#include "../PUProjectUmeowmiGameInstance.h"
 
 UPUOrderComponent::UPUOrderComponent()
 {
@@ -10,7 +12,7 @@ UPUOrderComponent::UPUOrderComponent()
     
     // Set default values
     DefaultMinIngredients = 3;
-    DefaultTargetFlavor = FName(TEXT("Saltiness"));
+    DefaultTargetFlavor = FName(TEXT("Salt"));
     DefaultMinFlavorValue = 5.0f;
     DefaultOrderDescription = FText::FromString(TEXT("Make me congee with {0} ingredients. Make it {1}."));
     
@@ -24,6 +26,16 @@ void UPUOrderComponent::BeginPlay()
     //UE_LOG(LogTemp,Log, TEXT("UPUOrderComponent::BeginPlay - Order component initialized"));
 }
 
+void UPUOrderComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    // Drop any search still running in the background
+    ++OrderRequestSerial;
+    bGeneratingOrder = false;
+    bSolvableOrderReady = false;
+
+    Super::EndPlay(EndPlayReason);
+}
+
 void UPUOrderComponent::GenerateNewOrder()
 {
     //UE_LOG(LogTemp,Log, TEXT("UPUOrderComponent::GenerateNewOrder - Starting order generation"));
@@ -69,6 +81,9 @@ void UPUOrderComponent::GenerateNewOrder()
     
     // Broadcast the event
     OnOrderGenerated.Broadcast(CurrentOrder);
+    
+    // Start on the next order's targets while this one is being made
+    RequestSolvableOrder();
 }
 
 void UPUOrderComponent::ClearCurrentOrder()
@@ -78,6 +93,7 @@ void UPUOrderComponent::ClearCurrentOrder()
     // Properly clean up UObject references before clearing
     //UE_LOG(LogTemp,Display, TEXT("UPUOrderComponent::ClearCurrentOrder - Cleaning up UObject references"));
     
+    // Ingredient instances hold no UObject references (they share their definition by tag), only the dishes do
     // Clear UObject references in the completed dish
     if (CurrentOrder.CompletedDish.PreviewTexture)
     {
@@ -88,26 +104,6 @@ void UPUOrderComponent::ClearCurrentOrder()
         CurrentOrder.CompletedDish.IngredientDataTable = nullptr;
     }
     
-    // Clear UObject references in all ingredient instances
-    for (FIngredientInstance& Instance : CurrentOrder.CompletedDish.IngredientInstances)
-    {
-        if (Instance.IngredientData.PreviewTexture)
-        {
-            Instance.IngredientData.PreviewTexture = nullptr;
-        }
-        if (Instance.IngredientData.MaterialInstance.IsValid())
-        {
-            Instance.IngredientData.MaterialInstance = nullptr;
-        }
-        if (Instance.IngredientData.IngredientMesh.IsValid())
-        {
-            Instance.IngredientData.IngredientMesh = nullptr;
-        }
-        if (Instance.IngredientData.PreparationDataTable.IsValid())
-        {
-            Instance.IngredientData.PreparationDataTable = nullptr;
-        }
-    }
     
     // Clear UObject references in the base dish
     if (CurrentOrder.BaseDish.PreviewTexture)
@@ -119,26 +115,6 @@ void UPUOrderComponent::ClearCurrentOrder()
         CurrentOrder.BaseDish.IngredientDataTable = nullptr;
     }
     
-    // Clear UObject references in base dish ingredient instances
-    for (FIngredientInstance& Instance : CurrentOrder.BaseDish.IngredientInstances)
-    {
-        if (Instance.IngredientData.PreviewTexture)
-        {
-            Instance.IngredientData.PreviewTexture = nullptr;
-        }
-        if (Instance.IngredientData.MaterialInstance.IsValid())
-        {
-            Instance.IngredientData.MaterialInstance = nullptr;
-        }
-        if (Instance.IngredientData.IngredientMesh.IsValid())
-        {
-            Instance.IngredientData.IngredientMesh = nullptr;
-        }
-        if (Instance.IngredientData.PreparationDataTable.IsValid())
-        {
-            Instance.IngredientData.PreparationDataTable = nullptr;
-        }
-    }
     
     // Now safely clear the order data
     CurrentOrder = FPUOrderBase();
@@ -210,7 +186,7 @@ void UPUOrderComponent::GenerateSimpleOrder()
         BaseDish.DishTag = DishTag;
         BaseDish.DisplayName = FText::FromString(DishTag.ToString());
         BaseDish.IngredientDataTable = nullptr; // Ensure no ingredient data table
-        BaseDish.IngredientInstances.Empty(); // Ensure no ingredient instances
+        BaseDish.ClearInstances(); // Ensure no ingredient instances
         //UE_LOG(LogTemp,Log, TEXT("UPUOrderComponent::GenerateSimpleOrder - Created fallback dish: %s"), *BaseDish.DisplayName.ToString());
     }
     else
@@ -218,14 +194,28 @@ void UPUOrderComponent::GenerateSimpleOrder()
         //UE_LOG(LogTemp,Log, TEXT("UPUOrderComponent::GenerateSimpleOrder - Successfully got base dish: %s"), *BaseDish.DisplayName.ToString());
     }
     
+    // Use the background search's targets if one finished, otherwise the fixed defaults
+    int32 MinIngredients = DefaultMinIngredients;
+    FName TargetFlavor = DefaultTargetFlavor;
+    float MinFlavorValue = DefaultMinFlavorValue;
+    if (bSolvableOrderReady)
+    {
+        MinIngredients = SolvableOrder.MinIngredientCount;
+        TargetFlavor = SolvableOrder.TargetFlavorProperty;
+        MinFlavorValue = SolvableOrder.MinFlavorValue;
+        bSolvableOrderReady = false;
+        //UE_LOG(LogTemp,Log, TEXT("UPUOrderComponent::GenerateSimpleOrder - Using solvable targets: %s >= %.1f (difficulty %.2f)"), 
+        //    *TargetFlavor.ToString(), MinFlavorValue, SolvableOrder.Difficulty);
+    }
+    
     // Create a unique order ID
     FName OrderID = FName(*FString::Printf(TEXT("Order_%d"), FMath::RandRange(1000, 9999)));
     
     // Create the dialogue text with the specific dish name
     FText DialogueText = FText::Format(
         DefaultOrderDescription,
-        FText::AsNumber(DefaultMinIngredients),
-        FText::FromString(DefaultTargetFlavor.ToString())
+        FText::AsNumber(MinIngredients),
+        FText::FromString(TargetFlavor.ToString())
     );
     
     //UE_LOG(LogTemp,Log, TEXT("UPUOrderComponent::GenerateSimpleOrder - Creating order with ID: %s for dish: %s"), 
@@ -235,9 +225,9 @@ void UPUOrderComponent::GenerateSimpleOrder()
     CurrentOrder = UPUOrderBlueprintLibrary::CreateSimpleOrder(
         OrderID,
         FText::FromString(FString::Printf(TEXT("Simple %s order"), *DishTag.ToString())),
-        DefaultMinIngredients,
-        DefaultTargetFlavor,
-        DefaultMinFlavorValue,
+        MinIngredients,
+        TargetFlavor,
+        MinFlavorValue,
         DialogueText
     );
     
@@ -257,9 +247,134 @@ void UPUOrderComponent::GenerateSimpleOrder()
     for (int32 i = 0; i < BaseDish.IngredientInstances.Num(); i++)
     {
         const FIngredientInstance& Instance = BaseDish.IngredientInstances[i];
-        // Use convenient field if available, fallback to data field
-        FGameplayTag InstanceTag = Instance.IngredientTag.IsValid() ? Instance.IngredientTag : Instance.IngredientData.IngredientTag;
+        FGameplayTag InstanceTag = Instance.IngredientTag;
         //UE_LOG(LogTemp,Log, TEXT("    - Instance %d: %s (Qty: %d)"), 
         //    i, *InstanceTag.ToString(), Instance.Quantity);
     }
-} 
\ No newline at end of file
+}
+
+void UPUOrderComponent::RequestSolvableOrder()
+{
+    if (!bGenerateSolvableOrders || bGeneratingOrder || bSolvableOrderReady)
+    {
+        return;
+    }
+
+    if (!IngredientDataTable || !IsValid(IngredientDataTable))
+    {
+        //UE_LOG(LogTemp,Warning, TEXT("UPUOrderComponent::RequestSolvableOrder - IngredientDataTable is not set, orders will use the defaults"));
+        return;
+    }
+
+    // Bake the reachable dish space here - it reads data tables and subsystems, which the background task must not
+    TSharedRef<FPUOrderGenerator> Generator = MakeShared<FPUOrderGenerator>();
+    if (!Generator->Prepare(SolvableOrderSettings, GetUnlockedIngredientTags(), IngredientDataTable, FMath::Rand()))
+    {
+        //UE_LOG(LogTemp,Warning, TEXT("UPUOrderComponent::RequestSolvableOrder - No unlocked ingredients could be resolved"));
+        return;
+    }
+
+    bGeneratingOrder = true;
+    const int32 RequestSerial = OrderRequestSerial;
+    TWeakObjectPtr<UPUOrderComponent> WeakThis(this);
+
+    Async(EAsyncExecution::ThreadPool, [Generator, WeakThis, RequestSerial]()
+    {
+        const FPUOrderGenerationResult Result = Generator->Run();
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Result, RequestSerial]()
+        {
+            if (UPUOrderComponent* OrderComponent = WeakThis.Get())
+            {
+                OrderComponent->HandleSolvableOrderGenerated(Result, RequestSerial);
+            }
+        });
+    });
+}
+
+void UPUOrderComponent::HandleSolvableOrderGenerated(const FPUOrderGenerationResult& Result, int32 RequestSerial)
+{
+    if (RequestSerial != OrderRequestSerial)
+    {
+        return;
+    }
+
+    bGeneratingOrder = false;
+    SolvableOrder = Result;
+    if (SolvableOrder.bSolvable && !VerifySolvableOrder(SolvableOrder))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("UPUOrderComponent::HandleSolvableOrderGenerated - Solution dish fails its own order (%s >= %.1f), using the defaults"),
+            *SolvableOrder.TargetFlavorProperty.ToString(), SolvableOrder.MinFlavorValue);
+        SolvableOrder.bSolvable = false;
+    }
+    bSolvableOrderReady = SolvableOrder.bSolvable;
+
+    //UE_LOG(LogTemp,Log, TEXT("UPUOrderComponent::HandleSolvableOrderGenerated - %s: %s >= %.1f, difficulty %.2f (%lld dishes in %.1f ms)"), 
+    //    Result.bSolvable ? TEXT("Solvable") : TEXT("Unsolvable"), *Result.TargetFlavorProperty.ToString(), Result.MinFlavorValue, 
+    //    Result.Difficulty, Result.CandidatesEvaluated, Result.ElapsedSeconds * 1000.0f);
+
+    OnSolvableOrderReady.Broadcast(SolvableOrder);
+}
+
+bool UPUOrderComponent::VerifySolvableOrder(const FPUOrderGenerationResult& Result) const
+{
+    if (Result.Solution.Num() == 0)
+    {
+        return false;
+    }
+
+    const FPUOrderBase Order = UPUOrderBlueprintLibrary::CreateSimpleOrder(NAME_None, FText::GetEmpty(),
+        Result.MinIngredientCount, Result.TargetFlavorProperty, Result.MinFlavorValue, FText::GetEmpty());
+
+    // Rebuild the solution the way the customization component would: prepared catalog row, then time/temp on top
+    FPUDishBase SolutionDish;
+    SolutionDish.IngredientDataTable = IngredientDataTable;
+    for (const FPUDishCandidateItem& Item : Result.Solution)
+    {
+        FGameplayTagContainer Preparations;
+        if (Item.PreparationTag.IsValid())
+        {
+            Preparations.AddTag(Item.PreparationTag);
+        }
+
+        const FIngredientInstance Added = UPUDishBlueprintLibrary::AddIngredient(SolutionDish, Item.IngredientTag, Preparations);
+        const int32 InstanceIndex = SolutionDish.FindInstanceIndexByID(Added.InstanceID);
+        if (Added.InstanceID == 0 || InstanceIndex == INDEX_NONE)
+        {
+            return false;
+        }
+
+        SolutionDish.ModifyInstanceAt(InstanceIndex, [&Item](FIngredientInstance& Instance)
+        {
+            Instance.Quantity = Item.Quantity;
+            Instance.TimeValue = Item.TimeValue;
+            Instance.TemperatureValue = Item.TemperatureValue;
+            Instance.SetAspectVector(Instance.CalculateTimeTempModifiedAspectVector(Item.TimeValue, Item.TemperatureValue));
+        });
+    }
+
+    return Order.ValidateDish(SolutionDish);
+}
+
+TArray<FGameplayTag> UPUOrderComponent::GetUnlockedIngredientTags() const
+{
+    TArray<FGameplayTag> IngredientTags;
+
+    UWorld* World = GetWorld();
+    UPUProjectUmeowmiGameInstance* GameInstance = World ? Cast<UPUProjectUmeowmiGameInstance>(World->GetGameInstance()) : nullptr;
+    if (GameInstance)
+    {
+        IngredientTags = GameInstance->GetUnlockedIngredients().Array();
+        return IngredientTags;
+    }
+
+    // No game instance (editor or early startup) - same rule as the customization component: everything is available
+    if (IngredientDataTable)
+    {
+        IngredientDataTable->ForeachRow<FPUIngredientBase>(TEXT("GetUnlockedIngredientTags"), [&IngredientTags](const FName& RowName, const FPUIngredientBase& Ingredient)
+        {
+            IngredientTags.Add(Ingredient.IngredientTag);
+        });
+    }
+    return IngredientTags;
+}
@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "Components/SceneComponent.h"
 #include "PUOrderBase.h"
+#include "PUOrderGenerator.h"
 #include "PUOrderComponent.generated.h"
 
 // Forward declarations
@@ -10,6 +11,7 @@ class AProjectUmeowmiCharacter;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnOrderGenerated, const FPUOrderBase&, NewOrder);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnOrderCompleted, const FPUOrderBase&, CompletedOrder);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSolvableOrderReady, const FPUOrderGenerationResult&, Result);
 
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class PROJECTUMEOWMI_API UPUOrderComponent : public USceneComponent
@@ -21,10 +23,23 @@ public:
 
     virtual void BeginPlay() override;
 
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
     // Order Management
     UFUNCTION(BlueprintCallable, Category = "Order System")
     void GenerateNewOrder();
 
+    // Start picking the next order's targets on a background task (no-op if one is ready or in flight).
+    // GenerateNewOrder uses the result if it is ready, otherwise it falls back to the defaults.
+    UFUNCTION(BlueprintCallable, Category = "Order System")
+    void RequestSolvableOrder();
+
+    UFUNCTION(BlueprintCallable, Category = "Order System")
+    bool HasSolvableOrderReady() const { return bSolvableOrderReady; }
+
+    UFUNCTION(BlueprintCallable, Category = "Order System")
+    bool IsGeneratingOrder() const { return bGeneratingOrder; }
+
     UFUNCTION(BlueprintCallable, Category = "Order System")
     void ClearCurrentOrder();
 
@@ -49,16 +64,27 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "Order System")
     FOnOrderCompleted OnOrderCompleted;
 
+    // Fires on the game thread when a background order search finishes (solvable or not)
+    UPROPERTY(BlueprintAssignable, Category = "Order System")
+    FOnSolvableOrderReady OnSolvableOrderReady;
+
     // Order Generation Settings
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Order System|Generation")
     int32 DefaultMinIngredients = 3;
 
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Order System|Generation")
-    FName DefaultTargetFlavor = FName(TEXT("Saltiness"));
+    FName DefaultTargetFlavor = FName(TEXT("Salt"));
 
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Order System|Generation")
     float DefaultMinFlavorValue = 5.0f;
 
+    // Pick targets the player can meet with their unlocked ingredients (see RequestSolvableOrder)
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Order System|Generation")
+    bool bGenerateSolvableOrders = true;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Order System|Generation", meta = (EditCondition = "bGenerateSolvableOrders"))
+    FPUOrderGenerationSettings SolvableOrderSettings;
+
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Order System|Generation")
     FText DefaultOrderDescription = FText::FromString(TEXT("Make me congee with {0} ingredients. Make it {1}."));
 
@@ -82,4 +108,22 @@ protected:
 
     // Order generation
     void GenerateSimpleOrder();
+
+private:
+    // Unlocked ingredients from the game instance (every ingredient row if there is none)
+    TArray<FGameplayTag> GetUnlockedIngredientTags() const;
+
+    void HandleSolvableOrderGenerated(const FPUOrderGenerationResult& Result, int32 RequestSerial);
+
+    // Build the order a search result describes and check its solution dish against it with the real dish path
+    // (catalog rows, preparations, time/temp), so an order is never offered that the game itself would reject
+    bool VerifySolvableOrder(const FPUOrderGenerationResult& Result) const;
+
+    // Latest finished background search, consumed by the next GenerateSimpleOrder
+    FPUOrderGenerationResult SolvableOrder;
+    bool bSolvableOrderReady = false;
+    bool bGeneratingOrder = false;
+
+    // Bumped on EndPlay so results of searches started before it are dropped
+    int32 OrderRequestSerial = 0;
 }; 
\ No newline at end of file
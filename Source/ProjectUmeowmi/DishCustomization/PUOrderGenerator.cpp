@@ -0,0 +1,125 @@
+#include "PUOrderGenerator.h"
+#include "PUAspectVector.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+// Debug output toggles (kept in code, but disabled by default to avoid log spam).
+namespace
+{
+    // Enables a summary log line for every generated order target.
+    constexpr bool bPU_LogOrderGeneration = false;
+}
+
+bool FPUOrderGenerator::Prepare(const FPUOrderGenerationSettings& InSettings, const TArray<FGameplayTag>& UnlockedIngredients, const UDataTable* IngredientDataTable, int32 InRandomSeed)
+{
+    Settings = InSettings;
+    Settings.MinIngredientCount = FMath::Max(1, Settings.MinIngredientCount);
+    Settings.MinDifficulty = FMath::Clamp(Settings.MinDifficulty, 0.0f, 1.0f);
+    Settings.MaxDifficulty = FMath::Clamp(Settings.MaxDifficulty, Settings.MinDifficulty, 1.0f);
+    Settings.TimeBudgetSeconds = FMath::Max(0.001f, Settings.TimeBudgetSeconds);
+    Settings.SearchSpace.Ingredients = UnlockedIngredients;
+    RandomSeed = InRandomSeed;
+
+    return Engine.Prepare(Settings.SearchSpace, IngredientDataTable);
+}
+
+FPUOrderGenerationResult FPUOrderGenerator::Run() const
+{
+    FPUOrderGenerationResult Result;
+    Result.MinIngredientCount = Settings.MinIngredientCount;
+
+    const double StartTime = FPlatformTime::Seconds();
+    const double Deadline = StartTime + Settings.TimeBudgetSeconds;
+
+    FRandomStream Random(RandomSeed);
+
+    TArray<FName> Flavors = Settings.TargetFlavors;
+    for (int32 Index = Flavors.Num() - 1; Index > 0; --Index)
+    {
+        Flavors.Swap(Index, Random.RandRange(0, Index));
+    }
+
+    // How far outside the band the best fallback is
+    float BestBandDistance = TNumericLimits<float>::Max();
+    TArray<float> Totals;
+
+    for (const FName& Flavor : Flavors)
+    {
+        if (FPlatformTime::Seconds() >= Deadline)
+        {
+            Result.bTimedOut = true;
+            break;
+        }
+
+        const int32 LaneIndex = PUAspects::ResolveFlavorIndex(Flavor);
+        if (LaneIndex == INDEX_NONE)
+        {
+            continue;
+        }
+
+        uint64 BestCandidateIndex = 0;
+        const int64 NumEvaluated = Engine.SampleLaneTotals(LaneIndex, Settings.MinIngredientCount, Settings.MaxSamplesPerFlavor, Deadline, Totals, &BestCandidateIndex);
+        Result.CandidatesEvaluated += NumEvaluated;
+        if (NumEvaluated == 0 || Totals.Num() == 0)
+        {
+            continue;
+        }
+
+        Totals.Sort(TGreater<float>());
+
+        // Rates are over the reachable dishes only. NumEvaluated also counts candidates SampleLaneTotals rejected
+        // (below MinIngredientCount), which have no total, can't pass and aren't part of the difficulty.
+        const float NumReachable = static_cast<float>(Totals.Num());
+
+        // Threshold at the pass-rate quantile for a random difficulty inside the band
+        const float TargetPassRate = 1.0f - Random.FRandRange(Settings.MinDifficulty, Settings.MaxDifficulty);
+        const int32 ThresholdIndex = FMath::Clamp(FMath::CeilToInt(TargetPassRate * NumReachable) - 1, 0, Totals.Num() - 1);
+
+        // Round down to the half steps aspects use, so the sampled dish still passes
+        const float Threshold = FMath::FloorToFloat(Totals[ThresholdIndex] * 2.0f) / 2.0f;
+        if (Threshold <= 0.0f)
+        {
+            // Every dish would pass - not a real order for this flavor
+            continue;
+        }
+
+        int32 NumPassing = ThresholdIndex + 1;
+        while (NumPassing < Totals.Num() && Totals[NumPassing] >= Threshold)
+        {
+            ++NumPassing;
+        }
+
+        const float Difficulty = 1.0f - static_cast<float>(NumPassing) / NumReachable;
+        const float BandDistance = FMath::Abs(Difficulty - FMath::Clamp(Difficulty, Settings.MinDifficulty, Settings.MaxDifficulty));
+        if (BandDistance >= BestBandDistance)
+        {
+            continue;
+        }
+
+        BestBandDistance = BandDistance;
+        Result.bSolvable = true;
+        Result.bInDifficultyBand = BandDistance == 0.0f;
+        Result.TargetFlavorProperty = Flavor;
+        Result.MinFlavorValue = Threshold;
+        Result.Difficulty = Difficulty;
+
+        // The highest sampled total is at or above the threshold, so its dish is a known solution
+        Result.Solution = Engine.GetCandidateItems(BestCandidateIndex);
+
+        if (Result.bInDifficultyBand)
+        {
+            break;
+        }
+    }
+
+    Result.ElapsedSeconds = static_cast<float>(FPlatformTime::Seconds() - StartTime);
+
+    if (bPU_LogOrderGeneration)
+    {
+        UE_LOG(LogTemp, Display, TEXT("FPUOrderGenerator::Run - %s: %s >= %.1f, difficulty %.2f (%lld dishes, %.1f ms%s)"),
+            Result.bSolvable ? TEXT("Solvable") : TEXT("Unsolvable"), *Result.TargetFlavorProperty.ToString(), Result.MinFlavorValue,
+            Result.Difficulty, Result.CandidatesEvaluated, Result.ElapsedSeconds * 1000.0f, Result.bTimedOut ? TEXT(", timed out") : TEXT(""));
+    }
+
+    return Result;
+}
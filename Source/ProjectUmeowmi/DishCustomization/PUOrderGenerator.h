@@ -0,0 +1,105 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "PUDishScoring.h"
+#include "PUOrderGenerator.generated.h"
+
+class UDataTable;
+
+// Tuning for orders picked from the dishes the player can actually make
+USTRUCT(BlueprintType)
+struct PROJECTUMEOWMI_API FPUOrderGenerationSettings
+{
+    GENERATED_BODY()
+
+    // Flavors an order may ask for (tried in random order until one lands in the difficulty band)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Order Generation")
+    TArray<FName> TargetFlavors = { TEXT("Umami"), TEXT("Salt"), TEXT("Sweet"), TEXT("Sour"), TEXT("Bitter"), TEXT("Spicy") };
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Order Generation", meta = (ClampMin = "1"))
+    int32 MinIngredientCount = 3;
+
+    // Difficulty is the share of reachable dishes that fail the order (0 = anything works, 1 = almost nothing does)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Order Generation", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+    float MinDifficulty = 0.5f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Order Generation", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+    float MaxDifficulty = 0.9f;
+
+    // Wall-clock budget for the background search. When it runs out the best target found so far is used.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Order Generation", meta = (ClampMin = "0.001"))
+    float TimeBudgetSeconds = 0.05f;
+
+    // Candidate dishes sampled per flavor
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Order Generation", meta = (ClampMin = "1"))
+    int64 MaxSamplesPerFlavor = 200000;
+
+    // Preparations, quantities and dish size to search. Ingredients is filled in from the unlocked set.
+    // Leave Preparations empty to only count dishes made from raw ingredients.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Order Generation")
+    FPUDishSearchSpace SearchSpace;
+};
+
+USTRUCT(BlueprintType)
+struct PROJECTUMEOWMI_API FPUOrderGenerationResult
+{
+    GENERATED_BODY()
+
+    // True if at least one sampled dish of unlocked ingredients meets the targets below
+    UPROPERTY(BlueprintReadOnly, Category = "Order Generation")
+    bool bSolvable = false;
+
+    // False if no flavor could be placed inside the band (the closest one is returned instead)
+    UPROPERTY(BlueprintReadOnly, Category = "Order Generation")
+    bool bInDifficultyBand = false;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Order Generation")
+    int32 MinIngredientCount = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Order Generation")
+    FName TargetFlavorProperty;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Order Generation")
+    float MinFlavorValue = 0.0f;
+
+    // A sampled dish that meets the targets (the one with the most of the target flavor), empty if unsolvable
+    UPROPERTY(BlueprintReadOnly, Category = "Order Generation")
+    TArray<FPUDishCandidateItem> Solution;
+
+    // Measured share of sampled dishes that fail the order
+    UPROPERTY(BlueprintReadOnly, Category = "Order Generation")
+    float Difficulty = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Order Generation")
+    int64 CandidatesEvaluated = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Order Generation")
+    bool bTimedOut = false;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Order Generation")
+    float ElapsedSeconds = 0.0f;
+};
+
+/**
+ * Picks order targets the player can meet with what they have unlocked.
+ *
+ * Prepare() runs on the game thread and bakes the reachable dish space (see FPUDishScoringEngine).
+ * Run() touches no UObjects, so it is safe on a background task: for each flavor it samples the dish totals,
+ * then sets MinFlavorValue at the quantile that gives a pass rate inside the difficulty band.
+ * The threshold is always the total of a sampled dish, so a returned solvable order has a known solution.
+ */
+class PROJECTUMEOWMI_API FPUOrderGenerator
+{
+public:
+    // Bake the dish space for the unlocked ingredients. Returns false if none of them can be resolved.
+    bool Prepare(const FPUOrderGenerationSettings& InSettings, const TArray<FGameplayTag>& UnlockedIngredients, const UDataTable* IngredientDataTable, int32 InRandomSeed);
+
+    // Search for targets within the difficulty band, bounded by the settings' time budget
+    FPUOrderGenerationResult Run() const;
+
+private:
+    FPUOrderGenerationSettings Settings;
+    FPUDishScoringEngine Engine;
+    int32 RandomSeed = 0;
+};
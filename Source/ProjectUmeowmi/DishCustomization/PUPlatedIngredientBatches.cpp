@@ -0,0 +1,163 @@
+#include "PUPlatedIngredientBatches.h"
+#include "PUIngredientMesh.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/SceneComponent.h"
+#include "Engine/HitResult.h"
+#include "Engine/World.h"
+
+FPUPlatedIngredientBatch* FPUPlatedIngredientBatches::FindOrAddBatch(UWorld* World, AActor* Owner, UStaticMesh* Mesh, UMaterialInterface* Material, const UPrimitiveComponent* SourceComponent)
+{
+    for (FPUPlatedIngredientBatch& Batch : Batches)
+    {
+        if (Batch.Mesh == Mesh && Batch.Material == Material && IsValid(Batch.Component))
+        {
+            return &Batch;
+        }
+    }
+
+    if (!IsValid(HostActor))
+    {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.Owner = Owner;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        HostActor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+        if (!HostActor)
+        {
+            return nullptr;
+        }
+
+        USceneComponent* Root = NewObject<USceneComponent>(HostActor, TEXT("PlatedBatchesRoot"));
+        Root->SetMobility(EComponentMobility::Movable);
+        HostActor->SetRootComponent(Root);
+        Root->RegisterComponent();
+    }
+
+    UInstancedStaticMeshComponent* Component = NewObject<UInstancedStaticMeshComponent>(HostActor);
+    Component->SetMobility(EComponentMobility::Movable);
+    Component->SetStaticMesh(Mesh);
+    if (Material)
+    {
+        Component->SetMaterial(0, Material);
+    }
+
+    // Instance indices must stay in step with Pieces, so removal is always the last-into-the-gap swap
+    Component->bSupportRemoveAtSwap = true;
+
+    // Settled pieces still have to hold up the pieces dropped on top of them, so use the pieces' blocking profile
+    // (static bodies - instances never simulate) and keep the Visibility block the plating mouse trace needs
+    if (SourceComponent)
+    {
+        Component->SetCollisionProfileName(SourceComponent->GetCollisionProfileName());
+        Component->SetCollisionResponseToChannels(SourceComponent->GetCollisionResponseToChannels());
+    }
+    Component->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+    Component->SetCollisionResponseToChannel(ECC_Visibility, ECR_Block);
+
+    Component->SetupAttachment(HostActor->GetRootComponent());
+    Component->RegisterComponent();
+    HostActor->AddInstanceComponent(Component);
+
+    FPUPlatedIngredientBatch& Batch = Batches.AddDefaulted_GetRef();
+    Batch.Component = Component;
+    Batch.Mesh = Mesh;
+    Batch.Material = Material;
+    return &Batch;
+}
+
+bool FPUPlatedIngredientBatches::AddPiece(UWorld* World, AActor* Owner, const APUIngredientMesh* Piece)
+{
+    const UStaticMeshComponent* MeshComponent = Piece ? Piece->GetMeshComponent() : nullptr;
+    UStaticMesh* Mesh = MeshComponent ? MeshComponent->GetStaticMesh() : nullptr;
+    if (!World || !Mesh)
+    {
+        return false;
+    }
+
+    FPUPlatedIngredientBatch* Batch = FindOrAddBatch(World, Owner, Mesh, MeshComponent->GetMaterial(0), MeshComponent);
+    if (!Batch)
+    {
+        return false;
+    }
+
+    FPUPlatedPiece& Batched = Batch->Pieces.AddDefaulted_GetRef();
+    Batched.InstanceID = Piece->GetInstanceID();
+    Batched.Transform = Piece->GetActorTransform();
+
+    FPUPlatedIngredient& Ingredient = Batch->IngredientsByInstanceID.FindOrAdd(Batched.InstanceID);
+    if (Ingredient.NumPieces++ == 0)
+    {
+        Ingredient.IngredientData = Piece->GetIngredientData();
+    }
+    Batch->Component->AddInstance(Batched.Transform, /*bWorldSpace*/ true);
+    return true;
+}
+
+bool FPUPlatedIngredientBatches::IsBatchComponent(const UPrimitiveComponent* Component) const
+{
+    return Component && Batches.ContainsByPredicate([Component](const FPUPlatedIngredientBatch& Batch) { return Batch.Component == Component; });
+}
+
+bool FPUPlatedIngredientBatches::TakePiece(const FHitResult& Hit, FTransform& OutTransform, int32& OutInstanceID, FPUIngredientBase& OutIngredientData, UStaticMesh*& OutMesh, UMaterialInterface*& OutMaterial)
+{
+    const UPrimitiveComponent* HitComponent = Hit.GetComponent();
+    FPUPlatedIngredientBatch* Batch = Batches.FindByPredicate([HitComponent](const FPUPlatedIngredientBatch& Candidate) { return Candidate.Component == HitComponent; });
+    if (!Batch || !Batch->Pieces.IsValidIndex(Hit.Item))
+    {
+        return false;
+    }
+
+    const FPUPlatedPiece& Piece = Batch->Pieces[Hit.Item];
+    OutTransform = Piece.Transform;
+    OutInstanceID = Piece.InstanceID;
+    if (FPUPlatedIngredient* Ingredient = Batch->IngredientsByInstanceID.Find(Piece.InstanceID))
+    {
+        if (--Ingredient->NumPieces <= 0)
+        {
+            OutIngredientData = MoveTemp(Ingredient->IngredientData);
+            Batch->IngredientsByInstanceID.Remove(Piece.InstanceID);
+        }
+        else
+        {
+            OutIngredientData = Ingredient->IngredientData;
+        }
+    }
+    OutMesh = Batch->Mesh;
+    OutMaterial = Batch->Material;
+
+    Batch->Component->RemoveInstance(Hit.Item);
+    Batch->Pieces.RemoveAtSwap(Hit.Item, 1, EAllowShrinking::No);
+    return true;
+}
+
+void FPUPlatedIngredientBatches::Clear()
+{
+    for (FPUPlatedIngredientBatch& Batch : Batches)
+    {
+        if (IsValid(Batch.Component))
+        {
+            Batch.Component->ClearInstances();
+        }
+        Batch.Pieces.Reset();
+        Batch.IngredientsByInstanceID.Reset();
+    }
+}
+
+void FPUPlatedIngredientBatches::DestroyAll()
+{
+    if (IsValid(HostActor))
+    {
+        HostActor->Destroy();
+    }
+    HostActor = nullptr;
+    Batches.Empty();
+}
+
+int32 FPUPlatedIngredientBatches::GetNumPieces() const
+{
+    int32 NumPieces = 0;
+    for (const FPUPlatedIngredientBatch& Batch : Batches)
+    {
+        NumPieces += Batch.Pieces.Num();
+    }
+    return NumPieces;
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "PUIngredientBase.h"
+#include "PUPlatedIngredientBatches.generated.h"
+
+class AActor;
+class APUIngredientMesh;
+class UInstancedStaticMeshComponent;
+class UMaterialInterface;
+class UPrimitiveComponent;
+class UStaticMesh;
+class UWorld;
+struct FHitResult;
+
+// A settled plated piece drawn as one instance of a batch
+USTRUCT()
+struct PROJECTUMEOWMI_API FPUPlatedPiece
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    FTransform Transform;
+
+    // Key into the batch's IngredientsByInstanceID
+    UPROPERTY()
+    int32 InstanceID = 0;
+};
+
+// Ingredient data shared by every piece of one dish instance in a batch
+USTRUCT()
+struct PROJECTUMEOWMI_API FPUPlatedIngredient
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    FPUIngredientBase IngredientData;
+
+    // Pieces in the batch that point here; the entry goes when the last one is taken
+    UPROPERTY()
+    int32 NumPieces = 0;
+};
+
+// One instanced mesh component per (mesh, material) pair on the plate
+USTRUCT()
+struct PROJECTUMEOWMI_API FPUPlatedIngredientBatch
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TObjectPtr<UInstancedStaticMeshComponent> Component;
+
+    UPROPERTY()
+    TObjectPtr<UStaticMesh> Mesh;
+
+    UPROPERTY()
+    TObjectPtr<UMaterialInterface> Material;
+
+    // Parallel to the component's instances (kept in step with its remove-at-swap)
+    UPROPERTY()
+    TArray<FPUPlatedPiece> Pieces;
+
+    // One copy of the ingredient data per dish instance, not per piece (preparations can differ between instances
+    // of the same ingredient, so the key is the instance rather than the ingredient tag)
+    UPROPERTY()
+    TMap<int32, FPUPlatedIngredient> IngredientsByInstanceID;
+};
+
+/**
+ * Instanced rendering for settled plated ingredients: each piece that stops moving is folded into a per-mesh
+ * UInstancedStaticMeshComponent batch (one draw per mesh/material instead of one actor and component per piece),
+ * and pulled back out as a full actor when the player grabs it.
+ *
+ * Batches live on their own host actor, because the plating mouse trace ignores the station actor.
+ * Owned by UPUDishCustomizationComponent (see bUseInstancedPlatingRender).
+ */
+USTRUCT()
+struct PROJECTUMEOWMI_API FPUPlatedIngredientBatches
+{
+    GENERATED_BODY()
+
+    // Fold a settled actor into its batch. Returns false if it cannot be batched (no mesh); the actor is left as is.
+    // The piece's ingredient data is stored once per batch for its dish instance (APUIngredientMesh::GetInstanceID).
+    bool AddPiece(UWorld* World, AActor* Owner, const APUIngredientMesh* Piece);
+
+    // True if Component is one of the batches (so a trace hit on it is a batched piece)
+    bool IsBatchComponent(const UPrimitiveComponent* Component) const;
+
+    // Remove the instance under a trace hit. Fills the piece's transform, dish instance, ingredient data and the
+    // mesh/material it was drawn with (which may be a fallback or override the ingredient data doesn't name) for
+    // promotion to an actor.
+    bool TakePiece(const FHitResult& Hit, FTransform& OutTransform, int32& OutInstanceID, FPUIngredientBase& OutIngredientData, UStaticMesh*& OutMesh, UMaterialInterface*& OutMaterial);
+
+    // Drop every instance (components are kept for the next plate)
+    void Clear();
+
+    // Destroy the host actor and its batches
+    void DestroyAll();
+
+    int32 GetNumPieces() const;
+    int32 GetNumBatches() const { return Batches.Num(); }
+
+private:
+    // New batches copy SourceComponent's collision setup, so they block other pieces exactly like the actors did
+    FPUPlatedIngredientBatch* FindOrAddBatch(UWorld* World, AActor* Owner, UStaticMesh* Mesh, UMaterialInterface* Material, const UPrimitiveComponent* SourceComponent);
+
+    UPROPERTY()
+    TObjectPtr<AActor> HostActor;
+
+    UPROPERTY()
+    TArray<FPUPlatedIngredientBatch> Batches;
+};
@@ -52,81 +52,39 @@ FText FPUPreparationBase::GetModifiedName(const FText& BaseName) const
 }
 
 void FPUPreparationBase::ApplyModifiers(FFlavorAspects& FlavorAspects, FTextureAspects& TextureAspects) const
+{
+    FPUAspectVector Aspects = FPUIngredientBase::PackAspects(FlavorAspects, TextureAspects);
+    ApplyModifiers(Aspects);
+    FPUIngredientBase::UnpackAspects(Aspects, FlavorAspects, TextureAspects);
+}
+
+void FPUPreparationBase::RemoveModifiers(FFlavorAspects& FlavorAspects, FTextureAspects& TextureAspects) const
+{
+    FPUAspectVector Aspects = FPUIngredientBase::PackAspects(FlavorAspects, TextureAspects);
+    RemoveModifiers(Aspects);
+    FPUIngredientBase::UnpackAspects(Aspects, FlavorAspects, TextureAspects);
+}
+
+void FPUPreparationBase::ApplyModifiers(FPUAspectVector& Aspects) const
 {
     for (const FAspectModifier& Modifier : AspectModifiers)
     {
-        FName AspectName = Modifier.AspectName;
-        FString AspectStr = AspectName.ToString().ToLower();
-        
-        if (Modifier.AspectType == EAspectType::Flavor)
+        const int32 AspectIndex = Modifier.GetAspectIndex();
+        if (AspectIndex != INDEX_NONE)
         {
-            if (AspectStr == TEXT("umami"))
-                FlavorAspects.Umami = Modifier.ApplyModification(FlavorAspects.Umami);
-            else if (AspectStr == TEXT("sweet"))
-                FlavorAspects.Sweet = Modifier.ApplyModification(FlavorAspects.Sweet);
-            else if (AspectStr == TEXT("salt"))
-                FlavorAspects.Salt = Modifier.ApplyModification(FlavorAspects.Salt);
-            else if (AspectStr == TEXT("sour"))
-                FlavorAspects.Sour = Modifier.ApplyModification(FlavorAspects.Sour);
-            else if (AspectStr == TEXT("bitter"))
-                FlavorAspects.Bitter = Modifier.ApplyModification(FlavorAspects.Bitter);
-            else if (AspectStr == TEXT("spicy"))
-                FlavorAspects.Spicy = Modifier.ApplyModification(FlavorAspects.Spicy);
-        }
-        else // EAspectType::Texture
-        {
-            if (AspectStr == TEXT("rich"))
-                TextureAspects.Rich = Modifier.ApplyModification(TextureAspects.Rich);
-            else if (AspectStr == TEXT("juicy"))
-                TextureAspects.Juicy = Modifier.ApplyModification(TextureAspects.Juicy);
-            else if (AspectStr == TEXT("tender"))
-                TextureAspects.Tender = Modifier.ApplyModification(TextureAspects.Tender);
-            else if (AspectStr == TEXT("chewy"))
-                TextureAspects.Chewy = Modifier.ApplyModification(TextureAspects.Chewy);
-            else if (AspectStr == TEXT("crispy"))
-                TextureAspects.Crispy = Modifier.ApplyModification(TextureAspects.Crispy);
-            else if (AspectStr == TEXT("crumbly"))
-                TextureAspects.Crumbly = Modifier.ApplyModification(TextureAspects.Crumbly);
+            Aspects[AspectIndex] = Modifier.ApplyModification(Aspects[AspectIndex]);
         }
     }
 }
 
-void FPUPreparationBase::RemoveModifiers(FFlavorAspects& FlavorAspects, FTextureAspects& TextureAspects) const
+void FPUPreparationBase::RemoveModifiers(FPUAspectVector& Aspects) const
 {
     for (const FAspectModifier& Modifier : AspectModifiers)
     {
-        FName AspectName = Modifier.AspectName;
-        FString AspectStr = AspectName.ToString().ToLower();
-        
-        if (Modifier.AspectType == EAspectType::Flavor)
+        const int32 AspectIndex = Modifier.GetAspectIndex();
+        if (AspectIndex != INDEX_NONE)
         {
-            if (AspectStr == TEXT("umami"))
-                FlavorAspects.Umami = Modifier.RemoveModification(FlavorAspects.Umami);
-            else if (AspectStr == TEXT("sweet"))
-                FlavorAspects.Sweet = Modifier.RemoveModification(FlavorAspects.Sweet);
-            else if (AspectStr == TEXT("salt"))
-                FlavorAspects.Salt = Modifier.RemoveModification(FlavorAspects.Salt);
-            else if (AspectStr == TEXT("sour"))
-                FlavorAspects.Sour = Modifier.RemoveModification(FlavorAspects.Sour);
-            else if (AspectStr == TEXT("bitter"))
-                FlavorAspects.Bitter = Modifier.RemoveModification(FlavorAspects.Bitter);
-            else if (AspectStr == TEXT("spicy"))
-                FlavorAspects.Spicy = Modifier.RemoveModification(FlavorAspects.Spicy);
-        }
-        else // EAspectType::Texture
-        {
-            if (AspectStr == TEXT("rich"))
-                TextureAspects.Rich = Modifier.RemoveModification(TextureAspects.Rich);
-            else if (AspectStr == TEXT("juicy"))
-                TextureAspects.Juicy = Modifier.RemoveModification(TextureAspects.Juicy);
-            else if (AspectStr == TEXT("tender"))
-                TextureAspects.Tender = Modifier.RemoveModification(TextureAspects.Tender);
-            else if (AspectStr == TEXT("chewy"))
-                TextureAspects.Chewy = Modifier.RemoveModification(TextureAspects.Chewy);
-            else if (AspectStr == TEXT("crispy"))
-                TextureAspects.Crispy = Modifier.RemoveModification(TextureAspects.Crispy);
-            else if (AspectStr == TEXT("crumbly"))
-                TextureAspects.Crumbly = Modifier.RemoveModification(TextureAspects.Crumbly);
+            Aspects[AspectIndex] = Modifier.RemoveModification(Aspects[AspectIndex]);
         }
     }
-} 
\ No newline at end of file
+}
@@ -75,6 +75,46 @@ struct FAspectModifier
                 return ModifiedValue;
         }
     }
+
+    // Lane index in FPUAspectVector for AspectName/AspectType (INDEX_NONE if unknown).
+    // Resolved when the row is loaded and re-resolved only if AspectName/AspectType are edited afterwards.
+    int32 GetAspectIndex() const
+    {
+        if (ResolvedAspectName != AspectName || ResolvedAspectType != AspectType)
+        {
+            ResolveAspectIndex();
+        }
+        return ResolvedAspectIndex;
+    }
+
+    void ResolveAspectIndex() const
+    {
+        ResolvedAspectName = AspectName;
+        ResolvedAspectType = AspectType;
+        ResolvedAspectIndex = static_cast<int8>(PUAspects::ResolveAspectIndex(static_cast<uint8>(AspectType), AspectName));
+    }
+
+    void PostSerialize(const FArchive& Ar)
+    {
+        if (Ar.IsLoading())
+        {
+            ResolveAspectIndex();
+        }
+    }
+
+private:
+    mutable FName ResolvedAspectName = NAME_None;
+    mutable EAspectType ResolvedAspectType = EAspectType::Flavor;
+    mutable int8 ResolvedAspectIndex = INDEX_NONE;
+};
+
+template<>
+struct TStructOpsTypeTraits<FAspectModifier> : public TStructOpsTypeTraitsBase2<FAspectModifier>
+{
+    enum
+    {
+        WithPostSerialize = true,
+    };
 };
 
 // Preparation types enum
@@ -146,4 +186,6 @@ public:
     FText GetModifiedName(const FText& BaseName) const;
     void ApplyModifiers(FFlavorAspects& FlavorAspects, FTextureAspects& TextureAspects) const;
     void RemoveModifiers(FFlavorAspects& FlavorAspects, FTextureAspects& TextureAspects) const;
+    void ApplyModifiers(FPUAspectVector& Aspects) const;
+    void RemoveModifiers(FPUAspectVector& Aspects) const;
 }; 
\ No newline at end of file
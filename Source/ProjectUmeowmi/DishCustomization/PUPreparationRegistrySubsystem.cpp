@@ -0,0 +1,279 @@
+#include "PUPreparationRegistrySubsystem.h"
+#include "PUIngredientBase.h"
+#include "Engine/DataTable.h"
+
+// Debug output toggles (kept in code, but disabled by default to avoid log spam).
+namespace
+{
+    // Enables a summary log line whenever a preparation table is compiled.
+    constexpr bool bPU_LogPreparationCompile = false;
+}
+
+UPUPreparationRegistrySubsystem* UPUPreparationRegistrySubsystem::ActiveRegistry = nullptr;
+
+void UPUPreparationRegistrySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+    ActiveRegistry = this;
+}
+
+void UPUPreparationRegistrySubsystem::Deinitialize()
+{
+#if WITH_EDITOR
+    for (TPair<const UDataTable*, FPreparationTableIndex>& Pair : TableIndices)
+    {
+        if (IsValid(Pair.Key))
+        {
+            const_cast<UDataTable*>(Pair.Key)->OnDataTableChanged().Remove(Pair.Value.TableChangedHandle);
+        }
+    }
+#endif
+
+    TableIndices.Empty();
+    IndexedTables.Empty();
+
+    if (ActiveRegistry == this)
+    {
+        ActiveRegistry = nullptr;
+    }
+
+    Super::Deinitialize();
+}
+
+UPUPreparationRegistrySubsystem* UPUPreparationRegistrySubsystem::Get()
+{
+    return ActiveRegistry;
+}
+
+FName UPUPreparationRegistrySubsystem::GetPreparationRowNameFromTag(const FGameplayTag& PreparationTag)
+{
+    // Get the preparation name from the tag (everything after the last period) and convert to lowercase
+    const FString PrepFullTag = PreparationTag.ToString();
+    int32 PrepLastPeriodIndex;
+    if (PrepFullTag.FindLastChar('.', PrepLastPeriodIndex))
+    {
+        return FName(*PrepFullTag.RightChop(PrepLastPeriodIndex + 1).ToLower());
+    }
+    return NAME_None;
+}
+
+void UPUPreparationRegistrySubsystem::CompilePreparation(const FPUPreparationBase& Preparation, FPUCompiledPreparation& OutCompiled)
+{
+    OutCompiled.Row = &Preparation;
+    OutCompiled.Multiply = FPUAspectVector::Splat(1.0f);
+    OutCompiled.Add.SetZero();
+
+    // Compose x -> x * M + A in authoring order:
+    //   additive v:        A' = A + v
+    //   multiplicative v:  M' = M * v, A' = A * v
+    for (const FAspectModifier& Modifier : Preparation.AspectModifiers)
+    {
+        const int32 AspectIndex = Modifier.GetAspectIndex();
+        if (AspectIndex == INDEX_NONE)
+        {
+            continue;
+        }
+
+        switch (Modifier.ModificationType)
+        {
+            case EModificationType::Additive:
+                OutCompiled.Add[AspectIndex] += Modifier.ModificationValue;
+                break;
+            case EModificationType::Multiplicative:
+                OutCompiled.Multiply[AspectIndex] *= Modifier.ModificationValue;
+                OutCompiled.Add[AspectIndex] *= Modifier.ModificationValue;
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+const FPUCompiledPreparation* UPUPreparationRegistrySubsystem::FindPreparation(const UDataTable* PreparationDataTable, const FGameplayTag& PreparationTag)
+{
+    FPreparationTableIndex* Index = FindOrBuildIndex(PreparationDataTable);
+    if (!Index || !PreparationTag.IsValid())
+    {
+        return nullptr;
+    }
+
+    const int32* PrepIndex = Index->TagToIndex.Find(PreparationTag);
+    if (!PrepIndex)
+    {
+        // Tag was not declared on any row - resolve it by row name once and remember the result (including misses)
+        int32 ResolvedIndex = INDEX_NONE;
+        if (const FPUPreparationBase* Row = PreparationDataTable->FindRow<FPUPreparationBase>(GetPreparationRowNameFromTag(PreparationTag), TEXT("FindPreparation"), false))
+        {
+            ResolvedIndex = Index->Preparations.IndexOfByPredicate([Row](const FPUCompiledPreparation& Compiled) { return Compiled.Row == Row; });
+        }
+        PrepIndex = &Index->TagToIndex.Add(PreparationTag, ResolvedIndex);
+    }
+
+    return Index->Preparations.IsValidIndex(*PrepIndex) ? &Index->Preparations[*PrepIndex] : nullptr;
+}
+
+const FPUPreparationBase* UPUPreparationRegistrySubsystem::ResolvePreparation(const UDataTable* PreparationDataTable, const FGameplayTag& PreparationTag)
+{
+    if (!PreparationDataTable)
+    {
+        return nullptr;
+    }
+
+    if (UPUPreparationRegistrySubsystem* Registry = Get())
+    {
+        const FPUCompiledPreparation* Compiled = Registry->FindPreparation(PreparationDataTable, PreparationTag);
+        return Compiled ? Compiled->Row : nullptr;
+    }
+
+    return PreparationDataTable->FindRow<FPUPreparationBase>(GetPreparationRowNameFromTag(PreparationTag), TEXT("ResolvePreparation"), false);
+}
+
+const UDataTable* UPUPreparationRegistrySubsystem::ResolvePreparationTable(const TSoftObjectPtr<UDataTable>& PreparationDataTable)
+{
+    const UDataTable* Table = PreparationDataTable.Get();
+    if (!Table && !PreparationDataTable.IsNull())
+    {
+        Table = PreparationDataTable.LoadSynchronous();
+        if (!Table)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("UPUPreparationRegistrySubsystem::ResolvePreparationTable - Preparation data table '%s' could not be loaded"),
+                *PreparationDataTable.ToString());
+        }
+    }
+
+    // Compile and pin it now, so it cannot be collected between calls
+    if (Table)
+    {
+        if (UPUPreparationRegistrySubsystem* Registry = Get())
+        {
+            Registry->FindOrBuildIndex(Table);
+        }
+    }
+    return Table;
+}
+
+void UPUPreparationRegistrySubsystem::ApplyPreparations(const TSoftObjectPtr<UDataTable>& PreparationDataTable, const FGameplayTagContainer& Preparations, FPUAspectVector& Aspects)
+{
+    if (!Preparations.IsEmpty())
+    {
+        ApplyPreparations(ResolvePreparationTable(PreparationDataTable), Preparations, Aspects);
+    }
+}
+
+void UPUPreparationRegistrySubsystem::ApplyPreparations(const TSoftObjectPtr<UDataTable>& PreparationDataTable, const FGameplayTagContainer& Preparations, FFlavorAspects& FlavorAspects, FTextureAspects& TextureAspects)
+{
+    if (!Preparations.IsEmpty())
+    {
+        ApplyPreparations(ResolvePreparationTable(PreparationDataTable), Preparations, FlavorAspects, TextureAspects);
+    }
+}
+
+void UPUPreparationRegistrySubsystem::ApplyPreparations(const UDataTable* PreparationDataTable, const FGameplayTagContainer& Preparations, FPUAspectVector& Aspects)
+{
+    if (!PreparationDataTable || Preparations.IsEmpty())
+    {
+        return;
+    }
+
+    if (UPUPreparationRegistrySubsystem* Registry = Get())
+    {
+        for (const FGameplayTag& PrepTag : Preparations)
+        {
+            if (const FPUCompiledPreparation* Compiled = Registry->FindPreparation(PreparationDataTable, PrepTag))
+            {
+                Compiled->Apply(Aspects);
+            }
+        }
+        return;
+    }
+
+    // No game instance (editor utilities, commandlets) - fall back to direct row lookups
+    for (const FGameplayTag& PrepTag : Preparations)
+    {
+        if (const FPUPreparationBase* Preparation = PreparationDataTable->FindRow<FPUPreparationBase>(GetPreparationRowNameFromTag(PrepTag), TEXT("ApplyPreparations"), false))
+        {
+            Preparation->ApplyModifiers(Aspects);
+        }
+    }
+}
+
+void UPUPreparationRegistrySubsystem::ApplyPreparations(const UDataTable* PreparationDataTable, const FGameplayTagContainer& Preparations, FFlavorAspects& FlavorAspects, FTextureAspects& TextureAspects)
+{
+    if (!PreparationDataTable || Preparations.IsEmpty())
+    {
+        return;
+    }
+
+    FPUAspectVector Aspects = FPUIngredientBase::PackAspects(FlavorAspects, TextureAspects);
+    ApplyPreparations(PreparationDataTable, Preparations, Aspects);
+    FPUIngredientBase::UnpackAspects(Aspects, FlavorAspects, TextureAspects);
+}
+
+UPUPreparationRegistrySubsystem::FPreparationTableIndex* UPUPreparationRegistrySubsystem::FindOrBuildIndex(const UDataTable* PreparationDataTable)
+{
+    if (!PreparationDataTable)
+    {
+        return nullptr;
+    }
+
+    if (FPreparationTableIndex* Existing = TableIndices.Find(PreparationDataTable))
+    {
+        return Existing;
+    }
+
+    const UScriptStruct* RowStruct = PreparationDataTable->GetRowStruct();
+    if (!RowStruct || !RowStruct->IsChildOf(FPUPreparationBase::StaticStruct()))
+    {
+        return nullptr;
+    }
+
+    FPreparationTableIndex& NewIndex = TableIndices.Add(PreparationDataTable);
+    BuildIndex(PreparationDataTable, NewIndex);
+    IndexedTables.AddUnique(const_cast<UDataTable*>(PreparationDataTable));
+
+#if WITH_EDITOR
+    // Recompile if the table is edited or reimported while the game is running
+    NewIndex.TableChangedHandle = const_cast<UDataTable*>(PreparationDataTable)->OnDataTableChanged().AddUObject(
+        this, &UPUPreparationRegistrySubsystem::HandleTableChanged, PreparationDataTable);
+#endif
+
+    return &NewIndex;
+}
+
+void UPUPreparationRegistrySubsystem::BuildIndex(const UDataTable* PreparationDataTable, FPreparationTableIndex& OutIndex) const
+{
+    OutIndex.Preparations.Reset();
+    OutIndex.TagToIndex.Reset();
+
+    const TMap<FName, uint8*>& RowMap = PreparationDataTable->GetRowMap();
+    OutIndex.Preparations.Reserve(RowMap.Num());
+    OutIndex.TagToIndex.Reserve(RowMap.Num());
+
+    for (const TPair<FName, uint8*>& Pair : RowMap)
+    {
+        const FPUPreparationBase* Row = reinterpret_cast<const FPUPreparationBase*>(Pair.Value);
+        const int32 PrepIndex = OutIndex.Preparations.AddDefaulted();
+        CompilePreparation(*Row, OutIndex.Preparations[PrepIndex]);
+
+        // Only pre-map tags whose row name follows the tag naming rule, so lookups resolve exactly like
+        // the old "last tag segment, lowercased" row lookup. Anything else is resolved by name on first use.
+        if (Row->PreparationTag.IsValid() && GetPreparationRowNameFromTag(Row->PreparationTag) == Pair.Key)
+        {
+            OutIndex.TagToIndex.Add(Row->PreparationTag, PrepIndex);
+        }
+    }
+
+    if (bPU_LogPreparationCompile)
+    {
+        UE_LOG(LogTemp, Display, TEXT("UPUPreparationRegistrySubsystem - Compiled %s: %d preparations, %d tags"),
+            *PreparationDataTable->GetName(), OutIndex.Preparations.Num(), OutIndex.TagToIndex.Num());
+    }
+}
+
+void UPUPreparationRegistrySubsystem::HandleTableChanged(const UDataTable* PreparationDataTable)
+{
+    if (FPreparationTableIndex* Index = TableIndices.Find(PreparationDataTable))
+    {
+        BuildIndex(PreparationDataTable, *Index);
+    }
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "PUAspectVector.h"
+#include "PUPreparationBase.h"
+#include "PUPreparationRegistrySubsystem.generated.h"
+
+class UDataTable;
+
+// A preparation row with its AspectModifiers folded into one per-lane affine transform:
+//   Aspect = Aspect * Multiply + Add
+// Additive modifiers land in Add, multiplicative modifiers scale both lanes, so the result matches
+// applying the modifiers one by one in authoring order.
+struct FPUCompiledPreparation
+{
+    const FPUPreparationBase* Row = nullptr;
+    FPUAspectVector Multiply = FPUAspectVector::Splat(1.0f);
+    FPUAspectVector Add;
+
+    FORCEINLINE void Apply(FPUAspectVector& Aspects) const
+    {
+        Aspects.MultiplyAdd(Multiply, Add);
+    }
+};
+
+/**
+ * Preparation registry - compiles preparation data tables into tag-indexed affine aspect transforms.
+ *
+ * Each preparation table is compiled the first time it is seen (and again if it is edited in the editor).
+ * Applying a set of preparations is then one fused multiply-add per preparation with no row lookups
+ * or tag string parsing.
+ */
+UCLASS()
+class PROJECTUMEOWMI_API UPUPreparationRegistrySubsystem : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // Get the active registry (nullptr if no game instance is running)
+    static UPUPreparationRegistrySubsystem* Get();
+
+    // Find the compiled preparation for a tag in a preparation table (nullptr if not found)
+    const FPUCompiledPreparation* FindPreparation(const UDataTable* PreparationDataTable, const FGameplayTag& PreparationTag);
+
+    // Resolve a preparation row. Uses the registry when available, otherwise a direct row lookup.
+    static const FPUPreparationBase* ResolvePreparation(const UDataTable* PreparationDataTable, const FGameplayTag& PreparationTag);
+
+    // Resolve an ingredient's preparation table. A table that is not resident yet is loaded once; the registry
+    // then compiles it and keeps it loaded (IndexedTables), so later calls stay on the resident path.
+    static const UDataTable* ResolvePreparationTable(const TSoftObjectPtr<UDataTable>& PreparationDataTable);
+
+    // Apply every preparation in the container to the aspects, in container order.
+    // Uses the registry when available, otherwise falls back to row lookups + FPUPreparationBase::ApplyModifiers.
+    static void ApplyPreparations(const UDataTable* PreparationDataTable, const FGameplayTagContainer& Preparations, FPUAspectVector& Aspects);
+    static void ApplyPreparations(const UDataTable* PreparationDataTable, const FGameplayTagContainer& Preparations, FFlavorAspects& FlavorAspects, FTextureAspects& TextureAspects);
+
+    // Same, for an ingredient's soft preparation table (resolved through ResolvePreparationTable)
+    static void ApplyPreparations(const TSoftObjectPtr<UDataTable>& PreparationDataTable, const FGameplayTagContainer& Preparations, FPUAspectVector& Aspects);
+    static void ApplyPreparations(const TSoftObjectPtr<UDataTable>& PreparationDataTable, const FGameplayTagContainer& Preparations, FFlavorAspects& FlavorAspects, FTextureAspects& TextureAspects);
+
+    // Helper function to convert a preparation tag to its data table row name
+    // Takes everything after the last period and converts to lowercase
+    // Example: "Prep.Char" -> "char"
+    static FName GetPreparationRowNameFromTag(const FGameplayTag& PreparationTag);
+
+    // Fold a preparation's modifier list into a single affine transform
+    static void CompilePreparation(const FPUPreparationBase& Preparation, FPUCompiledPreparation& OutCompiled);
+
+private:
+    struct FPreparationTableIndex
+    {
+        TArray<FPUCompiledPreparation> Preparations;
+        TMap<FGameplayTag, int32> TagToIndex;
+        FDelegateHandle TableChangedHandle;
+    };
+
+    FPreparationTableIndex* FindOrBuildIndex(const UDataTable* PreparationDataTable);
+    void BuildIndex(const UDataTable* PreparationDataTable, FPreparationTableIndex& OutIndex) const;
+    void HandleTableChanged(const UDataTable* PreparationDataTable);
+
+    // Tables referenced by the indices below (kept alive so row pointers stay valid)
+    UPROPERTY()
+    TArray<TObjectPtr<UDataTable>> IndexedTables;
+
+    TMap<const UDataTable*, FPreparationTableIndex> TableIndices;
+
+    static UPUPreparationRegistrySubsystem* ActiveRegistry;
+};
@@ -0,0 +1,62 @@
+#include "PUStationRegistrySubsystem.h"
+#include "PUDishCustomizationComponent.h"
+#include "../Interactables/PUCookingStation.h"
+#include "Engine/World.h"
+
+UPUStationRegistrySubsystem* UPUStationRegistrySubsystem::Get(const UObject* WorldContextObject)
+{
+    UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UPUStationRegistrySubsystem>() : nullptr;
+}
+
+void UPUStationRegistrySubsystem::RegisterStation(UPUDishCustomizationComponent* Component)
+{
+    if (Component)
+    {
+        Stations.AddUnique(Component);
+    }
+}
+
+void UPUStationRegistrySubsystem::UnregisterStation(UPUDishCustomizationComponent* Component)
+{
+    Stations.RemoveAll([Component](const TWeakObjectPtr<UPUDishCustomizationComponent>& Station)
+    {
+        return !Station.IsValid() || Station.Get() == Component;
+    });
+}
+
+AActor* UPUStationRegistrySubsystem::FindDishStation() const
+{
+    AActor* AnyStation = nullptr;
+    for (const TWeakObjectPtr<UPUDishCustomizationComponent>& Station : Stations)
+    {
+        AActor* Owner = Station.IsValid() ? Station->GetOwner() : nullptr;
+        if (!Owner)
+        {
+            continue;
+        }
+
+        if (Owner->IsA<APUCookingStation>())
+        {
+            return Owner;
+        }
+
+        if (!AnyStation)
+        {
+            AnyStation = Owner;
+        }
+    }
+    return AnyStation;
+}
+
+UPUDishCustomizationComponent* UPUStationRegistrySubsystem::FindPlatingComponent() const
+{
+    for (const TWeakObjectPtr<UPUDishCustomizationComponent>& Station : Stations)
+    {
+        if (Station.IsValid() && Station->IsPlatingMode())
+        {
+            return Station.Get();
+        }
+    }
+    return nullptr;
+}
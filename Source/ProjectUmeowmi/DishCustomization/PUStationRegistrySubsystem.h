@@ -0,0 +1,37 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PUStationRegistrySubsystem.generated.h"
+
+class UPUDishCustomizationComponent;
+
+/**
+ * Dish stations in the world - every actor carrying a UPUDishCustomizationComponent (cooking and plating stations).
+ *
+ * Components register themselves on BeginPlay and leave on EndPlay, so lookups are a walk over a handful of
+ * stations instead of a scan of every actor in the level.
+ */
+UCLASS()
+class PROJECTUMEOWMI_API UPUStationRegistrySubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // Registry for the world of WorldContextObject (nullptr if it has no world)
+    static UPUStationRegistrySubsystem* Get(const UObject* WorldContextObject);
+
+    void RegisterStation(UPUDishCustomizationComponent* Component);
+    void UnregisterStation(UPUDishCustomizationComponent* Component);
+
+    // The station whose surface ingredients are placed on: the cooking station if there is one, otherwise any station
+    AActor* FindDishStation() const;
+
+    // The component currently in plating mode (nullptr if none)
+    UPUDishCustomizationComponent* FindPlatingComponent() const;
+
+    const TArray<TWeakObjectPtr<UPUDishCustomizationComponent>>& GetStations() const { return Stations; }
+
+private:
+    TArray<TWeakObjectPtr<UPUDishCustomizationComponent>> Stations;
+};
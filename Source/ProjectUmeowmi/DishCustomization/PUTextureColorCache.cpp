@@ -0,0 +1,334 @@
+#include "PUTextureColorCache.h"
+#include "Async/Async.h"
+#include "Engine/Engine.h"
+#include "Engine/Texture2D.h"
+#include "ImageCore.h"
+#include "ImageUtils.h"
+#include "Math/VectorRegister.h"
+#include "UObject/StrongObjectPtr.h"
+
+// Debug output toggles (kept in code, but disabled by default to avoid log spam).
+namespace
+{
+    // Enables a log line whenever a texture's colors are computed at runtime (i.e. missing from the bake).
+    constexpr bool bPU_LogTextureColorComputes = false;
+}
+
+namespace
+{
+    // Longest side of the grid the dominant color histogram is sampled on
+    constexpr int32 DominantSampleGridSize = 64;
+
+    // Smallest source mip the editor fallback decodes (the histogram grid never needs more)
+    constexpr int32 RuntimeSourceMinSize = 256;
+
+    // Pixels below this alpha are background and do not vote for the dominant color
+    constexpr uint8 DominantMinAlpha = 128;
+
+    // Histogram buckets use the top 4 bits of each channel (4096 buckets)
+    constexpr int32 DominantBucketShift = 4;
+
+    struct FColorBucket
+    {
+        uint32 Count = 0;
+        uint32 SumR = 0;
+        uint32 SumG = 0;
+        uint32 SumB = 0;
+    };
+}
+
+UPUTextureColorCacheSubsystem::UPUTextureColorCacheSubsystem()
+    : BakedColorsPath(FSoftObjectPath(TEXT("/Game/LuckyFatCatDiner/Core/DataTables/DA_TextureColors.DA_TextureColors")))
+{
+}
+
+void UPUTextureColorCacheSubsystem::Deinitialize()
+{
+    Colors.Empty();
+    PendingRequests.Empty();
+    BakedColors = nullptr;
+    bBakedColorsLoaded = false;
+
+    Super::Deinitialize();
+}
+
+UPUTextureColorCacheSubsystem* UPUTextureColorCacheSubsystem::Get()
+{
+    return GEngine ? GEngine->GetEngineSubsystem<UPUTextureColorCacheSubsystem>() : nullptr;
+}
+
+void UPUTextureColorCacheSubsystem::LoadBakedColors()
+{
+    // Loaded on first use rather than in Initialize (engine subsystems come up before the game's content is ready)
+    bBakedColorsLoaded = true;
+    if (!BakedColorsPath.IsNull())
+    {
+        BakedColors = BakedColorsPath.LoadSynchronous();
+        if (!BakedColors)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("UPUTextureColorCacheSubsystem::LoadBakedColors - Baked colors '%s' could not be loaded (run the PUBakeTextureColors commandlet)"),
+                *BakedColorsPath.ToString());
+        }
+    }
+}
+
+bool UPUTextureColorCacheSubsystem::FindColors(const UTexture2D* Texture, FPUTextureColors& OutColors)
+{
+    if (!Texture)
+    {
+        return false;
+    }
+
+    if (const FPUTextureColors* Found = Colors.Find(Texture))
+    {
+        OutColors = *Found;
+        return true;
+    }
+
+    if (!bBakedColorsLoaded)
+    {
+        LoadBakedColors();
+    }
+
+    if (BakedColors)
+    {
+        const FPUTextureColors* Baked = BakedColors->Colors.Find(TSoftObjectPtr<UTexture2D>(const_cast<UTexture2D*>(Texture)));
+#if WITH_EDITORONLY_DATA
+        // Baked from older source art (reimported or edited since the commandlet ran) - compute fresh colors instead
+        if (Baked && Baked->SourceId != Texture->Source.GetId())
+        {
+            Baked = nullptr;
+        }
+#endif
+        if (Baked)
+        {
+            // Promote to the object-keyed map so the next lookup skips the path hash
+            OutColors = Colors.Add(Texture, *Baked);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void UPUTextureColorCacheSubsystem::AddPendingRequest(TArray<FPendingColorRequest>& Waiting, const UObject* Requester, TFunction<void(const FPUTextureColors&)>&& OnReady)
+{
+    if (!OnReady)
+    {
+        return;
+    }
+
+    if (Requester)
+    {
+        const TObjectKey<UObject> RequesterKey(Requester);
+        if (FPendingColorRequest* Existing = Waiting.FindByPredicate([&RequesterKey](const FPendingColorRequest& Request) { return Request.Requester == RequesterKey; }))
+        {
+            Existing->OnReady = MoveTemp(OnReady);
+            return;
+        }
+    }
+
+    FPendingColorRequest& Request = Waiting.AddDefaulted_GetRef();
+    Request.Requester = TObjectKey<UObject>(Requester);
+    Request.OnReady = MoveTemp(OnReady);
+}
+
+bool UPUTextureColorCacheSubsystem::FindOrRequestColors(UTexture2D* Texture, FPUTextureColors& OutColors, TFunction<void(const FPUTextureColors&)>&& OnReady, const UObject* Requester)
+{
+    if (!Texture)
+    {
+        return false;
+    }
+
+    if (FindColors(Texture, OutColors))
+    {
+        return true;
+    }
+
+    const TObjectKey<UTexture2D> TextureKey(Texture);
+    if (TArray<FPendingColorRequest>* Waiting = PendingRequests.Find(TextureKey))
+    {
+        // Already being computed
+        AddPendingRequest(*Waiting, Requester, MoveTemp(OnReady));
+        return false;
+    }
+
+#if WITH_EDITORONLY_DATA
+    if (!Texture->Source.IsValid())
+    {
+        return false;
+    }
+
+    AddPendingRequest(PendingRequests.Add(TextureKey), Requester, MoveTemp(OnReady));
+
+    if (bPU_LogTextureColorComputes)
+    {
+        UE_LOG(LogTemp, Display, TEXT("UPUTextureColorCacheSubsystem::FindOrRequestColors - Computing colors for %s, not in the bake"),
+            *Texture->GetPathName());
+    }
+
+    // Source payloads are editor bulk data, which can be read off the game thread; the strong pointer keeps the
+    // texture alive until the result is back on the game thread (where it is released)
+    TWeakObjectPtr<UPUTextureColorCacheSubsystem> WeakThis(this);
+    Async(EAsyncExecution::ThreadPool, [WeakThis, TextureKey, PinnedTexture = TStrongObjectPtr<UTexture2D>(Texture)]() mutable
+    {
+        FImage SourceImage;
+        const bool bDecoded = GetSourceImage(PinnedTexture.Get(), SourceImage, RuntimeSourceMinSize);
+        const FPUTextureColors ComputedColors = bDecoded ? ComputeColors(SourceImage) : FPUTextureColors();
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, TextureKey, ComputedColors, bDecoded, PinnedTexture = MoveTemp(PinnedTexture)]()
+        {
+            if (UPUTextureColorCacheSubsystem* Cache = WeakThis.Get())
+            {
+                if (bDecoded)
+                {
+                    Cache->HandleColorsComputed(TextureKey, ComputedColors);
+                }
+                else
+                {
+                    // No usable source data - the waiters are never called (see FindOrRequestColors) and a later request can retry
+                    Cache->PendingRequests.Remove(TextureKey);
+                }
+            }
+        });
+    });
+#else
+    // No source art to fall back on in cooked builds - the bake has to cover every texture the slots show
+    ensureMsgf(false, TEXT("UPUTextureColorCacheSubsystem::FindOrRequestColors - No baked colors for %s (%s). Run the PUBakeTextureColors commandlet and commit %s"),
+        *Texture->GetPathName(), BakedColors ? TEXT("not in the bake") : TEXT("bake asset missing"), *BakedColorsPath.ToString());
+#endif
+
+    return false;
+}
+
+void UPUTextureColorCacheSubsystem::HandleColorsComputed(TObjectKey<UTexture2D> TextureKey, const FPUTextureColors& ComputedColors)
+{
+    Colors.Add(TextureKey, ComputedColors);
+
+    TArray<FPendingColorRequest> Waiting;
+    PendingRequests.RemoveAndCopyValue(TextureKey, Waiting);
+    for (FPendingColorRequest& Request : Waiting)
+    {
+        Request.OnReady(ComputedColors);
+    }
+}
+
+#if WITH_EDITORONLY_DATA
+bool UPUTextureColorCacheSubsystem::GetSourceImage(UTexture2D* Texture, FImage& OutImage, int32 MinSize)
+{
+    if (!Texture)
+    {
+        return false;
+    }
+
+    if (MinSize <= 0)
+    {
+        return FImageUtils::GetTexture2DSourceImage(Texture, OutImage) && OutImage.SizeX > 0 && OutImage.SizeY > 0;
+    }
+
+    const FTextureSource& Source = Texture->Source;
+    int32 MipIndex = 0;
+    while (MipIndex + 1 < Source.GetNumMips()
+        && FMath::Max(Source.GetSizeX() >> (MipIndex + 1), Source.GetSizeY() >> (MipIndex + 1)) >= MinSize)
+    {
+        ++MipIndex;
+    }
+
+    return Source.GetMipImage(OutImage, 0, 0, MipIndex) && OutImage.SizeX > 0 && OutImage.SizeY > 0;
+}
+#endif
+
+FPUTextureColors UPUTextureColorCacheSubsystem::ComputeColors(const FImage& Image)
+{
+    FPUTextureColors Result;
+
+    // Normalize whatever the source format is to 8-bit BGRA
+    FImage BGRAImage;
+    Image.CopyTo(BGRAImage, ERawImageFormat::BGRA8, EGammaSpace::sRGB);
+
+    const int32 Width = BGRAImage.SizeX;
+    const int32 Height = BGRAImage.SizeY;
+    if (Width <= 0 || Height <= 0)
+    {
+        return Result;
+    }
+
+    const uint8* Pixels = BGRAImage.RawData.GetData();
+    const int64 RowStride = static_cast<int64>(Width) * 4;
+
+    // Average: 4-wide sum of each row, flushed to doubles per row so float precision holds on large textures
+    double Totals[4] = { 0.0, 0.0, 0.0, 0.0 };
+    for (int32 Y = 0; Y < Height; ++Y)
+    {
+        const uint8* Row = Pixels + Y * RowStride;
+        VectorRegister4Float RowSum = VectorZeroFloat();
+        for (int32 X = 0; X < Width; ++X)
+        {
+            RowSum = VectorAdd(RowSum, VectorLoadByte4(Row + X * 4));
+        }
+
+        alignas(16) float RowTotals[4];
+        VectorStoreAligned(RowSum, RowTotals);
+        for (int32 Channel = 0; Channel < 4; ++Channel)
+        {
+            Totals[Channel] += RowTotals[Channel];
+        }
+    }
+
+    const double PixelCount = static_cast<double>(Width) * static_cast<double>(Height);
+    Result.Average = FLinearColor(
+        static_cast<float>(Totals[2] / PixelCount / 255.0),
+        static_cast<float>(Totals[1] / PixelCount / 255.0),
+        static_cast<float>(Totals[0] / PixelCount / 255.0),
+        1.0f);
+
+    // Dominant: histogram of opaque pixels on a coarse grid, then the mean color of the fullest bucket
+    const int32 StepX = FMath::Max(1, Width / DominantSampleGridSize);
+    const int32 StepY = FMath::Max(1, Height / DominantSampleGridSize);
+
+    TArray<FColorBucket> Buckets;
+    Buckets.SetNum(1 << (3 * (8 - DominantBucketShift)));
+    int32 BestBucket = INDEX_NONE;
+
+    for (int32 Y = 0; Y < Height; Y += StepY)
+    {
+        const uint8* Row = Pixels + Y * RowStride;
+        for (int32 X = 0; X < Width; X += StepX)
+        {
+            const uint8* Pixel = Row + X * 4;
+            if (Pixel[3] < DominantMinAlpha)
+            {
+                continue;
+            }
+
+            const int32 BucketIndex = ((Pixel[2] >> DominantBucketShift) << (2 * (8 - DominantBucketShift)))
+                | ((Pixel[1] >> DominantBucketShift) << (8 - DominantBucketShift))
+                | (Pixel[0] >> DominantBucketShift);
+
+            FColorBucket& Bucket = Buckets[BucketIndex];
+            ++Bucket.Count;
+            Bucket.SumR += Pixel[2];
+            Bucket.SumG += Pixel[1];
+            Bucket.SumB += Pixel[0];
+
+            if (BestBucket == INDEX_NONE || Bucket.Count > Buckets[BestBucket].Count)
+            {
+                BestBucket = BucketIndex;
+            }
+        }
+    }
+
+    if (BestBucket != INDEX_NONE)
+    {
+        const FColorBucket& Bucket = Buckets[BestBucket];
+        const float Scale = 1.0f / (255.0f * static_cast<float>(Bucket.Count));
+        Result.Dominant = FLinearColor(Bucket.SumR * Scale, Bucket.SumG * Scale, Bucket.SumB * Scale, 1.0f);
+    }
+    else
+    {
+        // Fully transparent texture
+        Result.Dominant = Result.Average;
+    }
+
+    return Result;
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "PUTextureColorCache.generated.h"
+
+class UTexture2D;
+struct FImage;
+
+// Representative colors of one texture
+USTRUCT(BlueprintType)
+struct PROJECTUMEOWMI_API FPUTextureColors
+{
+    GENERATED_BODY()
+
+    // Mean of every pixel (alpha ignored, as the ingredient slots have always used it)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Texture Colors")
+    FLinearColor Average = FLinearColor::White;
+
+    // Mean of the most common color bucket among the opaque pixels
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Texture Colors")
+    FLinearColor Dominant = FLinearColor::White;
+
+#if WITH_EDITORONLY_DATA
+    // Source art the colors were baked from (FTextureSource::GetId). The editor ignores bake entries whose texture
+    // has been reimported or edited since and computes fresh colors instead.
+    UPROPERTY()
+    FGuid SourceId;
+#endif
+};
+
+// Texture colors baked offline by the PUBakeTextureColors commandlet, so cooked builds never need source art.
+// A primary asset so the asset manager rule in DefaultGame.ini always cooks it (nothing references it by hard pointer).
+UCLASS(BlueprintType)
+class PROJECTUMEOWMI_API UPUTextureColorBake : public UPrimaryDataAsset
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Texture Colors")
+    TMap<TSoftObjectPtr<UTexture2D>, FPUTextureColors> Colors;
+};
+
+/**
+ * Shared average / dominant color cache for ingredient textures, keyed by texture.
+ *
+ * Lookups are O(1). Colors come from the baked asset when it has the texture (and, in the editor, was baked from the
+ * texture's current source art); otherwise (editor only, where source art exists) a low source mip is decoded and
+ * reduced once on a worker thread, and every waiting caller is notified on the game thread. Cooked builds have no
+ * source art, so a texture missing from the bake there raises an ensure.
+ */
+UCLASS(Config = Game)
+class PROJECTUMEOWMI_API UPUTextureColorCacheSubsystem : public UEngineSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    UPUTextureColorCacheSubsystem();
+
+    virtual void Deinitialize() override;
+
+    // Get the cache (nullptr before the engine is up)
+    static UPUTextureColorCacheSubsystem* Get();
+
+    // Cached colors for a texture. Returns false if they are not known (yet).
+    bool FindColors(const UTexture2D* Texture, FPUTextureColors& OutColors);
+
+    /**
+     * Cached colors for a texture, or start computing them. Returns true and fills OutColors if they are already known.
+     * Otherwise returns false and calls OnReady on the game thread once they are (never, if the texture has no usable data).
+     * A Requester keeps at most one pending callback per texture: asking again replaces its earlier OnReady.
+     */
+    bool FindOrRequestColors(UTexture2D* Texture, FPUTextureColors& OutColors, TFunction<void(const FPUTextureColors&)>&& OnReady, const UObject* Requester = nullptr);
+
+    UFUNCTION(BlueprintCallable, Category = "Texture Colors")
+    bool GetTextureColors(UTexture2D* Texture, FPUTextureColors& OutColors) { return FindColors(Texture, OutColors); }
+
+    // Reduce a decoded image to its average and dominant colors. Safe on any thread.
+    static FPUTextureColors ComputeColors(const FImage& Image);
+
+#if WITH_EDITORONLY_DATA
+    // Decode a texture's source art (editor only). MinSize > 0 decodes the smallest source mip whose longest side
+    // is still at least MinSize instead of the full-resolution top mip.
+    static bool GetSourceImage(UTexture2D* Texture, FImage& OutImage, int32 MinSize = 0);
+#endif
+
+    // Baked colors. Override in DefaultGame.ini under [/Script/ProjectUmeowmi.PUTextureColorCacheSubsystem]:
+    // BakedColorsPath=/Game/Path/To/DA_TextureColors.DA_TextureColors
+    UPROPERTY(Config, EditAnywhere, Category = "Texture Colors")
+    TSoftObjectPtr<UPUTextureColorBake> BakedColorsPath;
+
+private:
+    void LoadBakedColors();
+    void HandleColorsComputed(TObjectKey<UTexture2D> TextureKey, const FPUTextureColors& ComputedColors);
+
+    UPROPERTY()
+    TObjectPtr<UPUTextureColorBake> BakedColors;
+
+    TMap<TObjectKey<UTexture2D>, FPUTextureColors> Colors;
+
+    struct FPendingColorRequest
+    {
+        TObjectKey<UObject> Requester;
+        TFunction<void(const FPUTextureColors&)> OnReady;
+    };
+
+    // Add a waiter, replacing the requester's earlier callback for the same texture
+    static void AddPendingRequest(TArray<FPendingColorRequest>& Waiting, const UObject* Requester, TFunction<void(const FPUTextureColors&)>&& OnReady);
+
+    // Callers waiting on a texture that is being computed
+    TMap<TObjectKey<UTexture2D>, TArray<FPendingColorRequest>> PendingRequests;
+
+    bool bBakedColorsLoaded = false;
+};
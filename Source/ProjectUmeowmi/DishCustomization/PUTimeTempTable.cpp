@@ -0,0 +1,110 @@
+#include "PUTimeTempTable.h"
+
+TSharedRef<const FPUTimeTempTable> FPUTimeTempTable::Bake(const TArray<FTimeTempModifier>& Modifiers, bool bCustom)
+{
+    TSharedRef<FPUTimeTempTable> Table = MakeShared<FPUTimeTempTable>();
+    Table->bCustom = bCustom;
+    Table->NumSourceModifiers = Modifiers.Num();
+
+    for (int32 CellIndex = 0; CellIndex < NumTimeStates * NumTemperatureStates; ++CellIndex)
+    {
+        const ETimeState TimeState = static_cast<ETimeState>(CellIndex / NumTemperatureStates);
+        const ETemperatureState TemperatureState = static_cast<ETemperatureState>(CellIndex % NumTemperatureStates);
+        FPUTimeTempCell& Cell = Table->Cells[CellIndex];
+
+        TArray<FPUTimeTempStep, TInlineAllocator<8>> Steps;
+        bool bLaneWritten[PUAspects::NumLanes] = {};
+        bool bChained = false;
+
+        for (const FTimeTempModifier& Modifier : Modifiers)
+        {
+            // Match exact states (for "any" state behavior, add multiple modifiers)
+            if (Modifier.TimeState != TimeState || Modifier.TemperatureState != TemperatureState)
+            {
+                continue;
+            }
+
+            const int32 AspectIndex = Modifier.GetAspectIndex();
+            if (AspectIndex == INDEX_NONE)
+            {
+                continue;
+            }
+
+            FPUTimeTempStep& Step = Steps.AddDefaulted_GetRef();
+            Step.AspectIndex = AspectIndex;
+            Step.ModificationType = Modifier.ModificationType;
+            Step.ModificationValue = Modifier.ModificationValue;
+
+            bChained |= bLaneWritten[AspectIndex];
+            bLaneWritten[AspectIndex] = true;
+        }
+
+        if (Steps.Num() == 0)
+        {
+            continue;
+        }
+
+        Cell.bIdentity = false;
+
+        if (bChained)
+        {
+            Cell.ChainedSteps = Steps;
+            continue;
+        }
+
+        // Each lane is written at most once, so x -> round(max(x * M + A, 0)) is exact
+        for (const FPUTimeTempStep& Step : Steps)
+        {
+            if (Step.ModificationType == 0) // Additive
+            {
+                Cell.Add[Step.AspectIndex] = Step.ModificationValue;
+            }
+            else if (Step.ModificationType == 1) // Multiplicative
+            {
+                Cell.Multiply[Step.AspectIndex] = Step.ModificationValue;
+            }
+            Cell.WriteMask.SetLaneMask(Step.AspectIndex);
+        }
+    }
+
+    return Table;
+}
+
+const TSharedRef<const FPUTimeTempTable>& FPUTimeTempTable::GetDefault()
+{
+    static const TSharedRef<const FPUTimeTempTable> DefaultTable = Bake(FPUIngredientBase::GetDefaultTimeTempModifiers(), false);
+    return DefaultTable;
+}
+
+void FPUTimeTempTable::Apply(ETimeState TimeState, ETemperatureState TemperatureState, FPUAspectVector& Aspects) const
+{
+    const FPUTimeTempCell& Cell = GetCell(TimeState, TemperatureState);
+    if (Cell.bIdentity)
+    {
+        return;
+    }
+
+    if (Cell.ChainedSteps.Num() > 0)
+    {
+        for (const FPUTimeTempStep& Step : Cell.ChainedSteps)
+        {
+            float ModifiedValue = Aspects[Step.AspectIndex];
+            if (Step.ModificationType == 0) // Additive
+            {
+                ModifiedValue += Step.ModificationValue;
+            }
+            else if (Step.ModificationType == 1) // Multiplicative
+            {
+                ModifiedValue *= Step.ModificationValue;
+            }
+            ModifiedValue = FMath::Max(ModifiedValue, 0.0f);
+            Aspects[Step.AspectIndex] = FMath::RoundToFloat(ModifiedValue * 2.0f) / 2.0f;
+        }
+        return;
+    }
+
+    FPUAspectVector Modified = Aspects;
+    Modified.MultiplyAdd(Cell.Multiply, Cell.Add);
+    Modified.ClampAndRoundToHalf();
+    Aspects.SelectFrom(Cell.WriteMask, Modified);
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PUAspectVector.h"
+#include "PUIngredientBase.h"
+
+// One time/temp modifier with its aspect lane already resolved (used when a cell cannot be folded)
+struct FPUTimeTempStep
+{
+    int32 AspectIndex = INDEX_NONE;
+    uint8 ModificationType = 0; // 0 = Additive, 1 = Multiplicative (matches EModificationType)
+    float ModificationValue = 0.0f;
+};
+
+// The modifiers for one (ETimeState, ETemperatureState) pair, pre-folded into a per-lane affine transform.
+// Lanes in WriteMask become max(Aspect * Multiply + Add, 0) rounded to 0.5; other lanes pass through untouched.
+struct FPUTimeTempCell
+{
+    FPUAspectVector Multiply = FPUAspectVector::Splat(1.0f);
+    FPUAspectVector Add;
+    FPUAspectVector WriteMask;
+
+    // Only filled when a lane is modified more than once in this cell. The per-modifier clamp/round
+    // is not affine, so those cells replay the modifiers in authoring order instead.
+    TArray<FPUTimeTempStep> ChainedSteps;
+
+    bool bIdentity = true;
+};
+
+/**
+ * Baked 4x4 (ETimeState x ETemperatureState) table of an ingredient's time/temperature modifiers.
+ *
+ * Built once per ingredient row when it loads (default rules share a single table), so a slider change is
+ * a table index plus one vector multiply-add, instead of copying and scanning the modifier list.
+ */
+struct PROJECTUMEOWMI_API FPUTimeTempTable
+{
+    static constexpr int32 NumTimeStates = 4;
+    static constexpr int32 NumTemperatureStates = 4;
+
+    FPUTimeTempCell Cells[NumTimeStates * NumTemperatureStates];
+
+    // What the table was baked from (a cheap check for Blueprint writes that bypass the ingredient's setters)
+    bool bCustom = false;
+    int32 NumSourceModifiers = 0;
+
+    // Bake a modifier list into a table
+    static TSharedRef<const FPUTimeTempTable> Bake(const TArray<FTimeTempModifier>& Modifiers, bool bCustom);
+
+    // Shared table for the universal default rules
+    static const TSharedRef<const FPUTimeTempTable>& GetDefault();
+
+    // Apply the cell for the given states to the aspects
+    void Apply(ETimeState TimeState, ETemperatureState TemperatureState, FPUAspectVector& Aspects) const;
+
+    FORCEINLINE const FPUTimeTempCell& GetCell(ETimeState TimeState, ETemperatureState TemperatureState) const
+    {
+        return Cells[static_cast<int32>(TimeState) * NumTemperatureStates + static_cast<int32>(TemperatureState)];
+    }
+};
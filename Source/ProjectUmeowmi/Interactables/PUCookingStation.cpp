@@ -131,8 +131,7 @@ void APUCookingStation::StartInteraction()
                 for (int32 i = 0; i < CurrentOrder.BaseDish.IngredientInstances.Num(); i++)
                 {
                     const FIngredientInstance& Instance = CurrentOrder.BaseDish.IngredientInstances[i];
-                    // Use convenient field if available, fallback to data field
-                    FGameplayTag InstanceTag = Instance.IngredientTag.IsValid() ? Instance.IngredientTag : Instance.IngredientData.IngredientTag;
+                    FGameplayTag InstanceTag = Instance.IngredientTag;
                     //UE_LOG(LogTemp,Display, TEXT("    - Instance %d: %s (Qty: %d)"), 
                     //    i, *InstanceTag.ToString(), Instance.Quantity);
                 }
@@ -233,7 +232,7 @@ void APUCookingStation::OnCustomizationEnded()
                 {
                     const FIngredientInstance& Instance = CompletedDish.IngredientInstances[i];
                     //UE_LOG(LogTemp,Display, TEXT("CookingStation::OnCustomizationEnded - Ingredient %d: %s (Qty: %d)"), 
-                    //    i, *Instance.IngredientData.IngredientTag.ToString(), Instance.Quantity);
+                    //    i, *Instance.IngredientTag.ToString(), Instance.Quantity);
                 }
             }
             
@@ -306,14 +305,14 @@ bool APUCookingStation::ValidateDishAgainstOrder(const FPUDishBase& Dish, const
                 if (bPU_LogCookingStationDishDebug)
                 {
                     //UE_LOG(LogTemp,Display, TEXT("CookingStation::ValidateDishAgainstOrder - Ingredient %d (%s) has flavor value: %.2f"), 
-                    //    i, *Instance.IngredientData.IngredientTag.ToString(), IngredientFlavor);
+                    //    i, *Instance.IngredientTag.ToString(), IngredientFlavor);
                 }
                 
                 // Log preparations for this instance
-                if (Instance.IngredientData.ActivePreparations.Num() > 0)
+                if (Instance.Preparations.Num() > 0)
                 {
                     TArray<FGameplayTag> PreparationTags;
-                    Instance.IngredientData.ActivePreparations.GetGameplayTagArray(PreparationTags);
+                    Instance.Preparations.GetGameplayTagArray(PreparationTags);
                     FString PrepString = TEXT("Preparations: ");
                     for (const FGameplayTag& PrepTag : PreparationTags)
                     {
@@ -336,7 +335,7 @@ bool APUCookingStation::ValidateDishAgainstOrder(const FPUDishBase& Dish, const
                 if (bPU_LogCookingStationDishDebug)
                 {
                     //UE_LOG(LogTemp,Display, TEXT("CookingStation::ValidateDishAgainstOrder - Ingredient %s flavor aspects: Umami=%.2f, Sweet=%.2f, Salt=%.2f, Sour=%.2f, Bitter=%.2f, Spicy=%.2f"), 
-                    //    *Instance.IngredientData.IngredientTag.ToString(), 
+                    //    *Instance.IngredientTag.ToString(), 
                     //    Ingredient.FlavorAspects.Umami, Ingredient.FlavorAspects.Sweet, Ingredient.FlavorAspects.Salt,
                     //    Ingredient.FlavorAspects.Sour, Ingredient.FlavorAspects.Bitter, Ingredient.FlavorAspects.Spicy);
                 }
@@ -217,6 +217,9 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Popup Manager")
 	bool IsPopupShowing() const { return CurrentPopupWidget != nullptr; }
+
+	/** Popup widget class (soft), e.g. for preloading before a popup can show */
+	const TSoftClassPtr<class UPUPopupWidget>& GetPopupWidgetClass() const { return PopupWidgetClass; }
 	
 	/** Broadcast when any popup closes. Bind to this (e.g. from Event Construct) to react to popup button presses. Passes the ButtonID (e.g. "BACK", "NEXT"). */
 	UPROPERTY(BlueprintAssignable, Category = "Popup Manager|Events", meta = (DisplayName = "On Popup Closed"))
@@ -0,0 +1,164 @@
+#include "PUStats.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "ProfilingDebugging/MiscTrace.h"
+
+DEFINE_STAT(STAT_PU_StartCustomization);
+DEFINE_STAT(STAT_PU_TransitionToCookingStage);
+DEFINE_STAT(STAT_PU_TransitionToPlatingStage);
+DEFINE_STAT(STAT_PU_UpdateMouseDrag);
+DEFINE_STAT(STAT_PU_CreateSlots);
+DEFINE_STAT(STAT_PU_PopulatePantrySlots);
+DEFINE_STAT(STAT_PU_RecalculateAspectsFromBase);
+DEFINE_STAT(STAT_PU_RadarChartSetValues);
+DEFINE_STAT(STAT_PU_RadarChartFromIngredient);
+DEFINE_STAT(STAT_PU_RadarChartFromDishIngredients);
+DEFINE_STAT(STAT_PU_RadarChartIngredientRefresh);
+DEFINE_STAT(STAT_PU_RadarChartFromDishFlavor);
+DEFINE_STAT(STAT_PU_RadarChartFromDishTexture);
+DEFINE_STAT(STAT_PU_RadarChartFluctuationStep);
+DEFINE_STAT(STAT_PU_RadarChartFromPlanningData);
+
+#if PU_WITH_STAGE_TIMINGS
+namespace
+{
+    struct FScopeTiming
+    {
+        int64 Calls = 0;
+        uint64 TotalCycles = 0;
+        uint64 MaxCycles = 0;
+    };
+
+    struct FStageTiming
+    {
+        // Wall time spent in the stage (closed visits only, plus the open one when dumping)
+        double SecondsInStage = 0.0;
+        int32 Visits = 0;
+        TMap<const TCHAR*, FScopeTiming> Scopes;
+    };
+
+    struct FStageTimingState
+    {
+        TMap<FName, FStageTiming> Stages;
+        FName CurrentStage = FName(TEXT("None"));
+        double StageEnteredAt = 0.0;
+    };
+
+    FStageTimingState& GetState()
+    {
+        static FStageTimingState State;
+        return State;
+    }
+
+    FORCEINLINE double CyclesToMs(uint64 Cycles)
+    {
+        return FPlatformTime::ToMilliseconds64(Cycles);
+    }
+
+    void DumpStageTimings(const TArray<FString>& Args, FOutputDevice& Ar)
+    {
+        FPUStageTimings::Dump(Ar);
+        if (Args.Num() > 0 && Args[0].Equals(TEXT("reset"), ESearchCase::IgnoreCase))
+        {
+            FPUStageTimings::Reset();
+            Ar.Log(TEXT("Stage timings reset."));
+        }
+    }
+
+    FAutoConsoleCommand GPUDumpStageTimingsCommand(
+        TEXT("pu.Customization.DumpTimings"),
+        TEXT("Print call count / total / average / max time of each instrumented scope per customization stage. Usage: pu.Customization.DumpTimings [reset]"),
+        FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic(&DumpStageTimings));
+}
+
+void FPUStageTimings::SetStage(const TCHAR* StageName)
+{
+    if (!IsInGameThread())
+    {
+        return;
+    }
+
+    FStageTimingState& State = GetState();
+    const double Now = FPlatformTime::Seconds();
+    if (State.StageEnteredAt > 0.0)
+    {
+        State.Stages.FindOrAdd(State.CurrentStage).SecondsInStage += Now - State.StageEnteredAt;
+    }
+
+    State.CurrentStage = FName(StageName);
+    State.StageEnteredAt = Now;
+    ++State.Stages.FindOrAdd(State.CurrentStage).Visits;
+
+    TRACE_BOOKMARK(TEXT("PU Stage: %s"), StageName);
+}
+
+void FPUStageTimings::Record(const TCHAR* ScopeName, uint64 Cycles)
+{
+    if (!IsInGameThread())
+    {
+        return;
+    }
+
+    FStageTimingState& State = GetState();
+    FScopeTiming& Timing = State.Stages.FindOrAdd(State.CurrentStage).Scopes.FindOrAdd(ScopeName);
+    ++Timing.Calls;
+    Timing.TotalCycles += Cycles;
+    Timing.MaxCycles = FMath::Max(Timing.MaxCycles, Cycles);
+}
+
+void FPUStageTimings::Dump(FOutputDevice& Ar)
+{
+    const FStageTimingState& State = GetState();
+    const double Now = FPlatformTime::Seconds();
+
+    Ar.Logf(TEXT("Customization stage timings (current stage: %s)"), *State.CurrentStage.ToString());
+    if (State.Stages.Num() == 0)
+    {
+        Ar.Log(TEXT("  No instrumented scopes have run yet."));
+        return;
+    }
+
+    for (const TPair<FName, FStageTiming>& StagePair : State.Stages)
+    {
+        const FStageTiming& Stage = StagePair.Value;
+        double SecondsInStage = Stage.SecondsInStage;
+        if (StagePair.Key == State.CurrentStage && State.StageEnteredAt > 0.0)
+        {
+            SecondsInStage += Now - State.StageEnteredAt;
+        }
+
+        Ar.Logf(TEXT("  %s: %d visit(s), %.2f s"), *StagePair.Key.ToString(), Stage.Visits, SecondsInStage);
+
+        // Merge by name (the same scope name used in two functions can be two different literals), most expensive first
+        TMap<FString, FScopeTiming> MergedScopes;
+        for (const TPair<const TCHAR*, FScopeTiming>& ScopePair : Stage.Scopes)
+        {
+            FScopeTiming& Merged = MergedScopes.FindOrAdd(ScopePair.Key);
+            Merged.Calls += ScopePair.Value.Calls;
+            Merged.TotalCycles += ScopePair.Value.TotalCycles;
+            Merged.MaxCycles = FMath::Max(Merged.MaxCycles, ScopePair.Value.MaxCycles);
+        }
+        MergedScopes.ValueSort([](const FScopeTiming& A, const FScopeTiming& B)
+        {
+            return A.TotalCycles > B.TotalCycles;
+        });
+
+        for (const TPair<FString, FScopeTiming>& ScopePair : MergedScopes)
+        {
+            const FScopeTiming& Timing = ScopePair.Value;
+            Ar.Logf(TEXT("    %-30s calls %6lld  total %9.3f ms  avg %8.3f ms  max %8.3f ms"),
+                *ScopePair.Key, Timing.Calls, CyclesToMs(Timing.TotalCycles),
+                CyclesToMs(Timing.TotalCycles) / FMath::Max<int64>(1, Timing.Calls), CyclesToMs(Timing.MaxCycles));
+        }
+    }
+}
+
+void FPUStageTimings::Reset()
+{
+    FStageTimingState& State = GetState();
+    const FName CurrentStage = State.CurrentStage;
+    State.Stages.Reset();
+    State.StageEnteredAt = FPlatformTime::Seconds();
+    ++State.Stages.FindOrAdd(CurrentStage).Visits;
+}
+#endif
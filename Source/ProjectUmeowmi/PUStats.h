@@ -0,0 +1,82 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+// Game-side stats. "stat Umeowmi" shows them in-game; the PU_ scopes below also show up in Unreal Insights (-trace=cpu).
+DECLARE_STATS_GROUP(TEXT("Umeowmi"), STATGROUP_Umeowmi, STATCAT_Advanced);
+
+// Customization stages
+DECLARE_CYCLE_STAT_EXTERN(TEXT("StartCustomization"), STAT_PU_StartCustomization, STATGROUP_Umeowmi, PROJECTUMEOWMI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("TransitionToCookingStage"), STAT_PU_TransitionToCookingStage, STATGROUP_Umeowmi, PROJECTUMEOWMI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("TransitionToPlatingStage"), STAT_PU_TransitionToPlatingStage, STATGROUP_Umeowmi, PROJECTUMEOWMI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("UpdateMouseDrag"), STAT_PU_UpdateMouseDrag, STATGROUP_Umeowmi, PROJECTUMEOWMI_API);
+
+// Customization UI
+DECLARE_CYCLE_STAT_EXTERN(TEXT("CreateSlots"), STAT_PU_CreateSlots, STATGROUP_Umeowmi, PROJECTUMEOWMI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("PopulatePantrySlots"), STAT_PU_PopulatePantrySlots, STATGROUP_Umeowmi, PROJECTUMEOWMI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("RecalculateAspectsFromBase"), STAT_PU_RecalculateAspectsFromBase, STATGROUP_Umeowmi, PROJECTUMEOWMI_API);
+
+// Radar charts
+DECLARE_CYCLE_STAT_EXTERN(TEXT("RadarChart SetValues"), STAT_PU_RadarChartSetValues, STATGROUP_Umeowmi, PROJECTUMEOWMI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("RadarChart FromIngredient"), STAT_PU_RadarChartFromIngredient, STATGROUP_Umeowmi, PROJECTUMEOWMI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("RadarChart FromDishIngredients"), STAT_PU_RadarChartFromDishIngredients, STATGROUP_Umeowmi, PROJECTUMEOWMI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("RadarChart IngredientRefresh"), STAT_PU_RadarChartIngredientRefresh, STATGROUP_Umeowmi, PROJECTUMEOWMI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("RadarChart FromDishFlavor"), STAT_PU_RadarChartFromDishFlavor, STATGROUP_Umeowmi, PROJECTUMEOWMI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("RadarChart FromDishTexture"), STAT_PU_RadarChartFromDishTexture, STATGROUP_Umeowmi, PROJECTUMEOWMI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("RadarChart FluctuationStep"), STAT_PU_RadarChartFluctuationStep, STATGROUP_Umeowmi, PROJECTUMEOWMI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("RadarChart FromPlanningData"), STAT_PU_RadarChartFromPlanningData, STATGROUP_Umeowmi, PROJECTUMEOWMI_API);
+
+// Per-stage timing summary behind pu.Customization.DumpTimings (compiled out of Shipping)
+#define PU_WITH_STAGE_TIMINGS !UE_BUILD_SHIPPING
+
+#if PU_WITH_STAGE_TIMINGS
+/**
+ * Accumulates call count / total / max time for each PU_SCOPE_TIMING scope, booked under the customization
+ * stage that was active when it ran. Game thread only - scopes on other threads still trace but are not booked.
+ */
+class PROJECTUMEOWMI_API FPUStageTimings
+{
+public:
+    // Start booking scopes under StageName (also drops a bookmark into Insights traces)
+    static void SetStage(const TCHAR* StageName);
+
+    // ScopeName must be a string literal (it is used as the key)
+    static void Record(const TCHAR* ScopeName, uint64 Cycles);
+
+    static void Dump(FOutputDevice& Ar);
+
+    static void Reset();
+};
+
+struct FPUStageTimingScope
+{
+    explicit FPUStageTimingScope(const TCHAR* InScopeName)
+        : ScopeName(InScopeName)
+        , StartCycles(FPlatformTime::Cycles64())
+    {
+    }
+
+    ~FPUStageTimingScope()
+    {
+        FPUStageTimings::Record(ScopeName, FPlatformTime::Cycles64() - StartCycles);
+    }
+
+private:
+    const TCHAR* ScopeName;
+    uint64 StartCycles;
+};
+
+#define PU_SET_TIMING_STAGE(StageName) FPUStageTimings::SetStage(TEXT(StageName))
+#define PU_STAGE_TIMING_SCOPE(Name) FPUStageTimingScope PUStageTimingScope_##Name(TEXT(#Name))
+#else
+#define PU_SET_TIMING_STAGE(StageName)
+#define PU_STAGE_TIMING_SCOPE(Name)
+#endif
+
+// Cycle counter (STAT_PU_<Name>) + Insights CPU event (PU_<Name>) + per-stage timing for the enclosing scope
+#define PU_SCOPE_TIMING(Name) \
+    TRACE_CPUPROFILER_EVENT_SCOPE(PU_##Name); \
+    SCOPE_CYCLE_COUNTER(STAT_PU_##Name); \
+    PU_STAGE_TIMING_SCOPE(Name)
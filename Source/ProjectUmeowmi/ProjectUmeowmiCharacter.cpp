@@ -648,6 +648,7 @@ void AProjectUmeowmiCharacter::OnOrderFailed()
 
 void AProjectUmeowmiCharacter::CleanupOrderUObjectReferences(FPUOrderBase& Order)
 {
+	// Ingredient instances hold no UObject references (they share their definition by tag), only the dishes do
 	// Clear UObject references in the completed dish
 	if (Order.CompletedDish.PreviewTexture)
 	{
@@ -658,26 +659,6 @@ void AProjectUmeowmiCharacter::CleanupOrderUObjectReferences(FPUOrderBase& Order
 		Order.CompletedDish.IngredientDataTable = nullptr;
 	}
 	
-	// Clear UObject references in all ingredient instances
-	for (FIngredientInstance& Instance : Order.CompletedDish.IngredientInstances)
-	{
-		if (Instance.IngredientData.PreviewTexture)
-		{
-			Instance.IngredientData.PreviewTexture = nullptr;
-		}
-		if (Instance.IngredientData.MaterialInstance.IsValid())
-		{
-			Instance.IngredientData.MaterialInstance = nullptr;
-		}
-		if (Instance.IngredientData.IngredientMesh.IsValid())
-		{
-			Instance.IngredientData.IngredientMesh = nullptr;
-		}
-		if (Instance.IngredientData.PreparationDataTable.IsValid())
-		{
-			Instance.IngredientData.PreparationDataTable = nullptr;
-		}
-	}
 	
 	// Clear UObject references in the base dish
 	if (Order.BaseDish.PreviewTexture)
@@ -689,26 +670,6 @@ void AProjectUmeowmiCharacter::CleanupOrderUObjectReferences(FPUOrderBase& Order
 		Order.BaseDish.IngredientDataTable = nullptr;
 	}
 	
-	// Clear UObject references in base dish ingredient instances
-	for (FIngredientInstance& Instance : Order.BaseDish.IngredientInstances)
-	{
-		if (Instance.IngredientData.PreviewTexture)
-		{
-			Instance.IngredientData.PreviewTexture = nullptr;
-		}
-		if (Instance.IngredientData.MaterialInstance.IsValid())
-		{
-			Instance.IngredientData.MaterialInstance = nullptr;
-		}
-		if (Instance.IngredientData.IngredientMesh.IsValid())
-		{
-			Instance.IngredientData.IngredientMesh = nullptr;
-		}
-		if (Instance.IngredientData.PreparationDataTable.IsValid())
-		{
-			Instance.IngredientData.PreparationDataTable = nullptr;
-		}
-	}
 }
 
 void AProjectUmeowmiCharacter::ShowMouseCursor()
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Paths.h"
+
+// Helpers shared by the ProjectUmeowmi.Benchmarks automation tests
+namespace PUBenchmarks
+{
+    // Directory benchmark results are written to: -PUBenchmarkDir= if given, otherwise Saved/Automation/Benchmarks.
+    // Created if it does not exist yet.
+    inline FString GetOutputDirectory()
+    {
+        FString OutputDirectory;
+        if (!FParse::Value(FCommandLine::Get(), TEXT("PUBenchmarkDir="), OutputDirectory))
+        {
+            OutputDirectory = FPaths::ProjectSavedDir() / TEXT("Automation") / TEXT("Benchmarks");
+        }
+        IFileManager::Get().MakeDirectory(*OutputDirectory, true);
+        return OutputDirectory;
+    }
+
+    // One benchmark at one problem size (dish instances, placements per cycle, ...), times in microseconds
+    struct FResultRow
+    {
+        FString Benchmark;
+        int32 Size = 0;
+        int32 Iterations = 0;
+        double MinUs = 0.0;
+        double MeanUs = 0.0;
+        double P50Us = 0.0;
+        double P90Us = 0.0;
+        double P99Us = 0.0;
+        double MaxUs = 0.0;
+    };
+
+    // Nearest-rank percentile of sorted samples
+    inline double Percentile(const TArray<double>& SortedSamples, double Fraction)
+    {
+        if (SortedSamples.Num() == 0)
+        {
+            return 0.0;
+        }
+        const int32 Rank = FMath::Clamp(FMath::CeilToInt(Fraction * SortedSamples.Num()) - 1, 0, SortedSamples.Num() - 1);
+        return SortedSamples[Rank];
+    }
+
+    // Summarize samples (any order) into a row
+    inline FResultRow MakeRow(const FString& Benchmark, int32 Size, TArray<double> Samples)
+    {
+        FResultRow Row;
+        Row.Benchmark = Benchmark;
+        Row.Size = Size;
+        Row.Iterations = Samples.Num();
+        if (Samples.Num() == 0)
+        {
+            return Row;
+        }
+
+        Samples.Sort();
+        Row.MinUs = Samples[0];
+        Row.MaxUs = Samples.Last();
+        for (double Sample : Samples)
+        {
+            Row.MeanUs += Sample;
+        }
+        Row.MeanUs /= Samples.Num();
+        Row.P50Us = Percentile(Samples, 0.50);
+        Row.P90Us = Percentile(Samples, 0.90);
+        Row.P99Us = Percentile(Samples, 0.99);
+        return Row;
+    }
+
+    // Time Body over warmup + measured iterations. Setup runs before each iteration, outside the timed region.
+    inline FResultRow Measure(const FString& Benchmark, int32 Size, int32 WarmupIterations, int32 MeasuredIterations,
+        TFunctionRef<void()> Setup, TFunctionRef<void()> Body)
+    {
+        TArray<double> Samples;
+        Samples.Reserve(MeasuredIterations);
+
+        for (int32 Iteration = 0; Iteration < WarmupIterations + MeasuredIterations; ++Iteration)
+        {
+            Setup();
+            const double StartTime = FPlatformTime::Seconds();
+            Body();
+            const double ElapsedUs = (FPlatformTime::Seconds() - StartTime) * 1000000.0;
+            if (Iteration >= WarmupIterations)
+            {
+                Samples.Add(ElapsedUs);
+            }
+        }
+
+        return MakeRow(Benchmark, Size, MoveTemp(Samples));
+    }
+
+    // CSV of rows; SizeColumn names the Size column (e.g. DishSize). Column order is what baseline files are read by.
+    inline FString ToCsv(const TArray<FResultRow>& Rows, const TCHAR* SizeColumn)
+    {
+        FString Csv = FString::Printf(TEXT("Benchmark,%s,Iterations,MinUs,MeanUs,P50Us,P90Us,P99Us,MaxUs\n"), SizeColumn);
+        for (const FResultRow& Row : Rows)
+        {
+            Csv += FString::Printf(TEXT("%s,%d,%d,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f\n"),
+                *Row.Benchmark, Row.Size, Row.Iterations, Row.MinUs, Row.MeanUs, Row.P50Us, Row.P90Us, Row.P99Us, Row.MaxUs);
+        }
+        return Csv;
+    }
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,406 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Engine/DataTable.h"
+#include "GameplayTagsManager.h"
+#include "Math/RandomStream.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "UObject/Package.h"
+#include "UObject/StrongObjectPtr.h"
+#include "../DishCustomization/PUDishBase.h"
+#include "../DishCustomization/PUDishBlueprintLibrary.h"
+#include "../DishCustomization/PUIngredientBase.h"
+#include "../DishCustomization/PUOrderBase.h"
+#include "../DishCustomization/PUPreparationBase.h"
+#include "../DishCustomization/PUPreparationRegistrySubsystem.h"
+#include "PUBenchmarkUtils.h"
+
+/**
+ * Headless benchmarks for the dish pipeline on synthetic dishes of 1-500 instances.
+ *
+ * Run on a build box with:
+ *   UnrealEditor-Cmd ProjectUmeowmi.uproject -nullrhi -unattended -nop4 -nosplash
+ *     -ExecCmds="Automation RunTests ProjectUmeowmi.Benchmarks; Quit"
+ *
+ * Results go to Saved/Automation/Benchmarks (override with -PUBenchmarkDir=) as CSV and JSON, one row per
+ * (benchmark, dish size) with min/mean/p50/p90/p99/max in microseconds. Pass -PUBenchmarkBaseline=<csv> to fail
+ * the test when a p50 is slower than the baseline by more than -PUBenchmarkTolerance= (default 0.25 = 25%).
+ */
+namespace PUDishBenchmarks
+{
+    // Dish sizes (ingredient instances) every benchmark runs at
+    constexpr int32 DishSizes[] = { 1, 10, 50, 100, 250, 500 };
+
+    constexpr int32 WarmupIterations = 3;
+    constexpr int32 MeasuredIterations = 50;
+
+    // Baseline comparisons ignore timings this small - they are mostly timer noise
+    constexpr double MinComparableMicroseconds = 5.0;
+
+    const FName DishRowName(TEXT("congee"));
+
+    using PUBenchmarks::FResultRow;
+
+    // Time Body at one dish size (see PUBenchmarks::Measure)
+    FResultRow Measure(const FString& Benchmark, int32 DishSize, TFunctionRef<void()> Setup, TFunctionRef<void()> Body)
+    {
+        return PUBenchmarks::Measure(Benchmark, DishSize, WarmupIterations, MeasuredIterations, Setup, Body);
+    }
+
+    // Transient ingredient, preparation and dish tables built from the project's registered tags
+    struct FFixture
+    {
+        TStrongObjectPtr<UDataTable> IngredientTable;
+        TStrongObjectPtr<UDataTable> PreparationTable;
+        TStrongObjectPtr<UDataTable> DishTable;
+        TArray<FGameplayTag> IngredientTags;
+        TArray<FGameplayTag> PreparationTags;
+        FGameplayTag DishTag;
+
+        bool Build()
+        {
+            const UGameplayTagsManager& TagsManager = UGameplayTagsManager::Get();
+            TagsManager.RequestGameplayTagChildren(FGameplayTag::RequestGameplayTag(TEXT("Ingredient"), false)).GetGameplayTagArray(IngredientTags);
+            DishTag = FGameplayTag::RequestGameplayTag(TEXT("Dish.Congee"), false);
+
+            for (const TCHAR* PrepName : { TEXT("Prep.Chop"), TEXT("Prep.Mince"), TEXT("Prep.Puree") })
+            {
+                const FGameplayTag PrepTag = FGameplayTag::RequestGameplayTag(PrepName, false);
+                if (PrepTag.IsValid())
+                {
+                    PreparationTags.Add(PrepTag);
+                }
+            }
+
+            if (IngredientTags.Num() == 0 || PreparationTags.Num() == 0 || !DishTag.IsValid())
+            {
+                return false;
+            }
+
+            PreparationTable.Reset(NewObject<UDataTable>(GetTransientPackage(), NAME_None, RF_Transient));
+            PreparationTable->RowStruct = FPUPreparationBase::StaticStruct();
+            for (int32 PrepIndex = 0; PrepIndex < PreparationTags.Num(); ++PrepIndex)
+            {
+                FPUPreparationBase Preparation;
+                Preparation.PreparationTag = PreparationTags[PrepIndex];
+                Preparation.DisplayName = FText::FromString(PreparationTags[PrepIndex].ToString());
+
+                FAspectModifier& Modifier = Preparation.AspectModifiers.AddDefaulted_GetRef();
+                Modifier.AspectType = EAspectType::Flavor;
+                Modifier.AspectName = PUAspects::GetAspectName(PrepIndex % PUAspects::NumFlavorLanes);
+                Modifier.ModificationType = EModificationType::Additive;
+                Modifier.ModificationValue = 1.0f;
+
+                PreparationTable->AddRow(UPUPreparationRegistrySubsystem::GetPreparationRowNameFromTag(PreparationTags[PrepIndex]), Preparation);
+            }
+
+            // Deterministic aspects so runs are comparable
+            FRandomStream Random(0x0DE1);
+            IngredientTable.Reset(NewObject<UDataTable>(GetTransientPackage(), NAME_None, RF_Transient));
+            IngredientTable->RowStruct = FPUIngredientBase::StaticStruct();
+            for (const FGameplayTag& IngredientTag : IngredientTags)
+            {
+                FPUIngredientBase Ingredient;
+                Ingredient.IngredientTag = IngredientTag;
+                Ingredient.DisplayName = FText::FromString(IngredientTag.ToString());
+                Ingredient.PreparationDataTable = PreparationTable.Get();
+
+                FPUAspectVector Aspects;
+                for (int32 Lane = 0; Lane < PUAspects::NumLanes; ++Lane)
+                {
+                    Aspects[Lane] = static_cast<float>(Random.RandRange(0, 10)) * 0.5f;
+                }
+                Ingredient.SetAspectVector(Aspects);
+
+                // Every other ingredient authors its own time/temp modifiers, the rest use the shared defaults
+                if (IngredientTable->GetRowMap().Num() % 2 == 0)
+                {
+                    Ingredient.bUseCustomTimeTempModifiers = true;
+                    for (int32 State = 1; State < 4; ++State)
+                    {
+                        FTimeTempModifier& Modifier = Ingredient.TimeTemperatureModifiers.AddDefaulted_GetRef();
+                        Modifier.TimeState = static_cast<ETimeState>(State);
+                        Modifier.TemperatureState = static_cast<ETemperatureState>(4 - State);
+                        Modifier.AspectName = PUAspects::GetAspectName(State % PUAspects::NumFlavorLanes);
+                        Modifier.ModificationType = static_cast<uint8>(State % 2);
+                        Modifier.ModificationValue = 0.5f * State;
+                    }
+                }
+
+                IngredientTable->AddRow(UPUDishBlueprintLibrary::GetIngredientRowNameFromTag(IngredientTag), Ingredient);
+            }
+
+            DishTable.Reset(NewObject<UDataTable>(GetTransientPackage(), NAME_None, RF_Transient));
+            DishTable->RowStruct = FPUDishBase::StaticStruct();
+            return true;
+        }
+
+        // Dish of DishSize instances cycling through the ingredients, with mixed quantities and time/temp values
+        FPUDishBase MakeDish(int32 DishSize) const
+        {
+            FPUDishBase Dish;
+            Dish.DishTag = DishTag;
+            Dish.DisplayName = FText::FromString(TEXT("Benchmark Congee"));
+            Dish.IngredientDataTable = IngredientTable.Get();
+
+            for (int32 Index = 0; Index < DishSize; ++Index)
+            {
+                UPUDishBlueprintLibrary::AddIngredient(Dish, IngredientTags[Index % IngredientTags.Num()]);
+                const int32 LastIndex = Dish.IngredientInstances.Num() - 1;
+                Dish.ModifyInstanceAt(LastIndex, [Index](FIngredientInstance& Instance)
+                {
+                    Instance.Quantity = 1 + Index % 3;
+                    Instance.TimeValue = static_cast<float>(Index % 4) / 3.0f;
+                    Instance.TemperatureValue = static_cast<float>((Index / 4) % 4) / 3.0f;
+                });
+            }
+            return Dish;
+        }
+
+        // Dish table row with DishSize tag-only instances, as authored dish rows are
+        void SetDishRow(int32 DishSize)
+        {
+            FPUDishBase Row;
+            Row.DishTag = DishTag;
+            Row.DisplayName = FText::FromString(TEXT("Benchmark Congee"));
+            Row.IngredientDataTable = IngredientTable.Get();
+            for (int32 Index = 0; Index < DishSize; ++Index)
+            {
+                FIngredientInstance Instance;
+                Instance.InstanceID = Index + 1;
+                Instance.Quantity = 1 + Index % 3;
+                Instance.IngredientTag = IngredientTags[Index % IngredientTags.Num()];
+                if (Index % 5 == 0)
+                {
+                    Instance.Preparations.AddTag(PreparationTags[Index % PreparationTags.Num()]);
+                }
+                Row.IngredientInstances.Add(Instance);
+            }
+
+            DishTable->EmptyTable();
+            DishTable->AddRow(DishRowName, Row);
+        }
+    };
+
+    FString ToJson(const TArray<FResultRow>& Rows, const FString& Timestamp)
+    {
+        FString Json = FString::Printf(TEXT("{\n  \"suite\": \"DishPipeline\",\n  \"timestamp\": \"%s\",\n  \"platform\": \"%s\",\n  \"config\": \"%s\",\n  \"results\": [\n"),
+            *Timestamp, ANSI_TO_TCHAR(FPlatformProperties::IniPlatformName()), LexToString(FApp::GetBuildConfiguration()));
+        for (int32 RowIndex = 0; RowIndex < Rows.Num(); ++RowIndex)
+        {
+            const FResultRow& Row = Rows[RowIndex];
+            Json += FString::Printf(TEXT("    { \"benchmark\": \"%s\", \"dishSize\": %d, \"iterations\": %d, \"minUs\": %.3f, \"meanUs\": %.3f, \"p50Us\": %.3f, \"p90Us\": %.3f, \"p99Us\": %.3f, \"maxUs\": %.3f }%s\n"),
+                *Row.Benchmark, Row.Size, Row.Iterations, Row.MinUs, Row.MeanUs, Row.P50Us, Row.P90Us, Row.P99Us, Row.MaxUs,
+                RowIndex + 1 < Rows.Num() ? TEXT(",") : TEXT(""));
+        }
+        Json += TEXT("  ]\n}\n");
+        return Json;
+    }
+
+    // Baseline p50 per "Benchmark/DishSize" from a CSV written by an earlier run
+    bool LoadBaseline(const FString& Path, TMap<FString, double>& OutP50)
+    {
+        TArray<FString> Lines;
+        if (!FFileHelper::LoadFileToStringArray(Lines, *Path))
+        {
+            return false;
+        }
+
+        for (int32 LineIndex = 1; LineIndex < Lines.Num(); ++LineIndex)
+        {
+            TArray<FString> Columns;
+            Lines[LineIndex].ParseIntoArray(Columns, TEXT(","));
+            if (Columns.Num() >= 6)
+            {
+                OutP50.Add(Columns[0] / Columns[1], FCString::Atod(*Columns[5]));
+            }
+        }
+        return true;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPUDishPipelineBenchmarkTest, "ProjectUmeowmi.Benchmarks.DishPipeline",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FPUDishPipelineBenchmarkTest::RunTest(const FString& Parameters)
+{
+    using namespace PUDishBenchmarks;
+
+    FFixture Fixture;
+    if (!Fixture.Build())
+    {
+        AddError(TEXT("Ingredient, Prep or Dish.Congee gameplay tags are not registered - check Config/DefaultGameplayTags.ini"));
+        return false;
+    }
+
+    FPUOrderBase Order;
+    Order.MinIngredientCount = 3;
+    Order.TargetFlavorProperty = PUAspects::GetAspectName(1);
+    Order.MinFlavorValue = 5.0f;
+
+    TArray<FResultRow> Rows;
+
+    for (const int32 DishSize : DishSizes)
+    {
+        const FPUDishBase SourceDish = Fixture.MakeDish(DishSize);
+        TestEqual(FString::Printf(TEXT("Synthetic dish has %d instances"), DishSize), SourceDish.IngredientInstances.Num(), DishSize);
+
+        FPUDishBase WorkDish;
+
+        // Build the dish one AddIngredient at a time
+        Rows.Add(Measure(TEXT("AddIngredient"), DishSize,
+            [&]() { WorkDish = FPUDishBase(); WorkDish.IngredientDataTable = Fixture.IngredientTable.Get(); },
+            [&]()
+            {
+                for (int32 Index = 0; Index < DishSize; ++Index)
+                {
+                    UPUDishBlueprintLibrary::AddIngredient(WorkDish, Fixture.IngredientTags[Index % Fixture.IngredientTags.Num()]);
+                }
+            }));
+
+        // Load the authored dish row and resolve every instance's ingredient
+        Fixture.SetDishRow(DishSize);
+        bool bLoaded = true;
+        Rows.Add(Measure(TEXT("GetDishFromDataTable"), DishSize,
+            [&]() { WorkDish = FPUDishBase(); },
+            [&]() { bLoaded &= UPUDishBlueprintLibrary::GetDishFromDataTable(Fixture.DishTable.Get(), Fixture.IngredientTable.Get(), Fixture.DishTag, WorkDish); }));
+        TestTrue(TEXT("GetDishFromDataTable finds the synthetic row"), bLoaded);
+
+        // Apply a preparation to every instance by ID (includes the ID lookups)
+        TArray<int32> InstanceIDs;
+        for (const FIngredientInstance& Instance : SourceDish.IngredientInstances)
+        {
+            InstanceIDs.Add(Instance.InstanceID);
+        }
+        Rows.Add(Measure(TEXT("ApplyPreparationByID"), DishSize,
+            [&]() { WorkDish = SourceDish; },
+            [&]()
+            {
+                for (int32 Index = 0; Index < InstanceIDs.Num(); ++Index)
+                {
+                    UPUDishBlueprintLibrary::ApplyPreparationByID(WorkDish, InstanceIDs[Index], Fixture.PreparationTags[Index % Fixture.PreparationTags.Num()]);
+                }
+            }));
+
+        // Time/temp modified aspects for every instance, read through the shared definition with its table baked
+        FFlavorAspects Flavor;
+        FTextureAspects Texture;
+        for (const FIngredientInstance& Instance : SourceDish.IngredientInstances)
+        {
+            Instance.GetDefinition().GetTimeTempTable();
+        }
+        Rows.Add(Measure(TEXT("CalculateTimeTempModifiedAspects.Baked"), DishSize,
+            []() {},
+            [&]()
+            {
+                for (const FIngredientInstance& Instance : SourceDish.IngredientInstances)
+                {
+                    Instance.CalculateTimeTempModifiedAspects(Instance.TimeValue, Instance.TemperatureValue, Flavor, Texture);
+                }
+            }));
+
+        // Cold path: one ingredient copy per instance with its table dropped, so each call bakes it again
+        TArray<FPUIngredientBase> IngredientCopies;
+        Rows.Add(Measure(TEXT("CalculateTimeTempModifiedAspects.Rebake"), DishSize,
+            [&]()
+            {
+                IngredientCopies.Reset();
+                for (const FIngredientInstance& Instance : SourceDish.IngredientInstances)
+                {
+                    IngredientCopies.Add(Instance.GetIngredientData());
+                    IngredientCopies.Last().InvalidateTimeTempTable();
+                }
+            },
+            [&]()
+            {
+                for (int32 Index = 0; Index < IngredientCopies.Num(); ++Index)
+                {
+                    const FIngredientInstance& Instance = SourceDish.IngredientInstances[Index];
+                    IngredientCopies[Index].CalculateTimeTempModifiedAspects(Instance.TimeValue, Instance.TemperatureValue, Flavor, Texture);
+                }
+            }));
+
+        // Display name (scans every instance's preparations)
+        FText DisplayName;
+        Rows.Add(Measure(TEXT("GetCurrentDisplayName"), DishSize,
+            []() {},
+            [&]() { DisplayName = SourceDish.GetCurrentDisplayName(); }));
+        TestFalse(TEXT("GetCurrentDisplayName returns a name"), DisplayName.IsEmpty());
+
+        // Order validation + satisfaction from a cold dish (totals rebuilt from the instances)
+        float Score = 0.0f;
+        Rows.Add(Measure(TEXT("OrderScoring"), DishSize,
+            [&]() { WorkDish = SourceDish; WorkDish.MarkAggregatesDirty(); },
+            [&]()
+            {
+                Order.ValidateDish(WorkDish);
+                Score = Order.GetSatisfactionScore(WorkDish);
+            }));
+        TestTrue(TEXT("Satisfaction score is in [0, 1]"), Score >= 0.0f && Score <= 1.0f);
+    }
+
+    // Write the results
+    const FString Timestamp = FDateTime::UtcNow().ToString(TEXT("%Y%m%d_%H%M%S"));
+    const FString OutputDirectory = PUBenchmarks::GetOutputDirectory();
+
+    const FString Csv = PUBenchmarks::ToCsv(Rows, TEXT("DishSize"));
+    const FString Json = ToJson(Rows, Timestamp);
+    const FString CsvPath = OutputDirectory / FString::Printf(TEXT("DishPipeline_%s.csv"), *Timestamp);
+    const FString JsonPath = OutputDirectory / FString::Printf(TEXT("DishPipeline_%s.json"), *Timestamp);
+
+    if (!FFileHelper::SaveStringToFile(Csv, *CsvPath) || !FFileHelper::SaveStringToFile(Json, *JsonPath))
+    {
+        AddError(FString::Printf(TEXT("Could not write benchmark results to %s"), *OutputDirectory));
+    }
+
+    // Stable names for build scripts to pick up
+    FFileHelper::SaveStringToFile(Csv, *(OutputDirectory / TEXT("DishPipeline_Latest.csv")));
+    FFileHelper::SaveStringToFile(Json, *(OutputDirectory / TEXT("DishPipeline_Latest.json")));
+
+    // Per-instance memory (the shared definitions are counted once per ingredient, not here)
+    {
+        const FPUDishBase MemoryDish = Fixture.MakeDish(DishSizes[UE_ARRAY_COUNT(DishSizes) - 1]);
+        const double BytesPerInstance = static_cast<double>(MemoryDish.GetAllocatedSize() - sizeof(FPUDishBase)) / FMath::Max(1, MemoryDish.IngredientInstances.Num());
+        AddInfo(FString::Printf(TEXT("FIngredientInstance: %d bytes inline, %.1f bytes per instance with heap (n=%d)"),
+            static_cast<int32>(sizeof(FIngredientInstance)), BytesPerInstance, MemoryDish.IngredientInstances.Num()));
+    }
+
+    for (const FResultRow& Row : Rows)
+    {
+        AddInfo(FString::Printf(TEXT("%-34s n=%-4d p50 %9.2f us  p90 %9.2f us  p99 %9.2f us"), *Row.Benchmark, Row.Size, Row.P50Us, Row.P90Us, Row.P99Us));
+    }
+    AddInfo(FString::Printf(TEXT("Benchmark results written to %s"), *CsvPath));
+
+    // Regression gate against a baseline CSV
+    FString BaselinePath;
+    if (FParse::Value(FCommandLine::Get(), TEXT("PUBenchmarkBaseline="), BaselinePath))
+    {
+        float Tolerance = 0.25f;
+        FParse::Value(FCommandLine::Get(), TEXT("PUBenchmarkTolerance="), Tolerance);
+
+        TMap<FString, double> BaselineP50;
+        if (!LoadBaseline(BaselinePath, BaselineP50))
+        {
+            AddError(FString::Printf(TEXT("Could not read benchmark baseline %s"), *BaselinePath));
+        }
+
+        for (const FResultRow& Row : Rows)
+        {
+            const double* Baseline = BaselineP50.Find(Row.Benchmark / LexToString(Row.Size));
+            if (Baseline && *Baseline >= MinComparableMicroseconds && Row.P50Us > *Baseline * (1.0 + Tolerance))
+            {
+                AddError(FString::Printf(TEXT("%s (n=%d) regressed: p50 %.2f us vs baseline %.2f us (+%.0f%%)"),
+                    *Row.Benchmark, Row.Size, Row.P50Us, *Baseline, (Row.P50Us / *Baseline - 1.0) * 100.0));
+            }
+        }
+    }
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
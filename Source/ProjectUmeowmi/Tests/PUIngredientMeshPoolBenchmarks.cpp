@@ -0,0 +1,151 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Engine/Engine.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "UObject/UObjectGlobals.h"
+#include "../DishCustomization/PUIngredientBase.h"
+#include "../DishCustomization/PUIngredientMesh.h"
+#include "../DishCustomization/PUIngredientMeshPool.h"
+#include "PUBenchmarkUtils.h"
+
+/**
+ * Rapid plating place / reset cycles with and without the ingredient mesh pool, in a throwaway game world.
+ *
+ * Run with:
+ *   UnrealEditor-Cmd ProjectUmeowmi.uproject -nullrhi -unattended -nop4 -nosplash
+ *     -ExecCmds="Automation RunTests ProjectUmeowmi.Benchmarks.IngredientMeshPool; Quit"
+ *
+ * Reports the per-cycle place + reset time and the garbage collection that follows each mode, and writes
+ * IngredientMeshPool_Latest.csv (same columns as the dish pipeline CSV, one <Mode>.Cycle and one
+ * <Mode>.GarbageCollection row per mode) next to the dish pipeline results (Saved/Automation/Benchmarks or -PUBenchmarkDir=).
+ */
+namespace PUIngredientMeshPoolBenchmarks
+{
+    // Ingredients placed per cycle before the plate is reset
+    constexpr int32 PlacementsPerCycle = 64;
+
+    constexpr int32 WarmupCycles = 3;
+    constexpr int32 MeasuredCycles = 50;
+
+    struct FModeResult
+    {
+        // Per-cycle place + reset time
+        PUBenchmarks::FResultRow Cycle;
+
+        // One full garbage collection after all the mode's cycles (a single sample)
+        PUBenchmarks::FResultRow GarbageCollection;
+    };
+
+    // Run warmup + measured cycles of Cycle(), then time one full garbage collection
+    FModeResult RunMode(const FString& Mode, TFunctionRef<void()> Cycle)
+    {
+        FModeResult Result;
+        Result.Cycle = PUBenchmarks::Measure(Mode + TEXT(".Cycle"), PlacementsPerCycle, WarmupCycles, MeasuredCycles, []() {}, Cycle);
+
+        const double GarbageStartTime = FPlatformTime::Seconds();
+        CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+        const double GarbageCollectionUs = (FPlatformTime::Seconds() - GarbageStartTime) * 1000000.0;
+        Result.GarbageCollection = PUBenchmarks::MakeRow(Mode + TEXT(".GarbageCollection"), PlacementsPerCycle, { GarbageCollectionUs });
+        return Result;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPUIngredientMeshPoolBenchmarkTest, "ProjectUmeowmi.Benchmarks.IngredientMeshPool",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FPUIngredientMeshPoolBenchmarkTest::RunTest(const FString& Parameters)
+{
+    using namespace PUIngredientMeshPoolBenchmarks;
+
+    UStaticMesh* CubeMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+    if (!CubeMesh)
+    {
+        AddError(TEXT("Could not load /Engine/BasicShapes/Cube"));
+        return false;
+    }
+
+    FPUIngredientBase Ingredient;
+    Ingredient.IngredientMesh = CubeMesh;
+
+    UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("PUIngredientMeshPoolBenchmark"));
+    FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+    WorldContext.SetCurrentWorld(World);
+    World->InitializeActorsForPlay(FURL());
+    World->BeginPlay();
+
+    const FVector PlateCenter(0.0f, 0.0f, 100.0f);
+    auto PlacementLocation = [&PlateCenter](int32 Index)
+    {
+        return PlateCenter + FVector((Index % 8) * 10.0f, (Index / 8) * 10.0f, 20.0f);
+    };
+
+    TArray<APUIngredientMesh*> Placed;
+    Placed.Reserve(PlacementsPerCycle);
+
+    // What plating did before: spawn every placement, destroy them all on reset
+    const FModeResult SpawnResult = RunMode(TEXT("SpawnDestroy"), [&]()
+    {
+        for (int32 Index = 0; Index < PlacementsPerCycle; ++Index)
+        {
+            FActorSpawnParameters SpawnParams;
+            SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+            APUIngredientMesh* IngredientMesh = World->SpawnActor<APUIngredientMesh>(APUIngredientMesh::StaticClass(), PlacementLocation(Index), FRotator::ZeroRotator, SpawnParams);
+            IngredientMesh->InitializeWithIngredient(Ingredient);
+            Placed.Add(IngredientMesh);
+        }
+        for (APUIngredientMesh* IngredientMesh : Placed)
+        {
+            IngredientMesh->Destroy();
+        }
+        Placed.Reset();
+    });
+
+    // Pooled: prewarmed once, then acquire / release
+    FPUIngredientMeshPool Pool;
+    Pool.Prewarm(World, nullptr, PlacementsPerCycle);
+    const FModeResult PoolResult = RunMode(TEXT("Pooled"), [&]()
+    {
+        for (int32 Index = 0; Index < PlacementsPerCycle; ++Index)
+        {
+            APUIngredientMesh* IngredientMesh = Pool.Acquire(World, nullptr, PlacementLocation(Index), FRotator::ZeroRotator);
+            IngredientMesh->InitializeWithIngredient(Ingredient);
+            Placed.Add(IngredientMesh);
+        }
+        for (APUIngredientMesh* IngredientMesh : Placed)
+        {
+            Pool.Release(IngredientMesh);
+        }
+        Placed.Reset();
+    });
+
+    TestEqual(TEXT("Pool spawns no actors after prewarming"), Pool.GetNumSpawned(), PlacementsPerCycle);
+    TestEqual(TEXT("Every pooled actor is back in the pool"), Pool.GetNumFree(), PlacementsPerCycle);
+
+    Pool.DestroyAll();
+    GEngine->DestroyWorldContext(World);
+    World->DestroyWorld(false);
+
+    // Report
+    TArray<PUBenchmarks::FResultRow> Rows;
+    for (const FModeResult& Result : { SpawnResult, PoolResult })
+    {
+        Rows.Add(Result.Cycle);
+        Rows.Add(Result.GarbageCollection);
+        AddInfo(FString::Printf(TEXT("%-24s place+reset of %d: p50 %9.2f us  max %9.2f us  GC after %d cycles %7.2f ms"),
+            *Result.Cycle.Benchmark, PlacementsPerCycle, Result.Cycle.P50Us, Result.Cycle.MaxUs, WarmupCycles + MeasuredCycles,
+            Result.GarbageCollection.P50Us / 1000.0));
+    }
+
+    const FString OutputDirectory = PUBenchmarks::GetOutputDirectory();
+    FFileHelper::SaveStringToFile(PUBenchmarks::ToCsv(Rows, TEXT("PlacementsPerCycle")), *(OutputDirectory / TEXT("IngredientMeshPool_Latest.csv")));
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -1,12 +1,15 @@
 #include "PUDishCustomizationWidget.h"
 #include "../DishCustomization/PUDishCustomizationComponent.h"
 #include "../DishCustomization/PUDishBlueprintLibrary.h"
+#include "../PUStats.h"
 #include "PUIngredientButton.h"
 #include "PUIngredientQuantityControl.h"
 #include "PUIngredientSlot.h"
+#include "PUPantryItem.h"
 #include "Components/Button.h"
 #include "Components/HorizontalBox.h"
 #include "Components/ScrollBox.h"
+#include "Components/TileView.h"
 #include "Components/CanvasPanel.h"
 #include "Components/CanvasPanelSlot.h"
 #include "Components/HorizontalBoxSlot.h"
@@ -29,9 +32,22 @@ namespace
 UPUDishCustomizationWidget::UPUDishCustomizationWidget(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
     , CustomizationComponent(nullptr)
+    , SlotWidgetPool(*this)
 {
 }
 
+void UPUDishCustomizationWidget::NativeOnInitialized()
+{
+    Super::NativeOnInitialized();
+    
+    if (PantryTileView)
+    {
+        PantryTileView->SetSelectionMode(ESelectionMode::None);
+        PantryTileView->OnEntryWidgetGenerated().AddUObject(this, &UPUDishCustomizationWidget::OnPantryEntryGenerated);
+        PantryTileView->OnEntryWidgetReleased().AddUObject(this, &UPUDishCustomizationWidget::OnPantryEntryReleased);
+    }
+}
+
 void UPUDishCustomizationWidget::NativeConstruct()
 {
     //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::NativeConstruct - STARTING WIDGET CONSTRUCTION"));
@@ -75,8 +91,13 @@ void UPUDishCustomizationWidget::NativeConstruct()
         //UE_LOG(LogTemp,Warning, TEXT("⚠️ PUDishCustomizationWidget::NativeConstruct - Widget is NOT in viewport"));
     }
     
-    // Note: Don't subscribe to events here - the component reference isn't set yet
-    // Subscription will happen in SetCustomizationComponent()
+    // Note: New widgets don't have the component reference yet - subscription happens in SetCustomizationComponent().
+    // A stage widget reused by the component (AcquireStageWidget) still has it, but NativeDestruct unsubscribed it.
+    if (CustomizationComponent)
+    {
+        UnsubscribeFromEvents();
+        SubscribeToEvents();
+    }
     
     //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::NativeConstruct - WIDGET CONSTRUCTION COMPLETED"));
 }
@@ -94,15 +115,18 @@ void UPUDishCustomizationWidget::NativeDestruct()
     // Unsubscribe from events
     UnsubscribeFromEvents();
     
+    // Hand every slot back to the pool - if this stage is shown again its Blueprint repopulates the containers from it
+    ReleaseAllSlotWidgets();
+    
     Super::NativeDestruct();
 }
 
-void UPUDishCustomizationWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+void UPUDishCustomizationWidget::ReleaseSlateResources(bool bReleaseChildren)
 {
-    Super::NativeTick(MyGeometry, InDeltaTime);
+    Super::ReleaseSlateResources(bReleaseChildren);
     
-    // NativeTick is available for any real-time updates needed
-    // Currently used for potential future features
+    // Pooled slots hold on to their Slate widgets while inactive
+    SlotWidgetPool.ReleaseAllSlateResources();
 }
 
 void UPUDishCustomizationWidget::OnInitialDishDataReceived(const FPUDishBase& InitialDishData)
@@ -123,7 +147,7 @@ void UPUDishCustomizationWidget::OnInitialDishDataReceived(const FPUDishBase& In
         {
             const FIngredientInstance& Instance = InitialDishData.IngredientInstances[i];
             //UE_LOG(LogTemp,Display, TEXT("📥 PUDishCustomizationWidget::OnInitialDishDataReceived - Ingredient %d: %s (Qty: %d, ID: %d)"),
-            //    i, *Instance.IngredientData.IngredientTag.ToString(), Instance.Quantity, Instance.InstanceID);
+            //    i, *Instance.IngredientTag.ToString(), Instance.Quantity, Instance.InstanceID);
         }
     }
     
@@ -143,12 +167,12 @@ void UPUDishCustomizationWidget::OnInitialDishDataReceived(const FPUDishBase& In
     
     for (const FIngredientInstance& IngredientInstance : InitialDishData.IngredientInstances)
     {
-        if (IngredientInstance.IngredientData.IngredientTag.IsValid() && IngredientInstance.Quantity > 0)
+        if (IngredientInstance.IngredientTag.IsValid() && IngredientInstance.Quantity > 0)
         {
             if (bPU_LogDishDataReceiveDebug)
             {
                 //UE_LOG(LogTemp,Display, TEXT("📥 PUDishCustomizationWidget::OnInitialDishDataReceived - Creating prepped slot for: %s (ID: %d, Qty: %d)"),
-                //    *IngredientInstance.IngredientData.DisplayName.ToString(), IngredientInstance.InstanceID, IngredientInstance.Quantity);
+                //    *IngredientInstance.GetDefinition().DisplayName.ToString(), IngredientInstance.InstanceID, IngredientInstance.Quantity);
             }
             CreateOrUpdatePreppedSlot(IngredientInstance);
         }
@@ -179,12 +203,12 @@ void UPUDishCustomizationWidget::OnInitialDishDataReceived(const FPUDishBase& In
         // Try to find a matching ingredient from the dish data
         for (const FIngredientInstance& DishIngredient : InitialDishData.IngredientInstances)
         {
-            if (DishIngredient.IngredientData.IngredientTag.IsValid() && DishIngredient.Quantity > 0)
+            if (DishIngredient.IngredientTag.IsValid() && DishIngredient.Quantity > 0)
             {
                 // Check if this prep slot matches this ingredient (by tag)
                 const FIngredientInstance& SlotIngredient = PrepSlot->GetIngredientInstance();
-                FGameplayTag SlotTag = SlotIngredient.IngredientTag.IsValid() ? SlotIngredient.IngredientTag : SlotIngredient.IngredientData.IngredientTag;
-                FGameplayTag DishTag = DishIngredient.IngredientTag.IsValid() ? DishIngredient.IngredientTag : DishIngredient.IngredientData.IngredientTag;
+                FGameplayTag SlotTag = SlotIngredient.IngredientTag;
+                FGameplayTag DishTag = DishIngredient.IngredientTag;
                 
                 if (SlotTag == DishTag)
                 {
@@ -192,7 +216,7 @@ void UPUDishCustomizationWidget::OnInitialDishDataReceived(const FPUDishBase& In
                     if (bPU_LogDishDataReceiveDebug)
                     {
                         //UE_LOG(LogTemp,Display, TEXT("📥 PUDishCustomizationWidget::OnInitialDishDataReceived - Populating prep slot with ingredient: %s (ID: %d, Qty: %d)"),
-                        //    *DishIngredient.IngredientData.DisplayName.ToString(), DishIngredient.InstanceID, DishIngredient.Quantity);
+                        //    *DishIngredient.GetDefinition().DisplayName.ToString(), DishIngredient.InstanceID, DishIngredient.Quantity);
                     }
                     PrepSlot->SetIngredientInstance(DishIngredient);
                     break; // Found match, move to next prep slot
@@ -226,6 +250,43 @@ void UPUDishCustomizationWidget::OnDishDataUpdated(const FPUDishBase& UpdatedDis
     OnDishDataChanged(UpdatedDishData);
 }
 
+void UPUDishCustomizationWidget::OnDishDeltaReceived(const FDishDelta& Delta)
+{
+    // Patch our view of the dish in place (only instances we have never seen are copied from the component)
+    if (CustomizationComponent)
+    {
+        Delta.ApplyTo(CurrentDishData, CustomizationComponent->GetCurrentDishData());
+    }
+
+    OnDishDeltaApplied(Delta);
+}
+
+void UPUDishCustomizationWidget::OnDishDeltaApplied_Implementation(const FDishDelta& Delta)
+{
+    // Default: hand Blueprint the one changed instance (no copy of the whole dish per delta).
+    // Blueprints written before OnDishInstanceChanged existed still get the whole dish.
+    if (!GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UPUDishCustomizationWidget, OnDishInstanceChanged)))
+    {
+        OnDishDataChanged(CurrentDishData);
+        return;
+    }
+
+    const FIngredientInstance* Instance = CurrentDishData.FindInstanceByID(Delta.InstanceID);
+    OnDishInstanceChanged(Delta, Instance ? *Instance : FIngredientInstance());
+}
+
+void UPUDishCustomizationWidget::CommitInstanceToComponent(const FIngredientInstance& IngredientInstance)
+{
+    if (CustomizationComponent)
+    {
+        CustomizationComponent->CommitIngredientInstance(IngredientInstance);
+    }
+    else
+    {
+        //UE_LOG(LogTemp,Warning, TEXT("PUDishCustomizationWidget::CommitInstanceToComponent - No customization component reference"));
+    }
+}
+
 void UPUDishCustomizationWidget::OnCustomizationEnded()
 {
     //UE_LOG(LogTemp,Display, TEXT("PUDishCustomizationWidget::OnCustomizationEnded - Customization ended"));
@@ -275,6 +336,8 @@ void UPUDishCustomizationWidget::UpdateDishData(const FPUDishBase& NewDishData)
     
     // Update local data
     CurrentDishData = NewDishData;
+    // May come from Blueprint, which can edit IngredientInstances directly
+    CurrentDishData.MarkAggregatesDirty();
     
     // Sync back to the customization component
     if (CustomizationComponent)
@@ -447,7 +510,10 @@ void UPUDishCustomizationWidget::GoToNextStage()
         UWorld* World = GetWorld();
         if (World)
         {
-            UPUDishCustomizationWidget* NextStageWidget = CreateWidget<UPUDishCustomizationWidget>(World, NextStage);
+            // Reuse the component's widget for that stage if it has one
+            UPUDishCustomizationWidget* NextStageWidget = CustomizationComponent
+                ? Cast<UPUDishCustomizationWidget>(CustomizationComponent->AcquireStageWidget(NextStage))
+                : CreateWidget<UPUDishCustomizationWidget>(World, NextStage);
             if (NextStageWidget)
             {
                 // Ensure the new widget has the component reference
@@ -498,7 +564,10 @@ void UPUDishCustomizationWidget::GoToPreviousStage()
         UWorld* World = GetWorld();
         if (World)
         {
-            UPUDishCustomizationWidget* PreviousStageWidget = CreateWidget<UPUDishCustomizationWidget>(World, PreviousStage);
+            // Reuse the component's widget for that stage if it has one
+            UPUDishCustomizationWidget* PreviousStageWidget = CustomizationComponent
+                ? Cast<UPUDishCustomizationWidget>(CustomizationComponent->AcquireStageWidget(PreviousStage))
+                : CreateWidget<UPUDishCustomizationWidget>(World, PreviousStage);
             if (PreviousStageWidget)
             {
                 // Ensure the new widget has the component reference
@@ -550,21 +619,23 @@ void UPUDishCustomizationWidget::SetNextStage(UPUDishCustomizationWidget* Stage)
     }
 }
 
-int32 UPUDishCustomizationWidget::GenerateGUIDBasedInstanceID()
+int32 UPUDishCustomizationWidget::AllocateInstanceID()
 {
-    // Generate a GUID and convert it to a unique integer
-    FGuid NewGUID = FGuid::NewGuid();
-    
-    // Convert GUID to a unique integer using hash
-    int32 UniqueID = GetTypeHash(NewGUID);
-    
-    // Ensure it's positive (hash can be negative)
-    UniqueID = FMath::Abs(UniqueID);
-    
-    //UE_LOG(LogTemp,Display, TEXT("🔍 PUDishCustomizationWidget::GenerateGUIDBasedInstanceID - Generated GUID-based InstanceID: %d from GUID: %s"), 
-    //    UniqueID, *NewGUID.ToString());
-    
-    return UniqueID;
+    return CurrentDishData.AllocateInstanceID();
+}
+
+int32 UPUDishCustomizationWidget::GenerateGUIDBasedInstanceID(const UObject* WorldContextObject)
+{
+    UPUDishCustomizationWidget* DishWidget = const_cast<UPUDishCustomizationWidget*>(Cast<UPUDishCustomizationWidget>(WorldContextObject));
+    if (!DishWidget && WorldContextObject)
+    {
+        DishWidget = WorldContextObject->GetTypedOuter<UPUDishCustomizationWidget>();
+    }
+    if (!ensureMsgf(DishWidget, TEXT("UPUDishCustomizationWidget::GenerateGUIDBasedInstanceID - %s is not inside a dish widget to allocate an instance ID from"), *GetNameSafe(WorldContextObject)))
+    {
+        return 0;
+    }
+    return DishWidget->AllocateInstanceID();
 }
 
 void UPUDishCustomizationWidget::CreateIngredientButtons()
@@ -619,13 +690,12 @@ void UPUDishCustomizationWidget::CreateIngredientSlots()
 {
     UE_LOG(LogTemp, Warning, TEXT("🎯🎯🎯 PUDishCustomizationWidget::CreateIngredientSlots - FUNCTION CALLED! Creating ingredient slots from available ingredients"));
     
-    // Clear existing slots and shelving widgets
-    CreatedIngredientSlots.Empty();
+    // Return existing slots and shelving widgets to the pool
+    ReleaseSlotWidgets(CreatedIngredientSlots, CreatedShelvingWidgets);
     IngredientSlotMap.Empty();
     bIngredientSlotsCreated = false;
     
-    // Clear shelving widgets
-    CreatedShelvingWidgets.Empty();
+    // Reset shelving state
     CurrentShelvingWidget.Reset();
     CurrentShelvingWidgetSlotCount = 0;
     
@@ -668,8 +738,7 @@ void UPUDishCustomizationWidget::CreateIngredientSlots()
     for (const FPUIngredientBase& IngredientData : AvailableIngredients)
     {
         FIngredientInstance PantryInstance;
-        PantryInstance.IngredientData = IngredientData;
-        PantryInstance.IngredientTag = IngredientData.IngredientTag;
+        PantryInstance.SetIngredientData(IngredientData);
         PantryInstance.Quantity = 0; // Empty slot, but has ingredient data for display
         PantryInstance.InstanceID = 0; // Not a real instance, just for display
         PantryInstances.Add(PantryInstance);
@@ -741,7 +810,7 @@ void UPUDishCustomizationWidget::CreatePlatingIngredientSlots()
     {
         const FIngredientInstance& Instance = DishData.IngredientInstances[i];
         //UE_LOG(LogTemp,Display, TEXT("🍽️ DEBUG: Instance %d - %s (ID: %d, Qty: %d, Preparations: %d)"), 
-        //    i, *Instance.IngredientData.DisplayName.ToString(), Instance.InstanceID, Instance.Quantity, Instance.Preparations.Num());
+        //    i, *Instance.GetDefinition().DisplayName.ToString(), Instance.InstanceID, Instance.Quantity, Instance.Preparations.Num());
         
         // Log preparation details
         TArray<FGameplayTag> PreparationTags;
@@ -803,7 +872,7 @@ void UPUDishCustomizationWidget::EnablePlatingSlots()
             IngredientSlot->UpdateDisplay();
             
             //UE_LOG(LogTemp,Display, TEXT("🍽️ PUDishCustomizationWidget::EnablePlatingSlots - Enabled drag and updated slot display for: %s"), 
-            //    IngredientSlot->IsEmpty() ? TEXT("Empty Slot") : *IngredientSlot->GetIngredientInstance().IngredientData.DisplayName.ToString());
+            //    IngredientSlot->IsEmpty() ? TEXT("Empty Slot") : *IngredientSlot->GetIngredientInstance().GetDefinition().DisplayName.ToString());
         }
     }
 
@@ -960,17 +1029,7 @@ void UPUDishCustomizationWidget::OnQuantityControlChanged(const FIngredientInsta
     }
     
     // Update the ingredient instance in the dish data (or add if new)
-    bool bFound = false;
-    for (int32 i = 0; i < CurrentDishData.IngredientInstances.Num(); i++)
-    {
-        if (CurrentDishData.IngredientInstances[i].InstanceID == IngredientInstance.InstanceID)
-        {
-            bFound = true;
-            break;
-        }
-    }
-    
-    if (bFound)
+    if (CurrentDishData.FindInstanceIndexByID(IngredientInstance.InstanceID) != INDEX_NONE)
     {
         // Update existing instance
         UpdateIngredientInstance(IngredientInstance);
@@ -980,8 +1039,8 @@ void UPUDishCustomizationWidget::OnQuantityControlChanged(const FIngredientInsta
         // Add new instance (e.g., when ingredient is dropped on empty slot)
         //UE_LOG(LogTemp,Display, TEXT("🔍 DEBUG: Instance not found in dish data, adding new instance (ID: %d, Qty: %d)"), 
         //    IngredientInstance.InstanceID, IngredientInstance.Quantity);
-        CurrentDishData.IngredientInstances.Add(IngredientInstance);
-        UpdateDishData(CurrentDishData);
+        CurrentDishData.AddInstance(IngredientInstance);
+        CommitInstanceToComponent(IngredientInstance);
     }
 }
 
@@ -1010,8 +1069,8 @@ void UPUDishCustomizationWidget::CreateIngredientInstance(const FPUIngredientBas
     
     //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::CreateIngredientInstance - Created instance with ID: %d"), NewInstance.InstanceID);
     
-    // Update the dish data
-    UpdateDishData(CurrentDishData);
+    // Send just the new instance to the component
+    CommitInstanceToComponent(NewInstance);
     
     // Call Blueprint event to create quantity control with ingredient instance data
     OnQuantityControlCreated(nullptr, NewInstance); // Pass the ingredient instance data
@@ -1023,46 +1082,36 @@ void UPUDishCustomizationWidget::UpdateIngredientInstance(const FIngredientInsta
     //    IngredientInstance.InstanceID);
     
     // Log the preparations before updating
-    TArray<FGameplayTag> PreparationsBefore;
-    for (int32 i = 0; i < CurrentDishData.IngredientInstances.Num(); i++)
+    const int32 InstanceIndex = CurrentDishData.FindInstanceIndexByID(IngredientInstance.InstanceID);
+    if (InstanceIndex != INDEX_NONE)
     {
-        if (CurrentDishData.IngredientInstances[i].InstanceID == IngredientInstance.InstanceID)
+        TArray<FGameplayTag> PreparationsBefore;
+        CurrentDishData.IngredientInstances[InstanceIndex].Preparations.GetGameplayTagArray(PreparationsBefore);
+        //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::UpdateIngredientInstance - Instance %d had %d preparations before update:"), 
+        //    IngredientInstance.InstanceID, PreparationsBefore.Num());
+        for (const FGameplayTag& Prep : PreparationsBefore)
         {
-            CurrentDishData.IngredientInstances[i].Preparations.GetGameplayTagArray(PreparationsBefore);
-            //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::UpdateIngredientInstance - Instance %d had %d preparations before update:"), 
-            //    IngredientInstance.InstanceID, PreparationsBefore.Num());
-            for (const FGameplayTag& Prep : PreparationsBefore)
-            {
-                //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::UpdateIngredientInstance -   - %s"), *Prep.ToString());
-            }
-            break;
+            //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::UpdateIngredientInstance -   - %s"), *Prep.ToString());
         }
-    }
-    
-    // Find and update the ingredient instance in the dish data
-    for (int32 i = 0; i < CurrentDishData.IngredientInstances.Num(); i++)
-    {
-        if (CurrentDishData.IngredientInstances[i].InstanceID == IngredientInstance.InstanceID)
+
+        // Update the ingredient instance in the dish data
+        CurrentDishData.ReplaceInstanceAt(InstanceIndex, IngredientInstance);
+        
+        // Log the preparations after updating
+        TArray<FGameplayTag> PreparationsAfter;
+        IngredientInstance.Preparations.GetGameplayTagArray(PreparationsAfter);
+        //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::UpdateIngredientInstance - Instance %d now has %d preparations after update:"), 
+        //    IngredientInstance.InstanceID, PreparationsAfter.Num());
+        for (const FGameplayTag& Prep : PreparationsAfter)
         {
-            CurrentDishData.IngredientInstances[i] = IngredientInstance;
-            
-            // Log the preparations after updating
-            TArray<FGameplayTag> PreparationsAfter;
-            IngredientInstance.Preparations.GetGameplayTagArray(PreparationsAfter);
-            //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::UpdateIngredientInstance - Instance %d now has %d preparations after update:"), 
-            //    IngredientInstance.InstanceID, PreparationsAfter.Num());
-            for (const FGameplayTag& Prep : PreparationsAfter)
-            {
-                //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::UpdateIngredientInstance -   - %s"), *Prep.ToString());
-            }
-            
-            //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::UpdateIngredientInstance - Instance updated successfully"));
-            break;
+            //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::UpdateIngredientInstance -   - %s"), *Prep.ToString());
         }
+        
+        //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::UpdateIngredientInstance - Instance updated successfully"));
     }
     
-    // Update the dish data
-    UpdateDishData(CurrentDishData);
+    // Send just this instance to the component (listeners receive a delta, not the whole dish)
+    CommitInstanceToComponent(IngredientInstance);
 }
 
 void UPUDishCustomizationWidget::RemoveIngredientInstance(int32 InstanceID)
@@ -1070,18 +1119,18 @@ void UPUDishCustomizationWidget::RemoveIngredientInstance(int32 InstanceID)
     //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::RemoveIngredientInstance - Removing ingredient instance: %d"), InstanceID);
     
     // Find and remove the ingredient instance from the dish data
-    for (int32 i = 0; i < CurrentDishData.IngredientInstances.Num(); i++)
+    const int32 InstanceIndex = CurrentDishData.FindInstanceIndexByID(InstanceID);
+    if (InstanceIndex != INDEX_NONE)
     {
-        if (CurrentDishData.IngredientInstances[i].InstanceID == InstanceID)
-        {
-            CurrentDishData.IngredientInstances.RemoveAt(i);
-            //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::RemoveIngredientInstance - Instance removed successfully"));
-            break;
-        }
+        CurrentDishData.RemoveInstanceAt(InstanceIndex);
+        //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::RemoveIngredientInstance - Instance removed successfully"));
     }
     
-    // Update the dish data
-    UpdateDishData(CurrentDishData);
+    // Tell the component (listeners receive a removal delta)
+    if (CustomizationComponent)
+    {
+        CustomizationComponent->RemoveIngredientInstanceByID(InstanceID);
+    }
 }
 
 void UPUDishCustomizationWidget::RemoveIngredientInstanceByTag(const FGameplayTag& IngredientTag)
@@ -1094,16 +1143,19 @@ void UPUDishCustomizationWidget::RemoveIngredientInstanceByTag(const FGameplayTa
     for (int32 i = CurrentDishData.IngredientInstances.Num() - 1; i >= 0; i--)
     {
         const FIngredientInstance& Instance = CurrentDishData.IngredientInstances[i];
-        // Check both convenient field and data field (same logic as IsIngredientSelected)
-        FGameplayTag InstanceTag = Instance.IngredientTag.IsValid() ? Instance.IngredientTag : Instance.IngredientData.IngredientTag;
+        FGameplayTag InstanceTag = Instance.IngredientTag;
         
         if (InstanceTag == IngredientTag)
         {
-            CurrentDishData.IngredientInstances.RemoveAt(i);
+            const int32 InstanceID = Instance.InstanceID;
+            CurrentDishData.RemoveInstanceAt(i);
+            if (CustomizationComponent)
+            {
+                CustomizationComponent->RemoveIngredientInstanceByID(InstanceID);
+            }
             //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::RemoveIngredientInstanceByTag - Instance removed successfully"));
         }
     }
-    UpdateDishData(CurrentDishData);
 }
 
 void UPUDishCustomizationWidget::RefreshQuantityControls()
@@ -1131,15 +1183,15 @@ void UPUDishCustomizationWidget::OnPantrySlotClicked(UPUIngredientSlot* Ingredie
         // Handle pantry slot click - get the ingredient data directly from the slot
         const FIngredientInstance& PantryInstance = IngredientSlot->GetIngredientInstance();
         
-        if (!PantryInstance.IngredientData.IngredientTag.IsValid())
+        if (!PantryInstance.IngredientTag.IsValid())
         {
             //UE_LOG(LogTemp,Warning, TEXT("⚠️ PUDishCustomizationWidget::OnPantrySlotClicked - Pantry slot has invalid ingredient tag!"));
             return;
         }
         
         //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::OnPantrySlotClicked - Found ingredient: %s (Tag: %s), PendingEmptySlot valid: %s"), 
-        //    *PantryInstance.IngredientData.DisplayName.ToString(), 
-        //    *PantryInstance.IngredientData.IngredientTag.ToString(),
+        //    *PantryInstance.GetDefinition().DisplayName.ToString(), 
+        //    *PantryInstance.IngredientTag.ToString(),
         //    PendingEmptySlot.IsValid() ? TEXT("YES") : TEXT("NO"));
         
         // If we have a pending empty slot, populate it
@@ -1153,17 +1205,15 @@ void UPUDishCustomizationWidget::OnPantrySlotClicked(UPUIngredientSlot* Ingredie
             //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::OnPantrySlotClicked - Populating empty slot: %s"), 
             //    *EmptySlot->GetName());
             
-            // Create a new ingredient instance with GUID-based ID and quantity 1
-            // Use the ingredient data directly from the pantry slot
-            FIngredientInstance NewInstance;
-            NewInstance.IngredientData = PantryInstance.IngredientData;
-            NewInstance.InstanceID = GenerateGUIDBasedInstanceID();
+            // Create a new ingredient instance with the dish's next ID and quantity 1
+            // Start from the pantry slot's instance (shares its ingredient definition)
+            FIngredientInstance NewInstance = PantryInstance;
+            NewInstance.InstanceID = AllocateInstanceID();
             NewInstance.Quantity = 1;
-            NewInstance.IngredientTag = PantryInstance.IngredientData.IngredientTag; // Set the convenient tag field
             
             // IMPORTANT: Add to dish data FIRST before setting the ingredient instance
             // This prevents OnQuantityControlChanged from adding a duplicate when SetIngredientInstance broadcasts
-            CurrentDishData.IngredientInstances.Add(NewInstance);
+            CurrentDishData.AddInstance(NewInstance);
             
             // Bind to slot's ingredient changed event (check if already bound to avoid duplicates)
             EmptySlot->OnSlotIngredientChanged.AddUniqueDynamic(this, &UPUDishCustomizationWidget::OnQuantityControlChanged);
@@ -1172,11 +1222,11 @@ void UPUDishCustomizationWidget::OnPantrySlotClicked(UPUIngredientSlot* Ingredie
             // Since we already added it to dish data, OnQuantityControlChanged will find it and update it instead of adding a duplicate
             EmptySlot->SetIngredientInstance(NewInstance);
             
-            // Update dish data to sync changes
-            UpdateDishData(CurrentDishData);
+            // Make sure the component has the new instance (no-op if the slot broadcast already committed it)
+            CommitInstanceToComponent(NewInstance);
             
             //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::OnPantrySlotClicked - Populated empty slot with: %s (ID: %d, Qty: 1)"), 
-            //    *PantryInstance.IngredientData.DisplayName.ToString(), NewInstance.InstanceID);
+            //    *PantryInstance.GetDefinition().DisplayName.ToString(), NewInstance.InstanceID);
             
             // Clear pending empty slot
             PendingEmptySlot.Reset();
@@ -1316,6 +1366,7 @@ void UPUDishCustomizationWidget::SubscribeToEvents()
         
         //UE_LOG(LogTemp,Display, TEXT("📡 PUDishCustomizationWidget::SubscribeToEvents - Subscribing to OnDishDataUpdated"));
         CustomizationComponent->OnDishDataUpdated.AddDynamic(this, &UPUDishCustomizationWidget::OnDishDataUpdated);
+        CustomizationComponent->OnDishDelta.AddDynamic(this, &UPUDishCustomizationWidget::OnDishDeltaReceived);
         
         //UE_LOG(LogTemp,Display, TEXT("📡 PUDishCustomizationWidget::SubscribeToEvents - Subscribing to OnCustomizationEnded"));
         CustomizationComponent->OnCustomizationEnded.AddDynamic(this, &UPUDishCustomizationWidget::OnCustomizationEnded);
@@ -1339,6 +1390,7 @@ void UPUDishCustomizationWidget::UnsubscribeFromEvents()
         // Unsubscribe from the component's events
         CustomizationComponent->OnInitialDishDataReceived.RemoveDynamic(this, &UPUDishCustomizationWidget::OnInitialDishDataReceived);
         CustomizationComponent->OnDishDataUpdated.RemoveDynamic(this, &UPUDishCustomizationWidget::OnDishDataUpdated);
+        CustomizationComponent->OnDishDelta.RemoveDynamic(this, &UPUDishCustomizationWidget::OnDishDeltaReceived);
         CustomizationComponent->OnCustomizationEnded.RemoveDynamic(this, &UPUDishCustomizationWidget::OnCustomizationEnded);
     }
 }
@@ -1437,6 +1489,8 @@ void UPUDishCustomizationWidget::ToggleIngredientSelection(const FPUIngredientBa
 
 void UPUDishCustomizationWidget::UpdateRadarChartFromPlanningData()
 {
+    PU_SCOPE_TIMING(RadarChartFromPlanningData);
+    
     if (!bInPlanningMode)
     {
         return;
@@ -1444,20 +1498,18 @@ void UPUDishCustomizationWidget::UpdateRadarChartFromPlanningData()
     
     // Create a temporary dish from SelectedIngredients for the radar chart
     FPUDishBase TempDish = CurrentDishData;
-    TempDish.IngredientInstances.Empty();
+    TempDish.ClearInstances();
     
     // Convert SelectedIngredients to IngredientInstances (with quantity 1 for each)
     for (const FPUIngredientBase& SelectedIngredient : PlanningData.SelectedIngredients)
     {
         // Create a temporary instance with quantity 1
         FIngredientInstance TempInstance;
-        TempInstance.InstanceID = FPUDishBase::GenerateUniqueInstanceID();
+        TempInstance.InstanceID = TempDish.AllocateInstanceID();
         TempInstance.Quantity = 1;
-        TempInstance.IngredientData = SelectedIngredient;
-        TempInstance.IngredientTag = SelectedIngredient.IngredientTag;
-        TempInstance.Preparations = SelectedIngredient.ActivePreparations;
+        TempInstance.SetIngredientData(SelectedIngredient);
         
-        TempDish.IngredientInstances.Add(TempInstance);
+        TempDish.AddInstance(TempInstance);
     }
     
     //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::UpdateRadarChartFromPlanningData - Created temp dish with %d ingredients for radar chart"), 
@@ -1480,7 +1532,7 @@ bool UPUDishCustomizationWidget::IsIngredientSelected(const FPUIngredientBase& I
         
         // Also check IngredientInstances (in case something is there but not in SelectedIngredients yet)
         bool bInIngredientInstances = CurrentDishData.IngredientInstances.ContainsByPredicate([&](const FIngredientInstance& Instance) {
-            FGameplayTag InstanceTag = Instance.IngredientTag.IsValid() ? Instance.IngredientTag : Instance.IngredientData.IngredientTag;
+            FGameplayTag InstanceTag = Instance.IngredientTag;
             return InstanceTag == IngredientData.IngredientTag;
         });
         
@@ -1489,7 +1541,7 @@ bool UPUDishCustomizationWidget::IsIngredientSelected(const FPUIngredientBase& I
     
     // In cooking/prep mode, check IngredientInstances
     return CurrentDishData.IngredientInstances.ContainsByPredicate([&](const FIngredientInstance& Instance) {
-        FGameplayTag InstanceTag = Instance.IngredientTag.IsValid() ? Instance.IngredientTag : Instance.IngredientData.IngredientTag;
+        FGameplayTag InstanceTag = Instance.IngredientTag;
         return InstanceTag == IngredientData.IngredientTag;
     });
 }
@@ -1512,14 +1564,13 @@ void UPUDishCustomizationWidget::StartPlanningMode()
     TMap<FGameplayTag, FPUIngredientBase> UniqueIngredients;
     for (const FIngredientInstance& Instance : CurrentDishData.IngredientInstances)
     {
-        // Use convenient field if available, fallback to data field
-        FGameplayTag InstanceTag = Instance.IngredientTag.IsValid() ? Instance.IngredientTag : Instance.IngredientData.IngredientTag;
+        FGameplayTag InstanceTag = Instance.IngredientTag;
         
         // Only add if we haven't seen this ingredient tag before
         if (InstanceTag.IsValid() && !UniqueIngredients.Contains(InstanceTag))
         {
             // Use the ingredient data from the instance (which already has preparations applied)
-            UniqueIngredients.Add(InstanceTag, Instance.IngredientData);
+            UniqueIngredients.Add(InstanceTag, Instance.GetIngredientData());
             //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::StartPlanningMode - Added existing ingredient to SelectedIngredients: %s"), 
             //    *InstanceTag.ToString());
         }
@@ -1598,7 +1649,7 @@ void UPUDishCustomizationWidget::FinishPlanningAndStartCooking()
     TMap<FGameplayTag, FIngredientInstance> ExistingInstances;
     for (const FIngredientInstance& Instance : CookingDishData.IngredientInstances)
     {
-        FGameplayTag InstanceTag = Instance.IngredientTag.IsValid() ? Instance.IngredientTag : Instance.IngredientData.IngredientTag;
+        FGameplayTag InstanceTag = Instance.IngredientTag;
         if (InstanceTag.IsValid() && Instance.Quantity > 0)
         {
             ExistingInstances.Add(InstanceTag, Instance);
@@ -1606,7 +1657,7 @@ void UPUDishCustomizationWidget::FinishPlanningAndStartCooking()
     }
     
     // Clear and rebuild IngredientInstances from SelectedIngredients
-    CookingDishData.IngredientInstances.Empty();
+    CookingDishData.ClearInstances();
     
     for (const FPUIngredientBase& SelectedIngredient : PlanningData.SelectedIngredients)
     {
@@ -1614,7 +1665,7 @@ void UPUDishCustomizationWidget::FinishPlanningAndStartCooking()
         if (FIngredientInstance* ExistingInstance = ExistingInstances.Find(SelectedIngredient.IngredientTag))
         {
             // Use existing instance (preserves quantity and preparations)
-            CookingDishData.IngredientInstances.Add(*ExistingInstance);
+            CookingDishData.AddInstance(*ExistingInstance);
             //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::FinishPlanningAndStartCooking - Preserved existing instance for: %s (Qty: %d)"), 
             //    *SelectedIngredient.DisplayName.ToString(), ExistingInstance->Quantity);
         }
@@ -1675,7 +1726,7 @@ UUserWidget* UPUDishCustomizationWidget::GetOrCreateCurrentShelvingWidget(UPanel
             return nullptr;
         }
         
-        UUserWidget* NewShelvingWidget = CreateWidget<UUserWidget>(this, ShelvingWidgetClass);
+        UUserWidget* NewShelvingWidget = AcquireShelvingWidget();
         if (!NewShelvingWidget)
         {
             //UE_LOG(LogTemp,Error, TEXT("❌ PUDishCustomizationWidget::GetOrCreateCurrentShelvingWidget - Failed to create shelving widget"));
@@ -1758,6 +1809,8 @@ bool UPUDishCustomizationWidget::AddSlotToCurrentShelvingWidget(UPUIngredientSlo
 
 void UPUDishCustomizationWidget::CreateSlots(UPanelWidget* Container, EPUIngredientSlotLocation Location, int32 MaxSlots, bool bUseShelvingWidgets, bool bCreateEmptySlots, bool bEnableDrag, const TArray<FIngredientInstance>& IngredientSource, float FirstSlotLeftPadding)
 {
+    PU_SCOPE_TIMING(CreateSlots);
+    
     UE_LOG(LogTemp, Warning, TEXT("🎯🎯🎯 PUDishCustomizationWidget::CreateSlots - FUNCTION CALLED! Location: %d (Prep=%d), MaxSlots: %d"), 
         (int32)Location, (int32)EPUIngredientSlotLocation::Prep, MaxSlots);
     
@@ -1812,30 +1865,23 @@ void UPUDishCustomizationWidget::CreateSlots(UPanelWidget* Container, EPUIngredi
     // Clear existing slots if this is the first time creating them
     if (!bIngredientSlotsCreated)
     {
-        CreatedIngredientSlots.Empty();
         if (bUseShelvingWidgets)
         {
-            CreatedShelvingWidgets.Empty();
+            ReleaseSlotWidgets(CreatedIngredientSlots, CreatedShelvingWidgets);
             CurrentShelvingWidget.Reset();
             CurrentShelvingWidgetSlotCount = 0;
         }
-    }
-    
-    // Get slot class
-    TSubclassOf<UPUIngredientSlot> SlotClass;
-    if (IngredientSlotClass)
-    {
-        SlotClass = IngredientSlotClass;
-    }
-    else
-    {
-        SlotClass = UPUIngredientSlot::StaticClass();
+        else
+        {
+            TArray<UUserWidget*> NoShelvingWidgets;
+            ReleaseSlotWidgets(CreatedIngredientSlots, NoShelvingWidgets);
+        }
     }
     
     // Create slots
     for (int32 i = 0; i < NumSlotsToCreate; ++i)
     {
-        UPUIngredientSlot* IngredientSlot = CreateWidget<UPUIngredientSlot>(this, SlotClass);
+        UPUIngredientSlot* IngredientSlot = AcquireIngredientSlot(Location);
         if (!IngredientSlot)
         {
             //UE_LOG(LogTemp,Error, TEXT("❌ PUDishCustomizationWidget::CreateSlots - Failed to create ingredient slot at index %d"), i);
@@ -1843,8 +1889,6 @@ void UPUDishCustomizationWidget::CreateSlots(UPanelWidget* Container, EPUIngredi
         }
         
         // Common setup for all slots
-        IngredientSlot->SetDishCustomizationWidget(this);
-        IngredientSlot->SetLocation(Location);
         IngredientSlot->SetDragEnabled(bEnableDrag);
         
         // Set the preparation data table if available
@@ -1863,13 +1907,13 @@ void UPUDishCustomizationWidget::CreateSlots(UPanelWidget* Container, EPUIngredi
             const FIngredientInstance& IngredientInstance = (*IngredientInstancesToUse)[i];
             
             // Validate ingredient instance
-            if (IngredientInstance.IngredientData.IngredientTag.IsValid())
+            if (IngredientInstance.IngredientTag.IsValid())
             {
                 IngredientSlot->SetIngredientInstance(IngredientInstance);
                 IngredientSlot->UpdateDisplay();
                 
                 //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::CreateSlots - Created slot %d with ingredient: %s (ID: %d, Qty: %d)"), 
-                //    i, *IngredientInstance.IngredientData.DisplayName.ToString(), IngredientInstance.InstanceID, IngredientInstance.Quantity);
+                //    i, *IngredientInstance.GetDefinition().DisplayName.ToString(), IngredientInstance.InstanceID, IngredientInstance.Quantity);
             }
             else
             {
@@ -2026,8 +2070,7 @@ TArray<FIngredientInstance> UPUDishCustomizationWidget::GetIngredientInstancesFr
             // Create an ingredient instance with quantity 0 and instance ID 0
             // This is suitable for pantry/prep slots that display ingredients but aren't "active" instances
             FIngredientInstance Instance;
-            Instance.IngredientData = *Ingredient;
-            Instance.IngredientTag = Ingredient->IngredientTag;
+            Instance.SetIngredientData(*Ingredient);
             Instance.Quantity = 0; // Empty slot, but has ingredient data for display
             Instance.InstanceID = 0; // Not a real instance, just for display
             Instance.Preparations = FGameplayTagContainer(); // No preparations initially
@@ -2064,24 +2107,16 @@ void UPUDishCustomizationWidget::EnableQuantityControlDrag(bool bEnabled)
     //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::EnableQuantityControlDrag - Setting drag enabled to %s for all quantity controls"), 
     //    bEnabled ? TEXT("TRUE") : TEXT("FALSE"));
     
-    if (!QuantityControlContainer.IsValid())
-    {
-        //UE_LOG(LogTemp,Warning, TEXT("⚠️ PUDishCustomizationWidget::EnableQuantityControlDrag - QuantityControlContainer is not valid"));
-        return;
-    }
-    
-    // Get all child widgets in the container
-    TArray<UWidget*> ChildWidgets = QuantityControlContainer->GetAllChildren();
+    // Every control in this widget's hierarchy is in the registry
     int32 QuantityControlsFound = 0;
-    
-    for (UWidget* ChildWidget : ChildWidgets)
+    for (const TPair<int32, TWeakObjectPtr<UPUIngredientQuantityControl>>& Pair : QuantityControlsByInstanceID)
     {
-        if (UPUIngredientQuantityControl* QuantityControl = Cast<UPUIngredientQuantityControl>(ChildWidget))
+        if (UPUIngredientQuantityControl* QuantityControl = Pair.Value.Get())
         {
             QuantityControl->SetDragEnabled(bEnabled);
             QuantityControlsFound++;
             //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::EnableQuantityControlDrag - Set drag enabled for quantity control: %s"), 
-            //    *QuantityControl->GetIngredientInstance().IngredientData.DisplayName.ToString());
+            //    *QuantityControl->GetIngredientInstance().GetDefinition().DisplayName.ToString());
         }
     }
     
@@ -2092,118 +2127,105 @@ bool UPUDishCustomizationWidget::UpdateExistingQuantityControl(int32 InstanceID,
 {
     //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::UpdateExistingQuantityControl - Looking for quantity control with InstanceID: %d"), InstanceID);
     
-    // Try to use the bound QuantityScrollBox first, then fall back to QuantityControlContainer
-    UPanelWidget* ContainerToUse = nullptr;
-    
-    if (QuantityScrollBox)
-    {
-        ContainerToUse = QuantityScrollBox;
-        //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::UpdateExistingQuantityControl - Using bound QuantityScrollBox: %s"), *QuantityScrollBox->GetName());
-    }
-    else if (QuantityControlContainer.IsValid())
-    {
-        ContainerToUse = QuantityControlContainer.Get();
-        //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::UpdateExistingQuantityControl - Using QuantityControlContainer: %s"), *QuantityControlContainer->GetName());
-    }
-    
-    if (!ContainerToUse)
+    UPUIngredientQuantityControl* QuantityControl = FindQuantityControlByInstanceID(InstanceID);
+    if (!QuantityControl)
     {
-        //UE_LOG(LogTemp,Warning, TEXT("⚠️ PUDishCustomizationWidget::UpdateExistingQuantityControl - No container found, trying to find quantity controls automatically"));
-        
-        // Try to find the container automatically by searching for quantity controls in the widget hierarchy
-        TArray<UPUIngredientQuantityControl*> FoundQuantityControls;
-        FindQuantityControlsInHierarchy(FoundQuantityControls);
-        
-        if (FoundQuantityControls.Num() > 0)
-        {
-            //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::UpdateExistingQuantityControl - Found %d quantity controls in hierarchy"), FoundQuantityControls.Num());
-            
-            // Check if any of the found quantity controls match our InstanceID
-            for (UPUIngredientQuantityControl* QuantityControl : FoundQuantityControls)
-            {
-                if (QuantityControl && QuantityControl->GetInstanceID() == InstanceID)
-                {
-                    //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::UpdateExistingQuantityControl - Found existing quantity control for InstanceID: %d"), InstanceID);
-                    
-                    // Apply new preparations to the existing quantity control
-                    TArray<FGameplayTag> PreparationTags;
-                    NewPreparations.GetGameplayTagArray(PreparationTags);
-                    //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::UpdateExistingQuantityControl - Applying %d new preparations"), PreparationTags.Num());
-                    
-                    for (const FGameplayTag& PreparationTag : PreparationTags)
-                    {
-                        if (!QuantityControl->GetIngredientInstance().Preparations.HasTag(PreparationTag))
-                        {
-                            QuantityControl->AddPreparation(PreparationTag);
-                            //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::UpdateExistingQuantityControl - Added preparation: %s"), *PreparationTag.ToString());
-                        }
-                        else
-                        {
-                            //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::UpdateExistingQuantityControl - Preparation already exists: %s"), *PreparationTag.ToString());
-                        }
-                    }
-                    
-                    //UE_LOG(LogTemp,Display, TEXT("✅ PUDishCustomizationWidget::UpdateExistingQuantityControl - Successfully updated existing quantity control"));
-                    return true;
-                }
-            }
-        }
-        
-        //UE_LOG(LogTemp,Warning, TEXT("⚠️ PUDishCustomizationWidget::UpdateExistingQuantityControl - No quantity controls found in hierarchy"));
+        //UE_LOG(LogTemp,Display, TEXT("⚠️ PUDishCustomizationWidget::UpdateExistingQuantityControl - No existing quantity control found for InstanceID: %d"), InstanceID);
         return false;
     }
     
-    //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::UpdateExistingQuantityControl - Container is valid: %s"), *ContainerToUse->GetName());
+    //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::UpdateExistingQuantityControl - Found existing quantity control for InstanceID: %d"), InstanceID);
+    ApplyPreparationsToQuantityControl(QuantityControl, NewPreparations);
     
-    // Get all child widgets in the container
-    TArray<UWidget*> ChildWidgets = ContainerToUse->GetAllChildren();
-    //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::UpdateExistingQuantityControl - Found %d child widgets in container"), ChildWidgets.Num());
+    //UE_LOG(LogTemp,Display, TEXT("✅ PUDishCustomizationWidget::UpdateExistingQuantityControl - Successfully updated existing quantity control"));
+    return true;
+}
+
+void UPUDishCustomizationWidget::ApplyPreparationsToQuantityControl(UPUIngredientQuantityControl* QuantityControl, const FGameplayTagContainer& NewPreparations)
+{
+    // Apply new preparations to the existing quantity control
+    TArray<FGameplayTag> PreparationTags;
+    NewPreparations.GetGameplayTagArray(PreparationTags);
+    //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::ApplyPreparationsToQuantityControl - Applying %d new preparations"), PreparationTags.Num());
     
-    for (int32 i = 0; i < ChildWidgets.Num(); i++)
+    for (const FGameplayTag& PreparationTag : PreparationTags)
     {
-        UWidget* ChildWidget = ChildWidgets[i];
-        //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::UpdateExistingQuantityControl - Checking child widget %d: %s"), i, ChildWidget ? *ChildWidget->GetName() : TEXT("NULL"));
-        
-        if (UPUIngredientQuantityControl* QuantityControl = Cast<UPUIngredientQuantityControl>(ChildWidget))
+        if (!QuantityControl->GetIngredientInstance().Preparations.HasTag(PreparationTag))
         {
-            int32 ControlInstanceID = QuantityControl->GetInstanceID();
-            //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::UpdateExistingQuantityControl - Found quantity control with InstanceID: %d (looking for: %d)"), ControlInstanceID, InstanceID);
-            
-            // Check if this is the quantity control we're looking for
-            if (ControlInstanceID == InstanceID)
-            {
-                //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::UpdateExistingQuantityControl - Found existing quantity control for InstanceID: %d"), InstanceID);
-                
-                // Apply new preparations to the existing quantity control
-                TArray<FGameplayTag> PreparationTags;
-                NewPreparations.GetGameplayTagArray(PreparationTags);
-                //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::UpdateExistingQuantityControl - Applying %d new preparations"), PreparationTags.Num());
-                
-                for (const FGameplayTag& PreparationTag : PreparationTags)
-                {
-                    if (!QuantityControl->GetIngredientInstance().Preparations.HasTag(PreparationTag))
-                    {
-                        QuantityControl->AddPreparation(PreparationTag);
-                        //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::UpdateExistingQuantityControl - Added preparation: %s"), *PreparationTag.ToString());
-                    }
-                    else
-                    {
-                        //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::UpdateExistingQuantityControl - Preparation already exists: %s"), *PreparationTag.ToString());
-                    }
-                }
-                
-                //UE_LOG(LogTemp,Display, TEXT("✅ PUDishCustomizationWidget::UpdateExistingQuantityControl - Successfully updated existing quantity control"));
-                return true;
-            }
-        }
-        else
-        {
-            //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::UpdateExistingQuantityControl - Child widget %d is not a quantity control"), i);
+            QuantityControl->AddPreparation(PreparationTag);
+            //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::ApplyPreparationsToQuantityControl - Added preparation: %s"), *PreparationTag.ToString());
         }
     }
+}
+
+void UPUDishCustomizationWidget::RegisterQuantityControl(int32 InstanceID, UPUIngredientQuantityControl* QuantityControl)
+{
+    // Controls without an instance yet register again once SetIngredientInstance gives them one
+    if (InstanceID != 0 && QuantityControl)
+    {
+        QuantityControlsByInstanceID.Add(InstanceID, QuantityControl);
+    }
+}
+
+void UPUDishCustomizationWidget::UnregisterQuantityControl(int32 InstanceID, UPUIngredientQuantityControl* QuantityControl)
+{
+    // Only drop the entry if it is still this control (a replacement may have registered the same ID since)
+    const TWeakObjectPtr<UPUIngredientQuantityControl>* Registered = QuantityControlsByInstanceID.Find(InstanceID);
+    if (Registered && (!Registered->IsValid() || Registered->Get() == QuantityControl))
+    {
+        QuantityControlsByInstanceID.Remove(InstanceID);
+    }
+}
+
+UPUIngredientQuantityControl* UPUDishCustomizationWidget::FindQuantityControlByInstanceID(int32 InstanceID) const
+{
+    const TWeakObjectPtr<UPUIngredientQuantityControl>* Registered = QuantityControlsByInstanceID.Find(InstanceID);
+    UPUIngredientQuantityControl* QuantityControl = Registered ? Registered->Get() : nullptr;
+    return QuantityControl && QuantityControl->GetInstanceID() == InstanceID ? QuantityControl : nullptr;
+}
+
+void UPUDishCustomizationWidget::RegisterIngredientSlot(UPUIngredientSlot* IngredientSlot)
+{
+    // Pantry entries are display-only and prepped bowls have PreppedSlotMap
+    const int32 InstanceID = IngredientSlot ? IngredientSlot->GetIngredientInstance().InstanceID : 0;
+    if (InstanceID == 0)
+    {
+        return;
+    }
     
-    //UE_LOG(LogTemp,Display, TEXT("⚠️ PUDishCustomizationWidget::UpdateExistingQuantityControl - No existing quantity control found for InstanceID: %d"), InstanceID);
-    return false;
+    const EPUIngredientSlotLocation SlotLocation = IngredientSlot->GetLocation();
+    if (SlotLocation != EPUIngredientSlotLocation::Pantry && SlotLocation != EPUIngredientSlotLocation::Prepped)
+    {
+        IngredientSlotsByInstanceID.Add(InstanceID, IngredientSlot);
+    }
+}
+
+void UPUDishCustomizationWidget::UnregisterIngredientSlot(int32 InstanceID, UPUIngredientSlot* IngredientSlot)
+{
+    // Only drop the entry if it is still this slot (a replacement may have registered the same ID since)
+    const TWeakObjectPtr<UPUIngredientSlot>* Registered = IngredientSlotsByInstanceID.Find(InstanceID);
+    if (Registered && (!Registered->IsValid() || Registered->Get() == IngredientSlot))
+    {
+        IngredientSlotsByInstanceID.Remove(InstanceID);
+    }
+}
+
+void UPUDishCustomizationWidget::OnSlotInstanceIDChanged(UPUIngredientSlot* IngredientSlot, int32 PreviousInstanceID)
+{
+    if (!IngredientSlot)
+    {
+        return;
+    }
+    
+    UnregisterIngredientSlot(PreviousInstanceID, IngredientSlot);
+    RegisterIngredientSlot(IngredientSlot);
+}
+
+UPUIngredientSlot* UPUDishCustomizationWidget::FindIngredientSlotByInstanceID(int32 InstanceID) const
+{
+    const TWeakObjectPtr<UPUIngredientSlot>* Registered = IngredientSlotsByInstanceID.Find(InstanceID);
+    UPUIngredientSlot* IngredientSlot = Registered ? Registered->Get() : nullptr;
+    return IngredientSlot && IngredientSlot->GetIngredientInstance().InstanceID == InstanceID ? IngredientSlot : nullptr;
 }
 
 void UPUDishCustomizationWidget::FindQuantityControlsInHierarchy(TArray<UPUIngredientQuantityControl*>& OutQuantityControls)
@@ -2319,6 +2341,8 @@ void UPUDishCustomizationWidget::SetPantryContainerByName(const FName& Container
 
 void UPUDishCustomizationWidget::PopulatePantrySlots()
 {
+    PU_SCOPE_TIMING(PopulatePantrySlots);
+    
     //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::PopulatePantrySlots - Populating pantry slots"));
     
     // Check if slots were already created
@@ -2328,8 +2352,9 @@ void UPUDishCustomizationWidget::PopulatePantrySlots()
         return;
     }
     
-    // Clear any existing shelving widgets and reset state
-    CreatedPantryShelvingWidgets.Empty();
+    // Return any existing pantry slots and shelving widgets to the pool and reset state
+    ReleaseSlotWidgets(CreatedPantrySlots, CreatedPantryShelvingWidgets);
+    PantrySlotMap.Empty();
     CurrentPantryShelvingWidget.Reset();
     CurrentPantryShelvingWidgetSlotCount = 0;
     
@@ -2351,6 +2376,30 @@ void UPUDishCustomizationWidget::PopulatePantrySlots()
     TArray<FPUIngredientBase> AvailableIngredients = CustomizationComponent->GetIngredientData();
     //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::PopulatePantrySlots - Found %d available ingredients"), AvailableIngredients.Num());
     
+    // Virtualized pantry: one lightweight item per ingredient, slot widgets only for the tiles on screen
+    if (PantryTileView)
+    {
+        PantryIngredients = MoveTemp(AvailableIngredients);
+        
+        const int32 NumExistingItems = PantryItems.Num();
+        PantryItems.SetNum(PantryIngredients.Num());
+        for (int32 Index = NumExistingItems; Index < PantryItems.Num(); ++Index)
+        {
+            UPUPantryItem* PantryItem = NewObject<UPUPantryItem>(this);
+            PantryItem->DishWidget = this;
+            PantryItem->PantryIndex = Index;
+            PantryItems[Index] = PantryItem;
+        }
+        
+        PantryTileView->SetListItems(PantryItems);
+        
+        // Reused items are the same objects, so their live entries would not re-read the ingredient otherwise
+        PantryTileView->RegenerateAllEntries();
+        
+        bPantrySlotsCreated = PantryItems.Num() > 0;
+        return;
+    }
+    
     // Get the container to use
     UPanelWidget* ContainerToUse = nullptr;
     if (PantryContainer.IsValid())
@@ -2369,33 +2418,17 @@ void UPUDishCustomizationWidget::PopulatePantrySlots()
     // Create pantry slots for each available ingredient
     for (const FPUIngredientBase& IngredientData : AvailableIngredients)
     {
-        // Create ingredient slot using the Blueprint class
-        TSubclassOf<UPUIngredientSlot> SlotClass;
-        if (IngredientSlotClass)
-        {
-            SlotClass = IngredientSlotClass;
-        }
-        else
-        {
-            SlotClass = UPUIngredientSlot::StaticClass();
-        }
-        
-        UPUIngredientSlot* PantrySlot = CreateWidget<UPUIngredientSlot>(this, SlotClass);
+        // Get a pantry slot (Blueprint class) from the pool
+        UPUIngredientSlot* PantrySlot = AcquireIngredientSlot(EPUIngredientSlotLocation::Pantry);
         if (PantrySlot)
         {
-            // Set the dish widget reference for easy access
-            PantrySlot->SetDishCustomizationWidget(this);
-            // Set the location to Pantry
-            PantrySlot->SetLocation(EPUIngredientSlotLocation::Pantry);
-            
             // Enable drag and drop for pantry slots
             PantrySlot->SetDragEnabled(true);
             
             // Create a minimal ingredient instance with just the ingredient data (quantity 0)
             // This allows the slot to display the pantry texture while remaining "empty"
             FIngredientInstance PantryInstance;
-            PantryInstance.IngredientData = IngredientData;
-            PantryInstance.IngredientTag = IngredientData.IngredientTag; // Set the convenient tag field
+            PantryInstance.SetIngredientData(IngredientData);
             PantryInstance.Quantity = 0; // Empty slot, but has ingredient data for display
             PantryInstance.InstanceID = 0; // Not a real instance, just for display
             
@@ -2585,7 +2618,7 @@ UUserWidget* UPUDishCustomizationWidget::GetOrCreateCurrentPantryShelvingWidget(
             return nullptr;
         }
         
-        UUserWidget* NewShelvingWidget = CreateWidget<UUserWidget>(this, ShelvingWidgetClass);
+        UUserWidget* NewShelvingWidget = AcquireShelvingWidget();
         if (!NewShelvingWidget)
         {
             //UE_LOG(LogTemp,Error, TEXT("❌ PUDishCustomizationWidget::GetOrCreateCurrentPantryShelvingWidget - Failed to create shelving widget"));
@@ -2666,6 +2699,103 @@ bool UPUDishCustomizationWidget::AddSlotToCurrentPantryShelvingWidget(UPUIngredi
     return false;
 }
 
+void UPUDishCustomizationWidget::OnPantryEntryGenerated(UUserWidget& EntryWidget)
+{
+    if (UPUIngredientSlot* PantrySlot = Cast<UPUIngredientSlot>(&EntryWidget))
+    {
+        PantrySlot->OnEmptySlotClicked.AddUniqueDynamic(this, &UPUDishCustomizationWidget::OnPantrySlotClicked);
+    }
+}
+
+void UPUDishCustomizationWidget::OnPantryEntryReleased(UUserWidget& EntryWidget)
+{
+    if (UPUIngredientSlot* PantrySlot = Cast<UPUIngredientSlot>(&EntryWidget))
+    {
+        PantrySlot->OnEmptySlotClicked.RemoveDynamic(this, &UPUDishCustomizationWidget::OnPantrySlotClicked);
+    }
+}
+
+UPUIngredientSlot* UPUDishCustomizationWidget::AcquireIngredientSlot(EPUIngredientSlotLocation SlotLocation)
+{
+    TSubclassOf<UPUIngredientSlot> SlotClass = IngredientSlotClass ? IngredientSlotClass : TSubclassOf<UPUIngredientSlot>(UPUIngredientSlot::StaticClass());
+    
+    UPUIngredientSlot* IngredientSlot = SlotWidgetPool.GetOrCreateInstance<UPUIngredientSlot>(SlotClass);
+    if (IngredientSlot)
+    {
+        IngredientSlot->ResetForReuse(SlotLocation);
+        IngredientSlot->SetDishCustomizationWidget(this);
+    }
+    
+    return IngredientSlot;
+}
+
+UUserWidget* UPUDishCustomizationWidget::AcquireShelvingWidget()
+{
+    return ShelvingWidgetClass ? SlotWidgetPool.GetOrCreateInstance<UUserWidget>(ShelvingWidgetClass) : nullptr;
+}
+
+void UPUDishCustomizationWidget::ReleaseSlotWidget(UUserWidget* Widget)
+{
+    if (!Widget)
+    {
+        return;
+    }
+    
+    Widget->RemoveFromParent();
+    
+    if (UPUIngredientSlot* IngredientSlot = Cast<UPUIngredientSlot>(Widget))
+    {
+        UnregisterIngredientSlot(IngredientSlot->GetIngredientInstance().InstanceID, IngredientSlot);
+    }
+    
+    // Keep the Slate widget so the next acquire is just a re-parent
+    SlotWidgetPool.Release(Widget);
+}
+
+void UPUDishCustomizationWidget::ReleaseSlotWidgets(TArray<UPUIngredientSlot*>& Slots, TArray<UUserWidget*>& ShelvingWidgets)
+{
+    // Slots first, so the shelving widgets go back to the pool empty
+    for (UPUIngredientSlot* IngredientSlot : Slots)
+    {
+        ReleaseSlotWidget(IngredientSlot);
+    }
+    Slots.Reset();
+    
+    for (UUserWidget* ShelvingWidget : ShelvingWidgets)
+    {
+        ReleaseSlotWidget(ShelvingWidget);
+    }
+    ShelvingWidgets.Reset();
+}
+
+void UPUDishCustomizationWidget::ReleaseAllSlotWidgets()
+{
+    ReleaseSlotWidgets(CreatedIngredientSlots, CreatedShelvingWidgets);
+    IngredientSlotMap.Reset();
+    CurrentShelvingWidget.Reset();
+    CurrentShelvingWidgetSlotCount = 0;
+    bIngredientSlotsCreated = false;
+    
+    ReleaseSlotWidgets(CreatedPantrySlots, CreatedPantryShelvingWidgets);
+    PantrySlotMap.Reset();
+    CurrentPantryShelvingWidget.Reset();
+    CurrentPantryShelvingWidgetSlotCount = 0;
+    bPantrySlotsCreated = false;
+    
+    // The tile view releases its entries; the items themselves are kept for the next populate
+    if (PantryTileView)
+    {
+        PantryTileView->ClearListItems();
+    }
+    PantryIngredients.Reset();
+    
+    TArray<UUserWidget*> NoShelvingWidgets;
+    ReleaseSlotWidgets(CreatedPreppedSlots, NoShelvingWidgets);
+    PreppedSlotMap.Reset();
+    
+    PendingEmptySlot.Reset();
+}
+
 void UPUDishCustomizationWidget::SetPreppedIngredientContainer(UPanelWidget* Container)
 {
     PreppedIngredientContainer = Container;
@@ -2679,10 +2809,10 @@ void UPUDishCustomizationWidget::SetPreppedIngredientContainer(UPanelWidget* Con
         
         for (const FIngredientInstance& IngredientInstance : CurrentDishData.IngredientInstances)
         {
-            if (IngredientInstance.IngredientData.IngredientTag.IsValid() && IngredientInstance.Quantity > 0)
+            if (IngredientInstance.IngredientTag.IsValid() && IngredientInstance.Quantity > 0)
             {
                 //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::SetPreppedIngredientContainer - Creating prepped slot for: %s (ID: %d)"),
-                //    *IngredientInstance.IngredientData.DisplayName.ToString(), IngredientInstance.InstanceID);
+                //    *IngredientInstance.GetDefinition().DisplayName.ToString(), IngredientInstance.InstanceID);
                 CreateOrUpdatePreppedSlot(IngredientInstance);
             }
         }
@@ -2695,7 +2825,7 @@ void UPUDishCustomizationWidget::CreateOrUpdatePreppedSlot(const FIngredientInst
     if (!PreppedIngredientContainer.IsValid())
     {
         //UE_LOG(LogTemp,Warning, TEXT("⚠️ PUDishCustomizationWidget::CreateOrUpdatePreppedSlot - No prepped container set! Cannot create prepped slot for: %s"), 
-        //    *IngredientInstance.IngredientData.DisplayName.ToString());
+        //    *IngredientInstance.GetDefinition().DisplayName.ToString());
         //UE_LOG(LogTemp,Warning, TEXT("⚠️   This ingredient will be added to prepped area when container is set via SetPreppedIngredientContainer"));
         return;
     }
@@ -2707,7 +2837,7 @@ void UPUDishCustomizationWidget::CreateOrUpdatePreppedSlot(const FIngredientInst
     if (InstanceID == 0)
     {
         //UE_LOG(LogTemp,Warning, TEXT("⚠️ PUDishCustomizationWidget::CreateOrUpdatePreppedSlot - IngredientInstance has InstanceID = 0 for %s; prepped slot may not be tracked correctly."),
-        //    *IngredientInstance.IngredientData.DisplayName.ToString());
+        //    *IngredientInstance.GetDefinition().DisplayName.ToString());
     }
 
     //UE_LOG(LogTemp,Display, TEXT("🎯 PUDishCustomizationWidget::CreateOrUpdatePreppedSlot - InstanceID: %d"), InstanceID);
@@ -2727,27 +2857,10 @@ void UPUDishCustomizationWidget::CreateOrUpdatePreppedSlot(const FIngredientInst
         // Create new prepped slot
         //UE_LOG(LogTemp,Display, TEXT("✨ PUDishCustomizationWidget::CreateOrUpdatePreppedSlot - Creating new prepped slot"));
 
-        // Get the slot class
-        TSubclassOf<UPUIngredientSlot> SlotClass;
-        if (IngredientSlotClass)
-        {
-            SlotClass = IngredientSlotClass;
-        }
-        else
-        {
-            SlotClass = UPUIngredientSlot::StaticClass();
-        }
-
-        // Create the slot widget
-        UPUIngredientSlot* PreppedSlot = CreateWidget<UPUIngredientSlot>(this, SlotClass);
+        // Get the slot widget from the pool
+        UPUIngredientSlot* PreppedSlot = AcquireIngredientSlot(EPUIngredientSlotLocation::Prepped);
         if (PreppedSlot)
         {
-            // Set the dish widget reference
-            PreppedSlot->SetDishCustomizationWidget(this);
-
-            // Set the location to Prepped
-            PreppedSlot->SetLocation(EPUIngredientSlotLocation::Prepped);
-
             // Set the ingredient instance
             PreppedSlot->SetIngredientInstance(IngredientInstance);
 
@@ -2770,7 +2883,7 @@ void UPUDishCustomizationWidget::CreateOrUpdatePreppedSlot(const FIngredientInst
             TArray<FGameplayTag> PrepTags;
             IngredientInstance.Preparations.GetGameplayTagArray(PrepTags);
             //UE_LOG(LogTemp,Display, TEXT("✅ PUDishCustomizationWidget::CreateOrUpdatePreppedSlot - Created prepped slot for %s with %d preparations"),
-            //    *IngredientInstance.IngredientData.DisplayName.ToString(), PrepTags.Num());
+            //    *IngredientInstance.GetDefinition().DisplayName.ToString(), PrepTags.Num());
         }
         else
         {
@@ -2790,16 +2903,13 @@ void UPUDishCustomizationWidget::RemovePreppedSlot(const FIngredientInstance& In
     {
         //UE_LOG(LogTemp,Display, TEXT("🗑️ PUDishCustomizationWidget::RemovePreppedSlot - Removing prepped slot for InstanceID: %d"), InstanceID);
         
-        // Remove from container
-        if (SlotToRemove->GetParent())
-        {
-            SlotToRemove->RemoveFromParent();
-        }
-        
         // Remove from arrays and map
         CreatedPreppedSlots.Remove(SlotToRemove);
         PreppedSlotMap.Remove(InstanceID);
         
+        // Remove from container and return to the pool
+        ReleaseSlotWidget(SlotToRemove);
+        
         //UE_LOG(LogTemp,Display, TEXT("✅ PUDishCustomizationWidget::RemovePreppedSlot - Removed prepped slot"));
     }
     else
@@ -2917,6 +3027,13 @@ void UPUDishCustomizationWidget::SetupPantrySlotNavigation()
     // For now, we'll set up simple linear navigation (left/right, with wrap)
     const int32 SlotsPerRow = 6; // Adjust based on your pantry layout
     
+    if (PantryTileView)
+    {
+        // Virtualized pantry: entries keep no navigation links, so the tile view navigates (and scrolls) between them
+        UE_LOG(LogTemp, Log, TEXT("🎮 UPUDishCustomizationWidget::SetupPantrySlotNavigation - Pantry tile view handles navigation"));
+        return;
+    }
+    
     TArray<UPUIngredientSlot*> PantrySlots;
     for (UPUIngredientSlot* PantrySlot : CreatedPantrySlots)
     {
@@ -3017,6 +3134,38 @@ void UPUDishCustomizationWidget::SetInitialFocusForPantry()
     // Ensure this widget can receive focus first
     SetIsFocusable(true);
     
+    if (PantryTileView)
+    {
+        if (PantryItems.Num() == 0 || PantryIngredients.Num() == 0)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("🎮 UPUDishCustomizationWidget::SetInitialFocusForPantry - No pantry items found"));
+            return;
+        }
+        
+        // Only tiles on screen have entries, so bring the first one into view and focus it once the tile view has generated it
+        PantryTileView->NavigateToIndex(0);
+        
+        FTimerHandle FocusTimerHandle;
+        GetWorld()->GetTimerManager().SetTimer(FocusTimerHandle, [WeakThis = TWeakObjectPtr<UPUDishCustomizationWidget>(this)]()
+        {
+            if (!WeakThis.IsValid() || !WeakThis->PantryTileView || WeakThis->PantryItems.Num() == 0)
+            {
+                return;
+            }
+            
+            if (UPUIngredientSlot* FirstSlot = WeakThis->PantryTileView->GetEntryWidgetFromItem<UPUIngredientSlot>(WeakThis->PantryItems[0]))
+            {
+                UE_LOG(LogTemp, Log, TEXT("🎮 UPUDishCustomizationWidget::SetInitialFocusForPantry - Setting focus to pantry tile: %s"), 
+                    *FirstSlot->GetName());
+                
+                FirstSlot->SetKeyboardFocus();
+                FirstSlot->ShowFocusVisuals();
+            }
+        }, 0.2f, false);
+        
+        return;
+    }
+    
     // Find the first pantry slot and set focus to it
     for (UPUIngredientSlot* PantrySlot : CreatedPantrySlots)
     {
@@ -2,7 +2,9 @@
 
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
+#include "Blueprint/UserWidgetPool.h"
 #include "../DishCustomization/PUDishBase.h"
+#include "../DishCustomization/PUDishDelta.h"
 #include "PUIngredientButton.h"
 #include "PUIngredientQuantityControl.h"
 #include "PUPreparationCheckbox.h"
@@ -13,6 +15,8 @@
 
 class UPUDishCustomizationComponent;
 class UScrollBox;
+class UTileView;
+class UPUPantryItem;
 
 // Stage type enum for dish customization stages
 UENUM(BlueprintType)
@@ -23,7 +27,7 @@ enum class EDishCustomizationStageType : uint8
     Plating      UMETA(DisplayName = "Plating")
 };
 
-UCLASS(BlueprintType, Blueprintable)
+UCLASS(BlueprintType, Blueprintable, meta = (DisableNativeTick))
 class PROJECTUMEOWMI_API UPUDishCustomizationWidget : public UUserWidget
 {
     GENERATED_BODY()
@@ -31,9 +35,10 @@ class PROJECTUMEOWMI_API UPUDishCustomizationWidget : public UUserWidget
 public:
     UPUDishCustomizationWidget(const FObjectInitializer& ObjectInitializer);
 
+    virtual void NativeOnInitialized() override;
     virtual void NativeConstruct() override;
     virtual void NativeDestruct() override;
-    virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
+    virtual void ReleaseSlateResources(bool bReleaseChildren) override;
 
     // Event handlers for dish data
     UFUNCTION(BlueprintCallable, Category = "Dish Customization Widget")
@@ -42,6 +47,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Dish Customization Widget")
     void OnDishDataUpdated(const FPUDishBase& UpdatedDishData);
 
+    // Per-instance change from the component - patches CurrentDishData instead of replacing it
+    UFUNCTION(BlueprintCallable, Category = "Dish Customization Widget")
+    void OnDishDeltaReceived(const FDishDelta& Delta);
+
     UFUNCTION(BlueprintCallable, Category = "Dish Customization Widget")
     void OnCustomizationEnded();
 
@@ -57,9 +66,14 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Dish Customization Widget")
     const FPUDishBase& GetCurrentDishData() const { return CurrentDishData; }
 
-    // GUID-based unique ID generation for ingredient instances
+    // Reserve an ID for a new ingredient instance from the current dish's allocator
     UFUNCTION(BlueprintCallable, Category = "Dish Customization Widget|Ingredients")
-    static int32 GenerateGUIDBasedInstanceID();
+    int32 AllocateInstanceID();
+
+    // @deprecated Static like the old GUID hash, but forwards to AllocateInstanceID on the dish widget that
+    // WorldContextObject belongs to (the dish widget itself or any widget created inside it). Returns 0 if there is none.
+    UFUNCTION(BlueprintCallable, Category = "Dish Customization Widget|Ingredients", meta = (WorldContext = "WorldContextObject", DeprecatedFunction, DeprecationMessage = "Use AllocateInstanceID instead."))
+    static int32 GenerateGUIDBasedInstanceID(const UObject* WorldContextObject);
 
     // End customization function for UI buttons
     UFUNCTION(BlueprintCallable, Category = "Dish Customization Widget")
@@ -151,6 +165,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Dish Customization Widget|Ingredients")
     void OnQuantityControlRemoved(int32 InstanceID, class UPUIngredientQuantityControl* QuantityControlWidget);
 
+    // Replace one instance in the dish and send just that instance to the customization component
+    UFUNCTION(BlueprintCallable, Category = "Dish Customization Widget|Ingredients")
+    void UpdateIngredientInstance(const FIngredientInstance& IngredientInstance);
+
     // Plating stage functions
     UFUNCTION(BlueprintCallable, Category = "Dish Customization Widget|Plating")
     void CreatePlatingIngredientSlots();
@@ -240,6 +258,24 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Dish Customization Widget|Ingredients")
     void FindQuantityControlsInHierarchy(TArray<UPUIngredientQuantityControl*>& OutQuantityControls);
 
+    // Instance ID registries (O(1) per-instance lookups instead of walking the widget tree)
+    // Quantity controls in this widget's hierarchy register themselves when constructed and unregister when destructed.
+    void RegisterQuantityControl(int32 InstanceID, UPUIngredientQuantityControl* QuantityControl);
+    void UnregisterQuantityControl(int32 InstanceID, UPUIngredientQuantityControl* QuantityControl);
+
+    UFUNCTION(BlueprintCallable, Category = "Dish Customization Widget|Ingredients")
+    UPUIngredientQuantityControl* FindQuantityControlByInstanceID(int32 InstanceID) const;
+
+    // Ingredient slots register when constructed (pooled or placed in the designer), unregister when destructed
+    // or released, and report when the instance they show changes.
+    void RegisterIngredientSlot(class UPUIngredientSlot* IngredientSlot);
+    void UnregisterIngredientSlot(int32 InstanceID, class UPUIngredientSlot* IngredientSlot);
+    void OnSlotInstanceIDChanged(class UPUIngredientSlot* IngredientSlot, int32 PreviousInstanceID);
+
+    // Ingredient (prep / active / plating) slot showing the given instance, nullptr if none
+    UFUNCTION(BlueprintCallable, Category = "Dish Customization Widget|Ingredients")
+    class UPUIngredientSlot* FindIngredientSlotByInstanceID(int32 InstanceID) const;
+
     // Pantry Functions
     UFUNCTION(BlueprintCallable, Category = "Dish Customization Widget|Pantry")
     void PopulatePantrySlots();
@@ -265,6 +301,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Dish Customization Widget|Pantry")
     void SetPantryContainerByName(const FName& ContainerName);
 
+    // Ingredient shown by pantry tile Index (nullptr if out of range)
+    const FPUIngredientBase* GetPantryIngredient(int32 Index) const { return PantryIngredients.IsValidIndex(Index) ? &PantryIngredients[Index] : nullptr; }
+
     // Handle empty slot click (opens pantry)
     UFUNCTION()
     void OnEmptySlotClicked(class UPUIngredientSlot* IngredientSlot);
@@ -417,14 +456,33 @@ protected:
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Dish Customization Widget|Prepped")
     TMap<int32, class UPUIngredientSlot*> PreppedSlotMap;
 
+    // InstanceID -> quantity control / ingredient slot (see RegisterQuantityControl, RegisterIngredientSlot).
+    // Weak so a widget destroyed without unregistering never dangles; lookups also check the ID still matches.
+    TMap<int32, TWeakObjectPtr<UPUIngredientQuantityControl>> QuantityControlsByInstanceID;
+    TMap<int32, TWeakObjectPtr<class UPUIngredientSlot>> IngredientSlotsByInstanceID;
+
     // Widget reference for pantry container (set in Blueprint)
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dish Customization Widget|Pantry")
     TWeakObjectPtr<class UPanelWidget> PantryContainer;
 
-    // Store references to pantry slots by ingredient tag (for quick lookup)
+    // Store references to pantry slots by ingredient tag (for quick lookup; shelved pantry only)
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Dish Customization Widget|Pantry")
     TMap<FGameplayTag, class UPUIngredientSlot*> PantrySlotMap;
 
+    // Optional virtualized pantry. When bound, the pantry is one UPUPantryItem per ingredient and the tile view only
+    // keeps slot widgets (its entry class must be a UPUIngredientSlot) for the tiles on screen, recycling them as it scrolls.
+    // Without it the pantry is built as shelving widgets in PantryContainer.
+    UPROPERTY(BlueprintReadOnly, meta=(BindWidgetOptional), Category = "Dish Customization Widget|Pantry")
+    UTileView* PantryTileView = nullptr;
+
+    // Ingredients behind the pantry tiles (PantryItems[i] shows PantryIngredients[i])
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Dish Customization Widget|Pantry")
+    TArray<FPUIngredientBase> PantryIngredients;
+
+    // Pantry tile view items, kept across repopulates
+    UPROPERTY(Transient)
+    TArray<UPUPantryItem*> PantryItems;
+
     // Reference to the empty slot that triggered pantry open (for populating after selection)
     UPROPERTY()
     TWeakObjectPtr<class UPUIngredientSlot> PendingEmptySlot;
@@ -452,6 +510,16 @@ protected:
     UFUNCTION(BlueprintImplementableEvent, Category = "Dish Customization Widget")
     void OnDishDataChanged(const FPUDishBase& DishData);
 
+    // Called after a dish delta has been applied to CurrentDishData.
+    // Default implementation raises OnDishInstanceChanged for the one instance that changed. Blueprints that
+    // don't implement OnDishInstanceChanged get OnDishDataChanged (a full copy of the dish) instead.
+    UFUNCTION(BlueprintNativeEvent, Category = "Dish Customization Widget")
+    void OnDishDeltaApplied(const FDishDelta& Delta);
+
+    // One instance changed. Instance is its patched state (default-constructed if it was removed).
+    UFUNCTION(BlueprintImplementableEvent, Category = "Dish Customization Widget")
+    void OnDishInstanceChanged(const FDishDelta& Delta, const FIngredientInstance& Instance);
+
     UFUNCTION(BlueprintImplementableEvent, Category = "Dish Customization Widget")
     void OnCustomizationModeEnded();
 
@@ -492,13 +560,15 @@ private:
 
     void SubscribeToEvents();
     void UnsubscribeFromEvents();
+
+    // Send one changed instance to the component (broadcast to listeners as a dish delta)
+    void CommitInstanceToComponent(const FIngredientInstance& IngredientInstance);
     
     // Helper function to update radar chart from planning data
     void UpdateRadarChartFromPlanningData();
 
     // Helper functions
     void CreateIngredientInstance(const FPUIngredientBase& IngredientData);
-    void UpdateIngredientInstance(const FIngredientInstance& IngredientInstance);
     void RefreshQuantityControls();
     
     // Handle pantry slot clicks
@@ -514,9 +584,27 @@ private:
     // Recursive helper function to find quantity controls
     void FindQuantityControlsRecursive(UWidget* ParentWidget, TArray<UPUIngredientQuantityControl*>& OutQuantityControls);
 
+    // Add any preparations the control does not have yet
+    void ApplyPreparationsToQuantityControl(UPUIngredientQuantityControl* QuantityControl, const FGameplayTagContainer& NewPreparations);
+
     // Helper function to get or create a current pantry shelving widget
     UUserWidget* GetOrCreateCurrentPantryShelvingWidget(UPanelWidget* ContainerToUse);
     
     // Helper function to add a slot to the current pantry shelving widget
     bool AddSlotToCurrentPantryShelvingWidget(class UPUIngredientSlot* IngredientSlot);
+
+    // Pantry tile view entries come and go as it scrolls; each live one forwards its click to OnPantrySlotClicked
+    void OnPantryEntryGenerated(UUserWidget& EntryWidget);
+    void OnPantryEntryReleased(UUserWidget& EntryWidget);
+
+    // Slot / shelving factory. Every ingredient slot and shelving widget this stage shows comes from SlotWidgetPool
+    // and goes back to it when the stage rebuilds or leaves the screen, so revisiting a stage reuses the widget trees.
+    class UPUIngredientSlot* AcquireIngredientSlot(EPUIngredientSlotLocation SlotLocation);
+    UUserWidget* AcquireShelvingWidget();
+    void ReleaseSlotWidget(UUserWidget* Widget);
+    void ReleaseSlotWidgets(TArray<class UPUIngredientSlot*>& Slots, TArray<UUserWidget*>& ShelvingWidgets);
+    void ReleaseAllSlotWidgets();
+
+    UPROPERTY(Transient)
+    FUserWidgetPool SlotWidgetPool;
 }; 
\ No newline at end of file
@@ -7,8 +7,8 @@
 #include "Blueprint/UserWidget.h"
 #include "Components/SlateWrapperTypes.h"
 #include "GameplayTagContainer.h"
-#include "Kismet/GameplayStatics.h"
 #include "../DishCustomization/PUDishCustomizationComponent.h"
+#include "../DishCustomization/PUStationRegistrySubsystem.h"
 
 UPUIngredientButton::UPUIngredientButton(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -180,8 +180,9 @@ void UPUIngredientButton::SetDragEnabled(bool bEnabled)
 
 int32 UPUIngredientButton::GenerateUniqueInstanceID() const
 {
-    // Call the static GUID-based function from PUDishCustomizationWidget
-    int32 UniqueID = UPUDishCustomizationWidget::GenerateGUIDBasedInstanceID();
+    // Same allocator as the slots: the dish of the widget this button lives in
+    UPUDishCustomizationWidget* DishWidget = GetTypedOuter<UPUDishCustomizationWidget>();
+    int32 UniqueID = DishWidget ? DishWidget->AllocateInstanceID() : 0;
     
     //UE_LOG(LogTemp,Display, TEXT("🎯 PUIngredientButton::GenerateUniqueInstanceID - Generated unique ID %d for ingredient: %s"), 
     //    UniqueID, *IngredientData.DisplayName.ToString());
@@ -193,14 +194,14 @@ int32 UPUIngredientButton::GenerateUniqueInstanceID() const
 void UPUIngredientButton::SetIngredientInstance(const FIngredientInstance& InInstance)
 {
     //UE_LOG(LogTemp,Display, TEXT("🍽️ PUIngredientButton::SetIngredientInstance - Setting ingredient instance: %s (ID: %d, Qty: %d)"), 
-    //    *InInstance.IngredientData.DisplayName.ToString(), InInstance.InstanceID, InInstance.Quantity);
+    //    *InInstance.GetDefinition().DisplayName.ToString(), InInstance.InstanceID, InInstance.Quantity);
     
     IngredientInstance = InInstance;
     MaxQuantity = InInstance.Quantity;
     RemainingQuantity = MaxQuantity;
     
     // Update the base ingredient data as well
-    IngredientData = InInstance.IngredientData;
+    IngredientData = InInstance.GetIngredientData();
     
     // Update all displays
     UpdatePlatingDisplay();
@@ -257,14 +258,14 @@ void UPUIngredientButton::UpdatePlatingDisplay()
     // Update the ingredient icon/texture
     if (IngredientIcon)
     {
-        IngredientIcon->SetBrushFromTexture(IngredientInstance.IngredientData.PreviewTexture);
+        IngredientIcon->SetBrushFromTexture(IngredientInstance.GetDefinition().PreviewTexture);
         //UE_LOG(LogTemp,Display, TEXT("🍽️ PUIngredientButton::UpdatePlatingDisplay - Updated icon texture"));
     }
     
     // Update the main ingredient name to include preparation state
     if (IngredientNameText)
     {
-        FString DisplayName = IngredientInstance.IngredientData.DisplayName.ToString();
+        FString DisplayName = IngredientInstance.GetDefinition().DisplayName.ToString();
         
         // Add preparation state to the name
         FString PrepText = GetPreparationDisplayText();
@@ -308,7 +309,7 @@ void UPUIngredientButton::UpdatePreparationDisplay()
 void UPUIngredientButton::SpawnIngredientAtPosition(const FVector2D& ScreenPosition)
 {
     //UE_LOG(LogTemp,Display, TEXT("🍽️ PUIngredientButton::SpawnIngredientAtPosition - START - Ingredient %s at screen position (%.2f,%.2f)"), 
-    //    *IngredientInstance.IngredientData.DisplayName.ToString(), ScreenPosition.X, ScreenPosition.Y);
+    //    *IngredientInstance.GetDefinition().DisplayName.ToString(), ScreenPosition.X, ScreenPosition.Y);
 
     // Convert screen position to world position using raycast
     APlayerController* PlayerController = GetOwningPlayer();
@@ -331,18 +332,8 @@ void UPUIngredientButton::SpawnIngredientAtPosition(const FVector2D& ScreenPosit
     //    ViewportSizeX, ViewportSizeY, ScreenPosition.X, ScreenPosition.Y);
     
     // Find the dish customization station in the world
-    TArray<AActor*> FoundActors;
-    UGameplayStatics::GetAllActorsOfClass(GetWorld(), AActor::StaticClass(), FoundActors);
-    
-    AActor* DishStation = nullptr;
-    for (AActor* Actor : FoundActors)
-    {
-        if (Actor && (Actor->GetName().Contains(TEXT("CookingStation")) || Actor->GetName().Contains(TEXT("DishCustomization"))))
-        {
-            DishStation = Actor;
-            break;
-        }
-    }
+    UPUStationRegistrySubsystem* StationRegistry = UPUStationRegistrySubsystem::Get(this);
+    AActor* DishStation = StationRegistry ? StationRegistry->FindDishStation() : nullptr;
     
     // Declare spawn position at function level
     FVector SpawnPosition;
@@ -400,7 +391,7 @@ void UPUIngredientButton::SpawnIngredientAtPosition(const FVector2D& ScreenPosit
 UPUIngredientDragDropOperation* UPUIngredientButton::CreateIngredientDragDropOperation() const
 {
     //UE_LOG(LogTemp,Display, TEXT("🍽️ PUIngredientButton::CreateIngredientDragDropOperation - Creating drag operation for ingredient %s (ID: %d, Qty: %d)"), 
-    //    *IngredientInstance.IngredientData.DisplayName.ToString(), IngredientInstance.InstanceID, IngredientInstance.Quantity);
+    //    *IngredientInstance.GetDefinition().DisplayName.ToString(), IngredientInstance.InstanceID, IngredientInstance.Quantity);
 
     // Create the drag drop operation
     UPUIngredientDragDropOperation* DragOperation = NewObject<UPUIngredientDragDropOperation>(GetWorld(), UPUIngredientDragDropOperation::StaticClass());
@@ -1,5 +1,4 @@
 #include "PUIngredientDragDropOperation.h"
-#include "PUDishCustomizationWidget.h"
 
 // Debug output toggles (kept in code, but disabled by default to avoid log spam).
 namespace
@@ -16,33 +15,24 @@ void UPUIngredientDragDropOperation::SetupIngredientDrag(const FIngredientInstan
 {
     IngredientInstance = InIngredientInstance;
     
-    // Ensure IngredientTag is set from IngredientData if not already set
-    if (!IngredientInstance.IngredientTag.IsValid() && IngredientInstance.IngredientData.IngredientTag.IsValid())
-    {
-        IngredientInstance.IngredientTag = IngredientInstance.IngredientData.IngredientTag;
-    }
-    
-    // Generate a unique ID if none provided (InstanceID == 0)
-    // This happens when dragging from pantry slots
+    // No ID yet (InstanceID == 0) means the drag came from a pantry slot.
+    // The ID stays 0 until the drop: the target slot allocates it from its dish, so cancelled drags use none up.
     bool bFromPantry = (IngredientInstance.InstanceID == 0);
     if (bFromPantry)
     {
-        // Use GUID-based unique ID generation
-        IngredientInstance.InstanceID = UPUDishCustomizationWidget::GenerateGUIDBasedInstanceID();
         // Set quantity to 1 when dragging from pantry
         IngredientInstance.Quantity = 1;
 
         if (bPU_LogIngredientDragDebug)
         {
-            //UE_LOG(LogTemp,Display, TEXT("🔍 Generated GUID-based InstanceID: %d (from pantry, quantity set to 1, tag: %s)"), 
-            //    IngredientInstance.InstanceID, *IngredientInstance.IngredientTag.ToString());
+            //UE_LOG(LogTemp,Display, TEXT("🔍 Pantry drag (quantity set to 1, tag: %s)"), *IngredientInstance.IngredientTag.ToString());
         }
     }
 
     if (bPU_LogIngredientDragDebug)
     {
         //UE_LOG(LogTemp,Display, TEXT("🍽️ UPUIngredientDragDropOperation::SetupIngredientDrag - Set up drag for ingredient %s (ID: %d, Qty: %d, Tag: %s, FromPantry: %s)"), 
-        //    *IngredientInstance.IngredientData.DisplayName.ToString(), IngredientInstance.InstanceID, IngredientInstance.Quantity,
+        //    *IngredientInstance.GetDefinition().DisplayName.ToString(), IngredientInstance.InstanceID, IngredientInstance.Quantity,
         //    *IngredientInstance.IngredientTag.ToString(), bFromPantry ? TEXT("YES") : TEXT("NO"));
     }
 }
@@ -7,6 +7,8 @@
 #include "PUPreparationCheckbox.h"
 #include "../DishCustomization/PUPreparationBase.h"
 #include "PUIngredientDragDropOperation.h"
+#include "PUDishCustomizationWidget.h"
+#include "PUIngredientSlot.h"
 #include "Blueprint/UserWidget.h"
 #include "Components/SlateWrapperTypes.h"
 #include "GameplayTagContainer.h"
@@ -47,6 +49,9 @@ void UPUIngredientQuantityControl::NativeConstruct()
         //UE_LOG(LogTemp,Display, TEXT("🎯 PUIngredientQuantityControl::NativeConstruct - Remove button event bound"));
     }
     
+    // Constructed again each time it is (re)added to a live hierarchy
+    RegisterWithDishWidget();
+    
     //UE_LOG(LogTemp,Display, TEXT("🎯 PUIngredientQuantityControl::NativeConstruct - Widget setup complete"));
 }
 
@@ -73,23 +78,31 @@ void UPUIngredientQuantityControl::NativeDestruct()
     // Clear preparation checkboxes
     ClearPreparationCheckboxes();
     
+    UnregisterFromDishWidget();
+    
     Super::NativeDestruct();
 }
 
 void UPUIngredientQuantityControl::SetIngredientInstance(const FIngredientInstance& InIngredientInstance)
 {
     //UE_LOG(LogTemp,Display, TEXT("🎯 PUIngredientQuantityControl::SetIngredientInstance - Setting ingredient instance: %s (ID: %d)"), 
-    //    *InIngredientInstance.IngredientData.DisplayName.ToString(), InIngredientInstance.InstanceID);
+    //    *InIngredientInstance.GetDefinition().DisplayName.ToString(), InIngredientInstance.InstanceID);
     
     // Update ingredient instance data
     IngredientInstance = InIngredientInstance;
     
+    // Re-key the dish widget's registry entry if this control now shows a different instance
+    if (RegisteredDishWidget.IsValid() && RegisteredInstanceID != IngredientInstance.InstanceID)
+    {
+        RegisterWithDishWidget();
+    }
+    
     // Update UI components
     UpdateIngredientDisplay();
     
-    if (IngredientIcon && IngredientInstance.IngredientData.PreviewTexture)
+    if (IngredientIcon && IngredientInstance.GetDefinition().PreviewTexture)
     {
-        IngredientIcon->SetBrushFromTexture(IngredientInstance.IngredientData.PreviewTexture);
+        IngredientIcon->SetBrushFromTexture(IngredientInstance.GetDefinition().PreviewTexture);
         //UE_LOG(LogTemp,Display, TEXT("🎯 PUIngredientQuantityControl::SetIngredientInstance - Updated ingredient icon"));
     }
     
@@ -171,9 +184,6 @@ void UPUIngredientQuantityControl::AddPreparation(const FGameplayTag& Preparatio
         
         IngredientInstance.Preparations.AddTag(PreparationTag);
         
-        // Update the ingredient data with the new preparation
-        IngredientInstance.IngredientData.ActivePreparations = IngredientInstance.Preparations;
-        
         // Log the current preparation state
         TArray<FGameplayTag> CurrentPreparations;
         IngredientInstance.Preparations.GetGameplayTagArray(CurrentPreparations);
@@ -204,9 +214,6 @@ void UPUIngredientQuantityControl::RemovePreparation(const FGameplayTag& Prepara
         
         IngredientInstance.Preparations.RemoveTag(PreparationTag);
         
-        // Update the ingredient data with the new preparation state
-        IngredientInstance.IngredientData.ActivePreparations = IngredientInstance.Preparations;
-        
         // Log the current preparation state
         TArray<FGameplayTag> CurrentPreparations;
         IngredientInstance.Preparations.GetGameplayTagArray(CurrentPreparations);
@@ -259,7 +266,7 @@ void UPUIngredientQuantityControl::IncreaseQuantity()
 {
     //UE_LOG(LogTemp,Display, TEXT("🎯 PUIngredientQuantityControl::IncreaseQuantity - Increasing quantity"));
     
-    int32 NewQuantity = FMath::Min(IngredientInstance.Quantity + 1, IngredientInstance.IngredientData.MaxQuantity);
+    int32 NewQuantity = FMath::Min(IngredientInstance.Quantity + 1, IngredientInstance.GetDefinition().MaxQuantity);
     SetQuantity(NewQuantity);
 }
 
@@ -270,7 +277,7 @@ void UPUIngredientQuantityControl::DecreaseQuantity()
     int32 NewQuantity = IngredientInstance.Quantity - 1;
     
     // Get minimum quantity from ingredient data
-    int32 MinQuantity = IngredientInstance.IngredientData.MinQuantity;
+    int32 MinQuantity = IngredientInstance.GetDefinition().MinQuantity;
     
     // Clamp to minimum quantity first - don't allow going below minimum
     NewQuantity = FMath::Max(NewQuantity, MinQuantity);
@@ -329,13 +336,13 @@ void UPUIngredientQuantityControl::UpdateQuantityControls()
     
     if (DecreaseQuantityButton)
     {
-        bool bCanDecrease = IngredientInstance.Quantity > IngredientInstance.IngredientData.MinQuantity;
+        bool bCanDecrease = IngredientInstance.Quantity > IngredientInstance.GetDefinition().MinQuantity;
         DecreaseQuantityButton->SetIsEnabled(bCanDecrease);
     }
     
     if (IncreaseQuantityButton)
     {
-        bool bCanIncrease = IngredientInstance.Quantity < IngredientInstance.IngredientData.MaxQuantity;
+        bool bCanIncrease = IngredientInstance.Quantity < IngredientInstance.GetDefinition().MaxQuantity;
         IncreaseQuantityButton->SetIsEnabled(bCanIncrease);
     }
     
@@ -346,39 +353,58 @@ void UPUIngredientQuantityControl::UpdatePreparationCheckboxes()
 {
     //UE_LOG(LogTemp,Display, TEXT("🎯 PUIngredientQuantityControl::UpdatePreparationCheckboxes - Updating preparation checkboxes"));
     
-    // Clear existing checkboxes
-    ClearPreparationCheckboxes();
-    
     // Check if we have a preparation data table
-    if (!IngredientInstance.IngredientData.PreparationDataTable.IsValid())
+    if (!IngredientInstance.GetDefinition().PreparationDataTable.IsValid())
     {
         //UE_LOG(LogTemp,Warning, TEXT("🎯 PUIngredientQuantityControl::UpdatePreparationCheckboxes - No preparation data table available"));
+        ClearPreparationCheckboxes();
         return;
     }
     
-    UDataTable* LoadedPreparationDataTable = IngredientInstance.IngredientData.PreparationDataTable.LoadSynchronous();
+    UDataTable* LoadedPreparationDataTable = IngredientInstance.GetDefinition().PreparationDataTable.LoadSynchronous();
     if (!LoadedPreparationDataTable)
     {
         //UE_LOG(LogTemp,Warning, TEXT("🎯 PUIngredientQuantityControl::UpdatePreparationCheckboxes - Failed to load preparation data table"));
+        ClearPreparationCheckboxes();
         return;
     }
     
     TArray<FPUPreparationBase*> PreparationRows;
     LoadedPreparationDataTable->GetAllRows<FPUPreparationBase>(TEXT("UpdatePreparationCheckboxes"), PreparationRows);
+    PreparationRows.RemoveAll([](const FPUPreparationBase* PreparationData) { return !PreparationData || !PreparationData->PreparationTag.IsValid(); });
     
     //UE_LOG(LogTemp,Display, TEXT("🎯 PUIngredientQuantityControl::UpdatePreparationCheckboxes - Found %d preparation options"), PreparationRows.Num());
     
-    // Create checkboxes for each available preparation
-    for (FPUPreparationBase* PreparationData : PreparationRows)
+    // Same preparations as the checkboxes already show (the usual case after toggling one): only update the checked
+    // states, so the scroll box keeps its children and its cached layout
+    bool bCheckboxesMatch = PreparationsScrollBox && PreparationsScrollBox->GetChildrenCount() == PreparationRows.Num();
+    for (int32 i = 0; bCheckboxesMatch && i < PreparationRows.Num(); ++i)
     {
-        if (PreparationData && PreparationData->PreparationTag.IsValid())
+        const UPUPreparationCheckbox* PreparationCheckbox = Cast<UPUPreparationCheckbox>(PreparationsScrollBox->GetChildAt(i));
+        bCheckboxesMatch = PreparationCheckbox && PreparationCheckbox->GetPreparationTag() == PreparationRows[i]->PreparationTag;
+    }
+    
+    if (bCheckboxesMatch)
+    {
+        for (int32 i = 0; i < PreparationRows.Num(); ++i)
         {
-            // Check if this preparation is currently applied
-            bool bIsCurrentlyApplied = IngredientInstance.Preparations.HasTag(PreparationData->PreparationTag);
-            
-            // Create the checkbox
-            CreatePreparationCheckbox(*PreparationData, bIsCurrentlyApplied);
+            UPUPreparationCheckbox* PreparationCheckbox = CastChecked<UPUPreparationCheckbox>(PreparationsScrollBox->GetChildAt(i));
+            PreparationCheckbox->SetChecked(IngredientInstance.Preparations.HasTag(PreparationRows[i]->PreparationTag));
         }
+        return;
+    }
+    
+    // Clear existing checkboxes
+    ClearPreparationCheckboxes();
+    
+    // Create checkboxes for each available preparation
+    for (FPUPreparationBase* PreparationData : PreparationRows)
+    {
+        // Check if this preparation is currently applied
+        bool bIsCurrentlyApplied = IngredientInstance.Preparations.HasTag(PreparationData->PreparationTag);
+        
+        // Create the checkbox
+        CreatePreparationCheckbox(*PreparationData, bIsCurrentlyApplied);
     }
     
     //UE_LOG(LogTemp,Display, TEXT("🎯 PUIngredientQuantityControl::UpdatePreparationCheckboxes - Preparation checkboxes updated successfully"));
@@ -387,7 +413,7 @@ void UPUIngredientQuantityControl::UpdatePreparationCheckboxes()
 void UPUIngredientQuantityControl::UpdateIngredientDisplay()
 {
     // Get the current display name (which includes preparation modifications)
-    FText CurrentDisplayName = IngredientInstance.IngredientData.GetCurrentDisplayName();
+    FText CurrentDisplayName = IngredientInstance.GetCurrentDisplayName();
     
     // Update the ingredient name text
     if (IngredientNameText)
@@ -470,7 +496,7 @@ void UPUIngredientQuantityControl::CreatePreparationCheckbox(const FPUPreparatio
 FReply UPUIngredientQuantityControl::NativeOnMouseButtonDown(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent)
 {
     //UE_LOG(LogTemp,Display, TEXT("🎯 PUIngredientQuantityControl::NativeOnMouseButtonDown - Mouse button down on quantity control: %s (Drag enabled: %s)"), 
-    //    *IngredientInstance.IngredientData.DisplayName.ToString(), bDragEnabled ? TEXT("TRUE") : TEXT("FALSE"));
+    //    *IngredientInstance.GetDefinition().DisplayName.ToString(), bDragEnabled ? TEXT("TRUE") : TEXT("FALSE"));
     
     // Only handle left mouse button and only if drag is enabled
     if (InMouseEvent.GetEffectingButton() == EKeys::LeftMouseButton && bDragEnabled)
@@ -485,7 +511,7 @@ FReply UPUIngredientQuantityControl::NativeOnMouseButtonDown(const FGeometry& In
 void UPUIngredientQuantityControl::SetDragEnabled(bool bEnabled)
 {
     //UE_LOG(LogTemp,Display, TEXT("🎯 PUIngredientQuantityControl::SetDragEnabled - Setting drag enabled to %s for quantity control: %s"), 
-    //    bEnabled ? TEXT("TRUE") : TEXT("FALSE"), *IngredientInstance.IngredientData.DisplayName.ToString());
+    //    bEnabled ? TEXT("TRUE") : TEXT("FALSE"), *IngredientInstance.GetDefinition().DisplayName.ToString());
     
     bDragEnabled = bEnabled;
 }
@@ -493,7 +519,7 @@ void UPUIngredientQuantityControl::SetDragEnabled(bool bEnabled)
 UPUIngredientDragDropOperation* UPUIngredientQuantityControl::CreateDragDropOperation() const
 {
     //UE_LOG(LogTemp,Display, TEXT("🎯 PUIngredientQuantityControl::CreateDragDropOperation - Creating drag operation for quantity control %s (ID: %d, Qty: %d)"), 
-    //    *IngredientInstance.IngredientData.DisplayName.ToString(), IngredientInstance.InstanceID, IngredientInstance.Quantity);
+    //    *IngredientInstance.GetDefinition().DisplayName.ToString(), IngredientInstance.InstanceID, IngredientInstance.Quantity);
 
     // Create the drag drop operation
     UPUIngredientDragDropOperation* DragOperation = NewObject<UPUIngredientDragDropOperation>(GetWorld(), UPUIngredientDragDropOperation::StaticClass());
@@ -519,4 +545,62 @@ FReply UPUIngredientQuantityControl::NativeOnKeyDown(const FGeometry& InGeometry
     // Always return Unhandled so navigation passes through to ingredient slots
     // This allows controller navigation to work properly without quantity controls interfering
     return FReply::Unhandled();
-} 
\ No newline at end of file
+} 
+
+UPUDishCustomizationWidget* UPUIngredientQuantityControl::FindOwningDishWidget() const
+{
+    // Climb panel parents to the root of each widget tree, then on to the user widget that owns that tree
+    const UWidget* Widget = this;
+    for (int32 Depth = 0; Widget && Depth < 10; ++Depth)
+    {
+        // Not inside a widget tree (e.g. added straight to the viewport)
+        if (!Widget->GetParent())
+        {
+            return nullptr;
+        }
+
+        const UWidget* Root = Widget->GetParent();
+        while (Root->GetParent())
+        {
+            Root = Root->GetParent();
+        }
+
+        UUserWidget* OwningWidget = Root->GetTypedOuter<UUserWidget>();
+        if (UPUDishCustomizationWidget* DishWidget = Cast<UPUDishCustomizationWidget>(OwningWidget))
+        {
+            return DishWidget;
+        }
+
+        // Controls inside an ingredient slot belong to that slot, not to the dish widget's list
+        if (!OwningWidget || OwningWidget->IsA<UPUIngredientSlot>())
+        {
+            return nullptr;
+        }
+        Widget = OwningWidget;
+    }
+    return nullptr;
+}
+
+void UPUIngredientQuantityControl::RegisterWithDishWidget()
+{
+    UPUDishCustomizationWidget* DishWidget = RegisteredDishWidget.IsValid() ? RegisteredDishWidget.Get() : FindOwningDishWidget();
+    if (!DishWidget)
+    {
+        return;
+    }
+
+    DishWidget->UnregisterQuantityControl(RegisteredInstanceID, this);
+    DishWidget->RegisterQuantityControl(IngredientInstance.InstanceID, this);
+    RegisteredDishWidget = DishWidget;
+    RegisteredInstanceID = IngredientInstance.InstanceID;
+}
+
+void UPUIngredientQuantityControl::UnregisterFromDishWidget()
+{
+    if (UPUDishCustomizationWidget* DishWidget = RegisteredDishWidget.Get())
+    {
+        DishWidget->UnregisterQuantityControl(RegisteredInstanceID, this);
+    }
+    RegisteredDishWidget.Reset();
+    RegisteredInstanceID = 0;
+}
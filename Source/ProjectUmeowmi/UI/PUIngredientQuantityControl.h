@@ -16,7 +16,7 @@ class UPUPreparationCheckbox;
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnQuantityControlChanged, const FIngredientInstance&, IngredientInstance);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnQuantityControlRemoved, int32, InstanceID, class UPUIngredientQuantityControl*, QuantityControlWidget);
 
-UCLASS(BlueprintType, Blueprintable)
+UCLASS(BlueprintType, Blueprintable, meta = (DisableNativeTick))
 class PROJECTUMEOWMI_API UPUIngredientQuantityControl : public UUserWidget
 {
     GENERATED_BODY()
@@ -192,4 +192,12 @@ private:
     // Preparation management
     void ClearPreparationCheckboxes();
     void CreatePreparationCheckbox(const FPUPreparationBase& PreparationData, bool bIsCurrentlyApplied);
+
+    // Instance registry of the dish widget this control sits in (controls nested inside slots are not registered)
+    class UPUDishCustomizationWidget* FindOwningDishWidget() const;
+    void RegisterWithDishWidget();
+    void UnregisterFromDishWidget();
+
+    TWeakObjectPtr<class UPUDishCustomizationWidget> RegisteredDishWidget;
+    int32 RegisteredInstanceID = 0;
 }; 
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "Animation/WidgetAnimation.h"
 #include "Components/Image.h"
 #include "Components/Button.h"
+#include "Components/InvalidationBox.h"
 #include "Components/PanelWidget.h"
 #include "Components/TextBlock.h"
 #include "Components/Slider.h"
@@ -9,20 +10,23 @@
 #include "Blueprint/WidgetTree.h"
 #include "Engine/Texture2D.h"
 #include "Materials/MaterialInstanceDynamic.h"
-#include "ImageUtils.h"
 #include "PUIngredientQuantityControl.h"
 #include "PUIngredientDragDropOperation.h"
 #include "Input/Events.h"
+#include "Layout/WidgetPath.h"
 #include "../DishCustomization/PUPreparationBase.h"
 #include "../DishCustomization/PUIngredientBase.h"
 #include "Engine/DataTable.h"
 #include "PUDishCustomizationWidget.h"
 #include "../DishCustomization/PUDishCustomizationComponent.h"
-#include "Kismet/GameplayStatics.h"
 #include "Components/SlateWrapperTypes.h"
 #include "GameplayTagContainer.h"
 #include "PURadialMenu.h"
+#include "PUPantryItem.h"
 #include "../DishCustomization/PUDishBlueprintLibrary.h"
+#include "../DishCustomization/PUTextureColorCache.h"
+#include "../DishCustomization/PUStationRegistrySubsystem.h"
+#include "../PUStats.h"
 #include "Framework/Application/SlateApplication.h"
 
 // Debug output toggles (kept in code, but disabled by default to avoid log spam).
@@ -31,6 +35,18 @@ namespace
     constexpr bool bPU_LogIngredientSlotDebug = false;
 }
 
+namespace
+{
+    // Prep, Pantry, ActiveIngredientArea and Prepped slots take focus for controller navigation
+    bool IsFocusableSlotLocation(EPUIngredientSlotLocation SlotLocation)
+    {
+        return SlotLocation == EPUIngredientSlotLocation::Prep ||
+            SlotLocation == EPUIngredientSlotLocation::Pantry ||
+            SlotLocation == EPUIngredientSlotLocation::ActiveIngredientArea ||
+            SlotLocation == EPUIngredientSlotLocation::Prepped;
+    }
+}
+
 UPUIngredientSlot::UPUIngredientSlot(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
     , bHasIngredient(false)
@@ -83,6 +99,12 @@ void UPUIngredientSlot::NativeConstruct()
         }
     }
 
+    // Register with the dish widget now - slots placed in the designer get their instance before they find it
+    if (UPUDishCustomizationWidget* DishWidget = CachedDishWidget.Get())
+    {
+        DishWidget->RegisterIngredientSlot(this);
+    }
+
     // Hide hover text by default
     if (HoverText)
     {
@@ -158,12 +180,12 @@ void UPUIngredientSlot::NativeConstruct()
 
     // If InitialIngredientInstance is set (from Blueprint widget creation), apply it
     // SetIngredientInstance will call UpdateDisplay() internally
-    if (InitialIngredientInstance.IngredientData.IngredientTag.IsValid())
+    if (InitialIngredientInstance.IngredientTag.IsValid())
     {
         if (bPU_LogIngredientSlotDebug)
         {
             //UE_LOG(LogTemp,Display, TEXT("🎯 UPUIngredientSlot::NativeConstruct - Initial ingredient instance found, applying: %s"), 
-            //    *InitialIngredientInstance.IngredientData.DisplayName.ToString());
+            //    *InitialIngredientInstance.GetDefinition().DisplayName.ToString());
         }
         SetIngredientInstance(InitialIngredientInstance);
     }
@@ -177,11 +199,7 @@ void UPUIngredientSlot::NativeConstruct()
     InitializeTimeTempSliders();
 
     // Make slots focusable for controller navigation (especially important for prep stage)
-    // Prep, Pantry, and ActiveIngredientArea slots should be focusable
-    if (Location == EPUIngredientSlotLocation::Prep || 
-        Location == EPUIngredientSlotLocation::Pantry || 
-        Location == EPUIngredientSlotLocation::ActiveIngredientArea ||
-        Location == EPUIngredientSlotLocation::Prepped)
+    if (IsFocusableSlotLocation(Location))
     {
         SetIsFocusable(true);
     }
@@ -189,6 +207,11 @@ void UPUIngredientSlot::NativeConstruct()
 
 void UPUIngredientSlot::NativeDestruct()
 {
+    if (UPUDishCustomizationWidget* DishWidget = CachedDishWidget.Get())
+    {
+        DishWidget->UnregisterIngredientSlot(IngredientInstance.InstanceID, this);
+    }
+
     // Clean up quantity control widget delegate bindings
     if (QuantityControlWidget && IsValid(QuantityControlWidget) && bQuantityControlEventsBound)
     {
@@ -197,7 +220,7 @@ void UPUIngredientSlot::NativeDestruct()
         bQuantityControlEventsBound = false;
     }
 
-    // Clean up quantity control widget
+    // Detach the quantity control widget (kept, so a slot reused from the dish widget's pool doesn't recreate it)
     if (QuantityControlWidget)
     {
         if (QuantityControlContainer && IsValid(QuantityControlContainer))
@@ -208,7 +231,6 @@ void UPUIngredientSlot::NativeDestruct()
         {
             QuantityControlWidget->RemoveFromParent();
         }
-        QuantityControlWidget = nullptr;
     }
 
     // Clean up radial menu widget delegate bindings
@@ -219,18 +241,18 @@ void UPUIngredientSlot::NativeDestruct()
         bRadialMenuEventsBound = false;
     }
 
-    // Clean up radial menu widget
+    // Detach the radial menu widget and its invalidation box (both kept for reuse, like the quantity control)
+    if (RadialMenuIsland && IsValid(RadialMenuIsland))
+    {
+        RadialMenuIsland->RemoveFromParent();
+    }
     if (RadialMenuWidget)
     {
-        if (RadialMenuContainer && IsValid(RadialMenuContainer))
-        {
-            RadialMenuContainer->RemoveChild(RadialMenuWidget);
-        }
         if (IsValid(RadialMenuWidget))
         {
             RadialMenuWidget->RemoveFromParent();
         }
-        RadialMenuWidget = nullptr;
+        bRadialMenuVisible = false;
     }
 
     // Clean up time/temperature slider delegate bindings
@@ -254,12 +276,6 @@ void UPUIngredientSlot::NativeDestruct()
     Super::NativeDestruct();
 }
 
-void UPUIngredientSlot::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
-{
-    Super::NativeTick(MyGeometry, InDeltaTime);
-    UpdateSliderFocusVisuals();
-}
-
 void UPUIngredientSlot::SetIngredientInstance(const FIngredientInstance& InIngredientInstance)
 {
     // //UE_LOG(LogTemp,Display, TEXT("🎯 UPUIngredientSlot::SetIngredientInstance - Setting ingredient instance (Slot: %s)"), *GetName());
@@ -267,43 +283,9 @@ void UPUIngredientSlot::SetIngredientInstance(const FIngredientInstance& InIngre
     //     InIngredientInstance.InstanceID, InIngredientInstance.Quantity, InIngredientInstance.Preparations.Num());
 
     // Store the instance data
+    const int32 PreviousInstanceID = IngredientInstance.InstanceID;
     IngredientInstance = InIngredientInstance;
-    
-    // IMPORTANT: Sync preparations between Preparations and ActivePreparations
-    // ActivePreparations is the source of truth (updated by ApplyPreparation)
-    // If ActivePreparations has more preparations, use that (it's more up-to-date)
-    if (IngredientInstance.IngredientData.ActivePreparations.Num() > IngredientInstance.Preparations.Num())
-    {
-        // ActivePreparations has more (or newer) preparations - sync to Preparations
-        IngredientInstance.Preparations = IngredientInstance.IngredientData.ActivePreparations;
-        if (bPU_LogIngredientSlotDebug)
-        {
-            //UE_LOG(LogTemp,Display, TEXT("🎯 UPUIngredientSlot::SetIngredientInstance - Synced %d ActivePreparations from IngredientData to Preparations"), 
-            //    IngredientInstance.IngredientData.ActivePreparations.Num());
-        }
-    }
-    else if (IngredientInstance.Preparations.Num() > 0 && IngredientInstance.IngredientData.ActivePreparations.Num() == 0)
-    {
-        // Preparations has data but ActivePreparations is empty - sync the other way
-        IngredientInstance.IngredientData.ActivePreparations = IngredientInstance.Preparations;
-        if (bPU_LogIngredientSlotDebug)
-        {
-            //UE_LOG(LogTemp,Display, TEXT("🎯 UPUIngredientSlot::SetIngredientInstance - Synced %d Preparations to ActivePreparations"), 
-            //    IngredientInstance.Preparations.Num());
-        }
-    }
-    else if (IngredientInstance.Preparations.Num() > 0 && IngredientInstance.IngredientData.ActivePreparations.Num() > 0)
-    {
-        // Both have data - merge them (ActivePreparations takes precedence)
-        IngredientInstance.Preparations = IngredientInstance.IngredientData.ActivePreparations;
-        if (bPU_LogIngredientSlotDebug)
-        {
-            //UE_LOG(LogTemp,Display, TEXT("🎯 UPUIngredientSlot::SetIngredientInstance - Merged preparations: ActivePreparations has %d, using that"), 
-            //    IngredientInstance.IngredientData.ActivePreparations.Num());
-        }
-    }
-    // //UE_LOG(LogTemp,Display, TEXT("🎯 UPUIngredientSlot::SetIngredientInstance - Final: Preparations=%d, ActivePreparations=%d"), 
-    //     IngredientInstance.Preparations.Num(), IngredientInstance.IngredientData.ActivePreparations.Num());
+    NotifyInstanceIDChanged(PreviousInstanceID);
     
     // Set plating-specific properties
     MaxQuantity = InIngredientInstance.Quantity;
@@ -322,7 +304,7 @@ void UPUIngredientSlot::SetIngredientInstance(const FIngredientInstance& InIngre
     }
 
     // //UE_LOG(LogTemp,Display, TEXT("🎯 UPUIngredientSlot::SetIngredientInstance - Stored Ingredient: %s (ID: %d, Qty: %d, Preparations: %d, HasIngredient: %s)"),
-    //     *IngredientInstance.IngredientData.DisplayName.ToString(),
+    //     *IngredientInstance.GetDefinition().DisplayName.ToString(),
     //     IngredientInstance.InstanceID,
     //     IngredientInstance.Quantity,
     //     IngredientInstance.Preparations.Num(),
@@ -392,7 +374,9 @@ void UPUIngredientSlot::ClearSlot()
     }
 
     bHasIngredient = false;
+    const int32 PreviousInstanceID = IngredientInstance.InstanceID;
     IngredientInstance = FIngredientInstance(); // Reset to default
+    NotifyInstanceIDChanged(PreviousInstanceID);
     CachedAverageColor = FLinearColor::White; // Reset cached color
     
     // Clean up dynamic materials
@@ -405,6 +389,85 @@ void UPUIngredientSlot::ClearSlot()
     OnSlotEmptied();
 }
 
+void UPUIngredientSlot::ResetForReuse(EPUIngredientSlotLocation InLocation)
+{
+    // Whoever had this slot before is done with it
+    OnIngredientDroppedOnSlot.Clear();
+    OnEmptySlotClicked.Clear();
+    OnSlotIngredientChanged.Clear();
+
+    ResetSlotState(InLocation);
+}
+
+void UPUIngredientSlot::ResetSlotState(EPUIngredientSlotLocation InLocation)
+{
+    HideRadialMenu();
+
+    // Back to an empty slot. Not ClearSlot() - that also removes the matching prepped slot.
+    bHasIngredient = false;
+    const int32 PreviousInstanceID = IngredientInstance.InstanceID;
+    IngredientInstance = FIngredientInstance();
+    NotifyInstanceIDChanged(PreviousInstanceID);
+    CachedAverageColor = FLinearColor::White;
+    RemainingQuantity = 0;
+    MaxQuantity = 0;
+    bIsHovered = false;
+    SetSelected(false);
+    SetDragEnabled(GetDefault<UPUIngredientSlot>(GetClass())->bDragEnabled);
+
+    NavigationUp.Reset();
+    NavigationDown.Reset();
+    NavigationLeft.Reset();
+    NavigationRight.Reset();
+
+    // A pooled slot keeps its Slate widget, so NativeConstruct has already run (possibly for another location)
+    SetLocation(InLocation);
+    SetIsFocusable(IsFocusableSlotLocation(InLocation));
+}
+
+void UPUIngredientSlot::NotifyInstanceIDChanged(int32 PreviousInstanceID)
+{
+    // Only the dish widget that handed out this slot tracks it (no hierarchy search on this path)
+    UPUDishCustomizationWidget* DishWidget = CachedDishWidget.Get();
+    if (DishWidget && PreviousInstanceID != IngredientInstance.InstanceID)
+    {
+        DishWidget->OnSlotInstanceIDChanged(this, PreviousInstanceID);
+    }
+}
+
+void UPUIngredientSlot::NativeOnListItemObjectSet(UObject* ListItemObject)
+{
+    IUserObjectListEntry::NativeOnListItemObjectSet(ListItemObject);
+
+    const UPUPantryItem* PantryItem = Cast<UPUPantryItem>(ListItemObject);
+    UPUDishCustomizationWidget* OwningDishWidget = PantryItem ? PantryItem->DishWidget.Get() : nullptr;
+    const FPUIngredientBase* PantryIngredient = OwningDishWidget ? OwningDishWidget->GetPantryIngredient(PantryItem->PantryIndex) : nullptr;
+    if (!PantryIngredient)
+    {
+        return;
+    }
+
+    // The tile view recycles entries as the pantry scrolls. Keep the click binding the dish widget added when
+    // the entry was generated; navigation links stay empty so the tile view moves focus between entries.
+    ResetSlotState(EPUIngredientSlotLocation::Pantry);
+    SetDishCustomizationWidget(OwningDishWidget);
+    SetDragEnabled(true);
+
+    UPUDishCustomizationComponent* Component = OwningDishWidget->GetCustomizationComponent();
+    if (Component && Component->PreparationDataTable)
+    {
+        SetPreparationDataTable(Component->PreparationDataTable);
+    }
+
+    // Same display-only instance the shelved pantry uses (quantity 0, no instance ID)
+    FIngredientInstance PantryInstance;
+    PantryInstance.SetIngredientData(*PantryIngredient);
+    PantryInstance.Quantity = 0;
+    PantryInstance.InstanceID = 0;
+    SetIngredientInstance(PantryInstance);
+    UpdateDisplay();
+}
+
 void UPUIngredientSlot::SetLocation(EPUIngredientSlotLocation InLocation)
 {
     if (Location != InLocation)
@@ -451,7 +514,7 @@ void UPUIngredientSlot::UpdateDisplay()
     if (Location == EPUIngredientSlotLocation::Pantry || Location == EPUIngredientSlotLocation::Prep || Location == EPUIngredientSlotLocation::Prepped)
     {
         // Pantry/Prep/Prepped slots: only clear if we don't have ingredient data at all
-        bShouldClear = !IngredientInstance.IngredientData.IngredientTag.IsValid();
+        bShouldClear = !IngredientInstance.IngredientTag.IsValid();
     }
 
     if (bShouldClear)
@@ -548,7 +611,7 @@ void UPUIngredientSlot::UpdateIngredientIcon()
     if (Location == EPUIngredientSlotLocation::Pantry || Location == EPUIngredientSlotLocation::Prep || Location == EPUIngredientSlotLocation::Prepped)
     {
         // Pantry/Prep/Prepped slots: show texture if we have ingredient data (even if quantity is 0)
-        bShouldShowTexture = IngredientInstance.IngredientData.IngredientTag.IsValid();
+        bShouldShowTexture = IngredientInstance.IngredientTag.IsValid();
     }
     else // ActiveIngredientArea
     {
@@ -704,7 +767,7 @@ void UPUIngredientSlot::UpdateIngredientIcon()
     {
         IngredientIcon->SetVisibility(ESlateVisibility::Collapsed);
         //UE_LOG(LogTemp,Warning, TEXT("⚠️ UPUIngredientSlot::UpdateIngredientIcon - No texture found for ingredient: %s (Location: %d)"),
-        //    *IngredientInstance.IngredientData.DisplayName.ToString(), (int32)Location);
+        //    *IngredientInstance.GetDefinition().DisplayName.ToString(), (int32)Location);
     }
 }
 
@@ -1009,6 +1072,11 @@ void UPUIngredientSlot::UpdateQuantityControl()
             //UE_LOG(LogTemp,Warning, TEXT("⚠️ UPUIngredientSlot::UpdateQuantityControl - Failed to create quantity control widget"));
         }
     }
+    else if (QuantityControlWidget && !QuantityControlWidget->GetParent())
+    {
+        // Detached by NativeDestruct (slot went back to the pool) - put it back
+        QuantityControlContainer->AddChild(QuantityControlWidget);
+    }
     else if (!QuantityControlWidget && !QuantityControlClass)
     {
         //UE_LOG(LogTemp,Warning, TEXT("⚠️ UPUIngredientSlot::UpdateQuantityControl - No quantity control widget found and QuantityControlClass is not set!"));
@@ -1060,7 +1128,7 @@ void UPUIngredientSlot::UpdateQuantityControl()
         //UE_LOG(LogTemp,Display, TEXT("🎯   Slot Instance - ID: %d, Qty: %d, Ingredient: %s, Preparations: %d, HasIngredient: %s"),
         //    IngredientInstance.InstanceID,
         //    IngredientInstance.Quantity,
-        //    *IngredientInstance.IngredientData.DisplayName.ToString(),
+        //    *IngredientInstance.GetDefinition().DisplayName.ToString(),
         //    IngredientInstance.Preparations.Num(),
         //    bHasIngredient ? TEXT("TRUE") : TEXT("FALSE"));
         
@@ -1181,7 +1249,7 @@ UTexture2D* UPUIngredientSlot::GetTextureForLocation() const
     }
 
     // Check if we have valid ingredient data
-    if (!IngredientInstance.IngredientData.IngredientTag.IsValid())
+    if (!IngredientInstance.IngredientTag.IsValid())
     {
         return nullptr;
     }
@@ -1190,31 +1258,31 @@ UTexture2D* UPUIngredientSlot::GetTextureForLocation() const
     if (Location == EPUIngredientSlotLocation::Pantry)
     {
         // Use PantryTexture if available, otherwise fallback to PreviewTexture
-        UTexture2D* Texture = IngredientInstance.IngredientData.PantryTexture;
+        UTexture2D* Texture = IngredientInstance.GetDefinition().PantryTexture;
         if (!Texture)
         {
-            Texture = IngredientInstance.IngredientData.PreviewTexture;
+            Texture = IngredientInstance.GetDefinition().PreviewTexture;
             if (Texture)
             {
                 //UE_LOG(LogTemp,Display, TEXT("🎯 UPUIngredientSlot::GetTextureForLocation - Pantry slot using PreviewTexture as fallback for ingredient: %s"),
-                //    *IngredientInstance.IngredientData.DisplayName.ToString());
+                //    *IngredientInstance.GetDefinition().DisplayName.ToString());
             }
         }
         if (!Texture)
         {
             //UE_LOG(LogTemp,Warning, TEXT("⚠️ UPUIngredientSlot::GetTextureForLocation - Pantry slot has no PantryTexture or PreviewTexture for ingredient: %s"),
-            //    *IngredientInstance.IngredientData.DisplayName.ToString());
+            //    *IngredientInstance.GetDefinition().DisplayName.ToString());
         }
         return Texture;
     }
     else if (Location == EPUIngredientSlotLocation::Prep)
     {
         // Prep slots use PreviewTexture (or could use a specific prep texture in the future)
-        UTexture2D* Texture = IngredientInstance.IngredientData.PreviewTexture;
+        UTexture2D* Texture = IngredientInstance.GetDefinition().PreviewTexture;
         if (!Texture)
         {
             //UE_LOG(LogTemp,Warning, TEXT("⚠️ UPUIngredientSlot::GetTextureForLocation - Prep slot has no PreviewTexture for ingredient: %s"),
-            //    *IngredientInstance.IngredientData.DisplayName.ToString());
+            //    *IngredientInstance.GetDefinition().DisplayName.ToString());
         }
         return Texture;
     }
@@ -1233,9 +1301,9 @@ UTexture2D* UPUIngredientSlot::GetTextureForLocation() const
             UDataTable* PrepDataTable = nullptr;
             
             // Try to get from the ingredient's data table first
-            if (IngredientInstance.IngredientData.PreparationDataTable.IsValid())
+            if (IngredientInstance.GetDefinition().PreparationDataTable.IsValid())
             {
-                PrepDataTable = IngredientInstance.IngredientData.PreparationDataTable.LoadSynchronous();
+                PrepDataTable = IngredientInstance.GetDefinition().PreparationDataTable.LoadSynchronous();
             }
             
             // Fallback to the slot's preparation data table if available
@@ -1265,31 +1333,31 @@ UTexture2D* UPUIngredientSlot::GetTextureForLocation() const
         // Fallback to PreppedTexture if no preparation texture was found
         if (!Texture)
         {
-            Texture = IngredientInstance.IngredientData.PreppedTexture;
+            Texture = IngredientInstance.GetDefinition().PreppedTexture;
         }
         
         // Fallback to PreviewTexture if still no texture
         if (!Texture)
         {
-            Texture = IngredientInstance.IngredientData.PreviewTexture;
+            Texture = IngredientInstance.GetDefinition().PreviewTexture;
             if (Texture)
             {
                 //UE_LOG(LogTemp,Display, TEXT("🎯 UPUIngredientSlot::GetTextureForLocation - Prepped slot using PreviewTexture as fallback for ingredient: %s"),
-                //    *IngredientInstance.IngredientData.DisplayName.ToString());
+                //    *IngredientInstance.GetDefinition().DisplayName.ToString());
             }
         }
         
         if (!Texture)
         {
             //UE_LOG(LogTemp,Warning, TEXT("⚠️ UPUIngredientSlot::GetTextureForLocation - Prepped slot has no PrepTexture, PreppedTexture, or PreviewTexture for ingredient: %s"),
-            //    *IngredientInstance.IngredientData.DisplayName.ToString());
+            //    *IngredientInstance.GetDefinition().DisplayName.ToString());
         }
         
         return Texture;
     }
     else // Plating
     {
-        return IngredientInstance.IngredientData.PreviewTexture;
+        return IngredientInstance.GetDefinition().PreviewTexture;
     }
 }
 
@@ -1303,165 +1371,81 @@ void UPUIngredientSlot::GetAverageColorFromIngredientTexture()
 
     // Get the ORIGINAL ingredient texture (NOT the swapped prep texture)
     // Use PreppedTexture if available, otherwise fallback to PreviewTexture
-    UTexture2D* Texture = IngredientInstance.IngredientData.PreppedTexture;
+    UTexture2D* Texture = IngredientInstance.GetDefinition().PreppedTexture;
     if (!Texture)
     {
-        Texture = IngredientInstance.IngredientData.PreviewTexture;
+        Texture = IngredientInstance.GetDefinition().PreviewTexture;
     }
     
     if (!Texture)
     {
         //UE_LOG(LogTemp,Warning, TEXT("⚠️ UPUIngredientSlot::GetAverageColorFromIngredientTexture - No original ingredient texture found (PreppedTexture or PreviewTexture) for ingredient: %s"),
-        //    *IngredientInstance.IngredientData.DisplayName.ToString());
-        return;
-    }
-    
-    //UE_LOG(LogTemp,Display, TEXT("🎨 UPUIngredientSlot::GetAverageColorFromIngredientTexture - Using ORIGINAL ingredient texture: %s (not prep texture)"),
-    //    *Texture->GetName());
-
-    // Get texture dimensions
-    const int32 Width = Texture->GetSizeX();
-    const int32 Height = Texture->GetSizeY();
-    
-    if (Width <= 0 || Height <= 0)
-    {
-        //UE_LOG(LogTemp,Warning, TEXT("⚠️ UPUIngredientSlot::GetAverageColorFromIngredientTexture - Invalid texture dimensions: %dx%d"),
-        //    Width, Height);
+        //    *IngredientInstance.GetDefinition().DisplayName.ToString());
         return;
     }
 
-    // Get the source image from the texture using FImageUtils
-    FImage SourceImage;
-    if (!FImageUtils::GetTexture2DSourceImage(Texture, SourceImage))
+    UPUTextureColorCacheSubsystem* ColorCache = UPUTextureColorCacheSubsystem::Get();
+    if (!ColorCache)
     {
-        //UE_LOG(LogTemp,Warning, TEXT("⚠️ UPUIngredientSlot::GetAverageColorFromIngredientTexture - Failed to get source image from texture: %s"),
-        //    *Texture->GetName());
         return;
     }
 
-    // Calculate average color
-    int64 TotalR = 0;
-    int64 TotalG = 0;
-    int64 TotalB = 0;
-    int32 PixelCount = 0;
-
-    // Access the raw data from FImage
-    // FImage stores data in RawData array, format depends on the image format
-    // Typically RGBA or RGB format
-    const TArray64<uint8>& RawData = SourceImage.RawData;
-    const int32 DataSize = RawData.Num();
-    
-    // Assume RGBA format (4 bytes per pixel) - adjust if needed
-    const int32 BytesPerPixel = 4;
-    const int32 ExpectedDataSize = Width * Height * BytesPerPixel;
-    
-    if (DataSize < ExpectedDataSize)
+    // Colors are computed once per texture (baked, or on a worker thread) - if they are not ready yet,
+    // refresh the icon when they arrive, provided the slot still shows the same texture.
+    // The slot is the requester, so refreshing it again before then does not queue another callback.
+    TWeakObjectPtr<UPUIngredientSlot> WeakThis(this);
+    FPUTextureColors TextureColors;
+    const bool bColorsReady = ColorCache->FindOrRequestColors(Texture, TextureColors, [WeakThis, Texture](const FPUTextureColors& ReadyColors)
     {
-        // Try RGB format (3 bytes per pixel)
-        const int32 BytesPerPixelRGB = 3;
-        const int32 ExpectedDataSizeRGB = Width * Height * BytesPerPixelRGB;
-        
-        if (DataSize >= ExpectedDataSizeRGB)
+        UPUIngredientSlot* Slot = WeakThis.Get();
+        if (!Slot || !Slot->bHasIngredient || Slot->IngredientInstance.Preparations.Num() == 0)
         {
-            // RGB format
-            for (int32 Y = 0; Y < Height; Y++)
-            {
-                for (int32 X = 0; X < Width; X++)
-                {
-                    const int32 PixelIndex = (Y * Width + X) * BytesPerPixelRGB;
-                    
-                    if (PixelIndex + 2 < DataSize)
-                    {
-                        // Unreal textures are typically BGRA format, so swap R and B
-                        uint8 B = RawData[PixelIndex];
-                        uint8 G = RawData[PixelIndex + 1];
-                        uint8 R = RawData[PixelIndex + 2];
-
-                        TotalR += R;
-                        TotalG += G;
-                        TotalB += B;
-                        PixelCount++;
-                    }
-                }
-            }
+            return;
         }
-        else
+
+        const FPUIngredientBase& Data = Slot->IngredientInstance.GetDefinition();
+        if ((Data.PreppedTexture ? Data.PreppedTexture : Data.PreviewTexture) != Texture)
         {
-            //UE_LOG(LogTemp,Warning, TEXT("⚠️ UPUIngredientSlot::GetAverageColorFromIngredientTexture - Unexpected data size: %d (expected at least %d or %d)"),
-            //    DataSize, ExpectedDataSize, ExpectedDataSizeRGB);
             return;
         }
+
+        Slot->ApplyIngredientTextureColor(ReadyColors.Average);
+        Slot->UpdateIngredientIcon();
+    }, this);
+
+    if (bColorsReady)
+    {
+        ApplyIngredientTextureColor(TextureColors.Average);
     }
     else
     {
-        // RGBA format
-        for (int32 Y = 0; Y < Height; Y++)
-        {
-            for (int32 X = 0; X < Width; X++)
-            {
-                const int32 PixelIndex = (Y * Width + X) * BytesPerPixel;
-                
-                if (PixelIndex + 2 < DataSize)
-                {
-                    // Unreal textures are typically BGRA format, so swap R and B
-                    uint8 B = RawData[PixelIndex];
-                    uint8 G = RawData[PixelIndex + 1];
-                    uint8 R = RawData[PixelIndex + 2];
-
-                    TotalR += R;
-                    TotalG += G;
-                    TotalB += B;
-                    PixelCount++;
-                }
-            }
-        }
+        //UE_LOG(LogTemp,Display, TEXT("🎨 UPUIngredientSlot::GetAverageColorFromIngredientTexture - Colors for %s not ready yet"), *Texture->GetName());
     }
+}
 
-    if (PixelCount > 0)
-    {
-        uint8 AvgR = static_cast<uint8>(TotalR / PixelCount);
-        uint8 AvgG = static_cast<uint8>(TotalG / PixelCount);
-        uint8 AvgB = static_cast<uint8>(TotalB / PixelCount);
-
-        // Cache the average color (convert from 0-255 range to 0-1 range for FLinearColor)
-        FLinearColor BaseColor = FLinearColor(
-            AvgR / 255.0f,
-            AvgG / 255.0f,
-            AvgB / 255.0f,
-            1.0f
-        );
-
-        // Check if ingredient is suspicious (2+ preparations) - if so, skip saturation boost
-        TArray<FGameplayTag> PrepTags;
-        IngredientInstance.Preparations.GetGameplayTagArray(PrepTags);
-        bool bIsSuspicious = PrepTags.Num() >= 2;
+void UPUIngredientSlot::ApplyIngredientTextureColor(const FLinearColor& BaseColor)
+{
+    // Check if ingredient is suspicious (2+ preparations) - if so, skip saturation boost
+    TArray<FGameplayTag> PrepTags;
+    IngredientInstance.Preparations.GetGameplayTagArray(PrepTags);
+    bool bIsSuspicious = PrepTags.Num() >= 2;
 
-        // Boost saturation to make colors more vibrant (but not for suspicious ingredients)
-        if (bIsSuspicious)
-        {
-            // Use base color without saturation boost for suspicious ingredients
-            CachedAverageColor = BaseColor;
-            //UE_LOG(LogTemp,Display, TEXT("🎨 UPUIngredientSlot::GetAverageColorFromIngredientTexture - Average color: RGB(%d, %d, %d) -> Base(%.3f, %.3f, %.3f) [SUSPICIOUS - No saturation boost] from texture: %s (Size: %dx%d, Pixels: %d)"),
-            //    AvgR, AvgG, AvgB, 
-            //    BaseColor.R, BaseColor.G, BaseColor.B,
-            //    *Texture->GetName(), Width, Height, PixelCount);
-        }
-        else
-        {
-            // Boost saturation for non-suspicious ingredients
-            CachedAverageColor = BoostColorSaturation(BaseColor, ColorSaturationMultiplier);
-            //UE_LOG(LogTemp,Display, TEXT("🎨 UPUIngredientSlot::GetAverageColorFromIngredientTexture - Average color: RGB(%d, %d, %d) -> Base(%.3f, %.3f, %.3f) -> Boosted(%.3f, %.3f, %.3f) from texture: %s (Size: %dx%d, Pixels: %d, Saturation: %.2fx)"),
-            //    AvgR, AvgG, AvgB, 
-            //    BaseColor.R, BaseColor.G, BaseColor.B,
-            //    CachedAverageColor.R, CachedAverageColor.G, CachedAverageColor.B,
-            //    *Texture->GetName(), Width, Height, PixelCount, ColorSaturationMultiplier);
-        }
+    // Boost saturation to make colors more vibrant (but not for suspicious ingredients)
+    if (bIsSuspicious)
+    {
+        // Use base color without saturation boost for suspicious ingredients
+        CachedAverageColor = BaseColor;
+        //UE_LOG(LogTemp,Display, TEXT("🎨 UPUIngredientSlot::ApplyIngredientTextureColor - Base(%.3f, %.3f, %.3f) [SUSPICIOUS - No saturation boost]"),
+        //    BaseColor.R, BaseColor.G, BaseColor.B);
     }
     else
     {
-        //UE_LOG(LogTemp,Warning, TEXT("⚠️ UPUIngredientSlot::GetAverageColorFromIngredientTexture - No pixels processed"));
+        // Boost saturation for non-suspicious ingredients
+        CachedAverageColor = BoostColorSaturation(BaseColor, ColorSaturationMultiplier);
+        //UE_LOG(LogTemp,Display, TEXT("🎨 UPUIngredientSlot::ApplyIngredientTextureColor - Base(%.3f, %.3f, %.3f) -> Boosted(%.3f, %.3f, %.3f) (Saturation: %.2fx)"),
+        //    BaseColor.R, BaseColor.G, BaseColor.B,
+        //    CachedAverageColor.R, CachedAverageColor.G, CachedAverageColor.B, ColorSaturationMultiplier);
     }
-
 }
 
 FLinearColor UPUIngredientSlot::BoostColorSaturation(const FLinearColor& Color, float SaturationMultiplier) const
@@ -1584,22 +1568,23 @@ bool UPUIngredientSlot::NativeOnDrop(const FGeometry& InGeometry, const FDragDro
     if (IngredientDragOp)
     {
         //UE_LOG(LogTemp,Display, TEXT("🎯 UPUIngredientSlot::NativeOnDrop - Drop on slot: %s (Ingredient: %s, Location: %d, Empty: %s)"),
-        //    *GetName(), *IngredientDragOp->IngredientInstance.IngredientData.DisplayName.ToString(), (int32)Location, IsEmpty() ? TEXT("TRUE") : TEXT("FALSE"));
+        //    *GetName(), *IngredientDragOp->IngredientInstance.GetDefinition().DisplayName.ToString(), (int32)Location, IsEmpty() ? TEXT("TRUE") : TEXT("FALSE"));
 
         // In cooking stage (ActiveIngredientArea) or prep stage (Prep), handle both empty slots (move) and occupied slots (swap)
         if (Location == EPUIngredientSlotLocation::ActiveIngredientArea || Location == EPUIngredientSlotLocation::Prep)
         {
-            // SAFETY CHECK: If InstanceID is 0, this is from pantry - generate new GUID and set quantity to 1
+            // If InstanceID is 0, this is from pantry - take the dish's next ID and set quantity to 1
             if (IngredientDragOp->IngredientInstance.InstanceID == 0)
             {
-                //UE_LOG(LogTemp,Display, TEXT("🔍 UPUIngredientSlot::NativeOnDrop - Detected pantry drag (ID: 0), generating new GUID and setting quantity to 1"));
-                IngredientDragOp->IngredientInstance.InstanceID = GenerateGUIDBasedInstanceID();
-                IngredientDragOp->IngredientInstance.Quantity = 1;
-                // Ensure IngredientTag is set (should be from IngredientData, but set it explicitly for consistency)
-                if (!IngredientDragOp->IngredientInstance.IngredientTag.IsValid() && IngredientDragOp->IngredientInstance.IngredientData.IngredientTag.IsValid())
+                //UE_LOG(LogTemp,Display, TEXT("🔍 UPUIngredientSlot::NativeOnDrop - Detected pantry drag (ID: 0), allocating an InstanceID and setting quantity to 1"));
+                const int32 NewInstanceID = GenerateUniqueInstanceID();
+                if (NewInstanceID == 0)
                 {
-                    IngredientDragOp->IngredientInstance.IngredientTag = IngredientDragOp->IngredientInstance.IngredientData.IngredientTag;
+                    // No dish to allocate from - 0 would still read as a pantry drag, so refuse the drop
+                    return false;
                 }
+                IngredientDragOp->IngredientInstance.InstanceID = NewInstanceID;
+                IngredientDragOp->IngredientInstance.Quantity = 1;
                 if (bPU_LogIngredientSlotDebug)
                 {
                     //UE_LOG(LogTemp,Display, TEXT("🔍 UPUIngredientSlot::NativeOnDrop - Generated new InstanceID: %d, Quantity: 1, Tag: %s"), 
@@ -1619,13 +1604,13 @@ bool UPUIngredientSlot::NativeOnDrop(const FGeometry& InGeometry, const FDragDro
                 //UE_LOG(LogTemp,Display, TEXT("🎯   Target slot has ingredient - ID: %d, Qty: %d, Ingredient: %s"),
                 //    TargetSlotIngredient.InstanceID,
                 //    TargetSlotIngredient.Quantity,
-                //    *TargetSlotIngredient.IngredientData.DisplayName.ToString());
+                //    *TargetSlotIngredient.GetDefinition().DisplayName.ToString());
             }
             
             //UE_LOG(LogTemp,Display, TEXT("🎯   Drag Operation IngredientInstance - ID: %d, Qty: %d, Ingredient: %s, Preparations: %d"),
             //    IngredientDragOp->IngredientInstance.InstanceID,
             //    IngredientDragOp->IngredientInstance.Quantity,
-            //    *IngredientDragOp->IngredientInstance.IngredientData.DisplayName.ToString(),
+            //    *IngredientDragOp->IngredientInstance.GetDefinition().DisplayName.ToString(),
             //    IngredientDragOp->IngredientInstance.Preparations.Num());
 
             // Set the target slot with the dragged ingredient
@@ -1809,7 +1794,7 @@ FReply UPUIngredientSlot::NativeOnMouseButtonDown(const FGeometry& InGeometry, c
     if (Location == EPUIngredientSlotLocation::Pantry && InMouseEvent.GetEffectingButton() == EKeys::LeftMouseButton)
     {
         // Pantry slots: if we have valid ingredient data, treat click as selection (not drag)
-        if (IngredientInstance.IngredientData.IngredientTag.IsValid())
+        if (IngredientInstance.IngredientTag.IsValid())
         {
             //UE_LOG(LogTemp,Display, TEXT("🎯 UPUIngredientSlot::NativeOnMouseButtonDown - Pantry slot clicked, triggering OnEmptySlotClicked for selection"));
             // Use OnEmptySlotClicked event for pantry slot selection (bound to OnPantrySlotClicked in cooking stage)
@@ -1955,16 +1940,13 @@ void UPUIngredientSlot::ShowRadialMenu(bool bIsPrepMenu, bool bIncludeActions)
     // Get the slot's screen position
     FVector2D SlotScreenPosition = GetSlotScreenPosition();
     
-    // Set preparation data table on radial menu widget if we have one (for prep menu or combined menu)
-    // This allows the radial menu to have its own data table reference that can be set in Blueprint
-    // If the radial menu doesn't have one set, use the slot's preparation data table
+    // Set the preparation data table on every show (for prep menu or combined menu). The menu is kept with the
+    // slot, and a pooled slot may have been reused for another table since, so it must not keep the old one.
+    // A table set on the radial menu Blueprint's defaults wins; otherwise use the slot's table.
     if ((bIsPrepMenu || bIncludeActions) && RadialMenuWidget)
     {
-        // Only set if radial menu doesn't already have one (allows Blueprint override)
-        if (!RadialMenuWidget->GetPreparationDataTable() && PreparationDataTable)
-        {
-            RadialMenuWidget->SetPreparationDataTable(PreparationDataTable);
-        }
+        UDataTable* MenuDefaultTable = GetDefault<UPURadialMenu>(RadialMenuWidget->GetClass())->GetPreparationDataTable();
+        RadialMenuWidget->SetPreparationDataTable(MenuDefaultTable ? MenuDefaultTable : PreparationDataTable);
     }
     
     // Build menu items - combine prep and actions if requested
@@ -1996,10 +1978,20 @@ void UPUIngredientSlot::ShowRadialMenu(bool bIsPrepMenu, bool bIncludeActions)
     // Add to container if available, otherwise add to viewport (do this BEFORE setting menu items)
     if (RadialMenuContainer && IsValid(RadialMenuContainer) && RadialMenuWidget && IsValid(RadialMenuWidget))
     {
-        // Add to container first (if not already added)
+        // Add to container first (if not already added), inside its own invalidation box: the menu repaints on
+        // every stick move, and the box keeps that from invalidating the slot and the rest of the screen
         if (!RadialMenuWidget->GetParent())
         {
-            RadialMenuContainer->AddChild(RadialMenuWidget);
+            if (!RadialMenuIsland)
+            {
+                RadialMenuIsland = WidgetTree->ConstructWidget<UInvalidationBox>(UInvalidationBox::StaticClass());
+            }
+            RadialMenuIsland->SetContent(RadialMenuWidget);
+            if (RadialMenuIsland->GetParent() != RadialMenuContainer)
+            {
+                RadialMenuIsland->RemoveFromParent();
+                RadialMenuContainer->AddChild(RadialMenuIsland);
+            }
             //UE_LOG(LogTemp,Display, TEXT("🎯 UPUIngredientSlot::ShowRadialMenu - Added menu to container: %s"), *RadialMenuContainer->GetName());
         }
         
@@ -2223,6 +2215,15 @@ void UPUIngredientSlot::NativeOnRemovedFromFocusPath(const FFocusEvent& InFocusE
     UpdateIngredientSelectVisibility(bIsHovered);
 }
 
+void UPUIngredientSlot::NativeOnFocusChanging(const FWeakWidgetPath& PreviousFocusPath, const FWidgetPath& NewWidgetPath, const FFocusEvent& InFocusEvent)
+{
+    Super::NativeOnFocusChanging(PreviousFocusPath, NewWidgetPath, InFocusEvent);
+
+    // Called whenever focus moves into, out of or within this slot (e.g. between its sliders),
+    // so the slider styles follow focus without the slot having to tick
+    UpdateSliderFocusVisuals(NewWidgetPath.IsValid() ? &NewWidgetPath.GetLastWidget().Get() : nullptr);
+}
+
 FText UPUIngredientSlot::GetIngredientDisplayText() const
 {
     // For prep/pantry/prepped slots, show text even if "empty" (quantity 0) as long as we have ingredient data
@@ -2231,7 +2232,7 @@ FText UPUIngredientSlot::GetIngredientDisplayText() const
     if (Location == EPUIngredientSlotLocation::Pantry || Location == EPUIngredientSlotLocation::Prep || Location == EPUIngredientSlotLocation::Prepped)
     {
         // Prep/Pantry/Prepped slots: show text if we have ingredient data (even if quantity is 0)
-        bShouldShowText = IngredientInstance.IngredientData.IngredientTag.IsValid();
+        bShouldShowText = IngredientInstance.IngredientTag.IsValid();
     }
     else
     {
@@ -2249,7 +2250,7 @@ FText UPUIngredientSlot::GetIngredientDisplayText() const
     if (Location == EPUIngredientSlotLocation::Prep)
     {
         // Just return the base ingredient name without preparations
-        FText Result = IngredientInstance.IngredientData.DisplayName;
+        FText Result = IngredientInstance.GetDefinition().DisplayName;
         //UE_LOG(LogTemp,Display, TEXT("🎯   Prep area - returning base name: %s"), *Result.ToString());
         //UE_LOG(LogTemp,Display, TEXT("🎯 UPUIngredientSlot::GetIngredientDisplayText - END"));
         return Result;
@@ -2257,7 +2258,7 @@ FText UPUIngredientSlot::GetIngredientDisplayText() const
 
     // Debug: Log what preparations we have
     //UE_LOG(LogTemp,Display, TEXT("🎯 UPUIngredientSlot::GetIngredientDisplayText - START"));
-    //UE_LOG(LogTemp,Display, TEXT("🎯   Ingredient: %s"), *IngredientInstance.IngredientData.DisplayName.ToString());
+    //UE_LOG(LogTemp,Display, TEXT("🎯   Ingredient: %s"), *IngredientInstance.GetDefinition().DisplayName.ToString());
     //UE_LOG(LogTemp,Display, TEXT("🎯   Preparations count: %d"), IngredientInstance.Preparations.Num());
     
     TArray<FGameplayTag> PrepTags;
@@ -2270,7 +2271,7 @@ FText UPUIngredientSlot::GetIngredientDisplayText() const
     //UE_LOG(LogTemp,Display, TEXT("🎯   PreparationDataTable set: %s"), PreparationDataTable ? TEXT("YES") : TEXT("NO"));
 
     // Get preparation data table from slot property
-    FPUIngredientBase IngredientDataCopy = IngredientInstance.IngredientData;
+    FPUIngredientBase IngredientDataCopy = IngredientInstance.GetDefinition();
     
     // If we have a preparation data table set on the slot, use it
     if (PreparationDataTable)
@@ -2314,7 +2315,7 @@ void UPUIngredientSlot::UpdateHoverTextVisibility(bool bShow)
     bool bCanShowText = false;
     if (Location == EPUIngredientSlotLocation::Pantry || Location == EPUIngredientSlotLocation::Prep || Location == EPUIngredientSlotLocation::Prepped)
     {
-        bCanShowText = IngredientInstance.IngredientData.IngredientTag.IsValid();
+        bCanShowText = IngredientInstance.IngredientTag.IsValid();
     }
     else
     {
@@ -2431,27 +2432,23 @@ TArray<FPUIngredientBase> UPUIngredientSlot::GetIngredientData() const
     return TArray<FPUIngredientBase>();
 }
 
-int32 UPUIngredientSlot::GenerateGUIDBasedInstanceID()
+int32 UPUIngredientSlot::GenerateGUIDBasedInstanceID(const UObject* WorldContextObject)
 {
-    // Generate a GUID and convert it to a unique integer
-    FGuid NewGUID = FGuid::NewGuid();
-    
-    // Convert GUID to a unique integer using hash
-    int32 UniqueID = GetTypeHash(NewGUID);
-    
-    // Ensure it's positive (hash can be negative)
-    UniqueID = FMath::Abs(UniqueID);
-    
-    //UE_LOG(LogTemp,Display, TEXT("🔍 UPUIngredientSlot::GenerateGUIDBasedInstanceID - Generated GUID-based InstanceID: %d from GUID: %s"), 
-    //    UniqueID, *NewGUID.ToString());
-    
-    return UniqueID;
+    if (const UPUIngredientSlot* Slot = Cast<UPUIngredientSlot>(WorldContextObject))
+    {
+        return Slot->GenerateUniqueInstanceID();
+    }
+    return UPUDishCustomizationWidget::GenerateGUIDBasedInstanceID(WorldContextObject);
 }
 
 int32 UPUIngredientSlot::GenerateUniqueInstanceID() const
 {
-    // Call the static GUID-based function
-    int32 UniqueID = GenerateGUIDBasedInstanceID();
+    UPUDishCustomizationWidget* DishWidget = GetDishCustomizationWidget();
+    if (!ensureMsgf(DishWidget, TEXT("UPUIngredientSlot::GenerateUniqueInstanceID - Slot %s has no dish widget to allocate an instance ID from"), *GetName()))
+    {
+        return 0;
+    }
+    const int32 UniqueID = DishWidget->AllocateInstanceID();
     
     //UE_LOG(LogTemp,Display, TEXT("🎯 UPUIngredientSlot::GenerateUniqueInstanceID - Generated unique ID %d for ingredient slot"), UniqueID);
     
@@ -2540,7 +2537,7 @@ FReply UPUIngredientSlot::NativeOnPreviewMouseButtonDown(const FGeometry& InGeom
     if (InMouseEvent.GetEffectingButton() == EKeys::LeftMouseButton && bCanDrag && !bIsPantrySlot && !bShiftPressed)
     {
         //UE_LOG(LogTemp,Display, TEXT("🎯 UPUIngredientSlot::NativeOnPreviewMouseButtonDown - Starting drag detection for ingredient: %s (Location: %d)"), 
-        //    *IngredientInstance.IngredientData.DisplayName.ToString(), (int32)Location);
+        //    *IngredientInstance.GetDefinition().DisplayName.ToString(), (int32)Location);
         
         // Hide quantity control widget when dragging in plating stage
         if (Location == EPUIngredientSlotLocation::Plating && QuantityControlWidget)
@@ -2584,7 +2581,7 @@ FReply UPUIngredientSlot::NativeOnPreviewMouseButtonDown(const FGeometry& InGeom
 UPUIngredientDragDropOperation* UPUIngredientSlot::CreateIngredientDragDropOperation() const
 {
     //UE_LOG(LogTemp,Display, TEXT("🍽️ UPUIngredientSlot::CreateIngredientDragDropOperation - Creating drag operation for ingredient %s (ID: %d, Qty: %d, Location: %d)"), 
-    //    *IngredientInstance.IngredientData.DisplayName.ToString(), IngredientInstance.InstanceID, IngredientInstance.Quantity, (int32)Location);
+    //    *IngredientInstance.GetDefinition().DisplayName.ToString(), IngredientInstance.InstanceID, IngredientInstance.Quantity, (int32)Location);
 
     // Create the drag drop operation
     UPUIngredientDragDropOperation* DragOperation = NewObject<UPUIngredientDragDropOperation>(GetWorld(), UPUIngredientDragDropOperation::StaticClass());
@@ -2621,7 +2618,7 @@ UPUIngredientDragDropOperation* UPUIngredientSlot::CreateIngredientDragDropOpera
 UPUIngredientSlot* UPUIngredientSlot::CreateDragVisualWidget() const
 {
     //UE_LOG(LogTemp,Display, TEXT("🎯 UPUIngredientSlot::CreateDragVisualWidget - Creating drag visual widget for ingredient: %s"), 
-    //    *IngredientInstance.IngredientData.DisplayName.ToString());
+    //    *IngredientInstance.GetDefinition().DisplayName.ToString());
 
     if (!GetWorld())
     {
@@ -2664,13 +2661,13 @@ UPUIngredientSlot* UPUIngredientSlot::CreateDragVisualWidget() const
         DragVisualWidget->SetDragEnabled(false);
         
         // Force update the icon explicitly to ensure it's visible
-        if (DragVisualWidget->IngredientIcon && IngredientInstance.IngredientData.PreviewTexture)
+        if (DragVisualWidget->IngredientIcon && IngredientInstance.GetDefinition().PreviewTexture)
         {
-            DragVisualWidget->IngredientIcon->SetBrushFromTexture(IngredientInstance.IngredientData.PreviewTexture);
+            DragVisualWidget->IngredientIcon->SetBrushFromTexture(IngredientInstance.GetDefinition().PreviewTexture);
             DragVisualWidget->IngredientIcon->SetVisibility(ESlateVisibility::Visible);
             DragVisualWidget->IngredientIcon->SetColorAndOpacity(FLinearColor::White);
                 //UE_LOG(LogTemp,Display, TEXT("🎯 UPUIngredientSlot::CreateDragVisualWidget - Explicitly set ingredient icon texture: %s"), 
-                //    *IngredientInstance.IngredientData.PreviewTexture->GetName());
+                //    *IngredientInstance.GetDefinition().PreviewTexture->GetName());
         }
         else
         {
@@ -2679,10 +2676,10 @@ UPUIngredientSlot* UPUIngredientSlot::CreateDragVisualWidget() const
             {
                 //UE_LOG(LogTemp,Warning, TEXT("⚠️   IngredientIcon component not found in drag visual widget"));
             }
-            if (!IngredientInstance.IngredientData.PreviewTexture)
+            if (!IngredientInstance.GetDefinition().PreviewTexture)
             {
                 //UE_LOG(LogTemp,Warning, TEXT("⚠️   PreviewTexture is null for ingredient: %s"), 
-                //    *IngredientInstance.IngredientData.DisplayName.ToString());
+                //    *IngredientInstance.GetDefinition().DisplayName.ToString());
             }
         }
         
@@ -2792,7 +2789,7 @@ void UPUIngredientSlot::UpdatePlatingDisplay()
     // Update the ingredient icon/texture
     if (IngredientIcon)
     {
-        IngredientIcon->SetBrushFromTexture(IngredientInstance.IngredientData.PreviewTexture);
+        IngredientIcon->SetBrushFromTexture(IngredientInstance.GetDefinition().PreviewTexture);
         //UE_LOG(LogTemp,Display, TEXT("🍽️ UPUIngredientSlot::UpdatePlatingDisplay - Updated icon texture"));
     }
     
@@ -2937,7 +2934,7 @@ FString UPUIngredientSlot::GetPreparationIconText() const
 void UPUIngredientSlot::SpawnIngredientAtPosition(const FVector2D& ScreenPosition)
 {
     //UE_LOG(LogTemp,Display, TEXT("🍽️ [SPAWN] UPUIngredientSlot::SpawnIngredientAtPosition - START - Ingredient %s at screen position (%.2f,%.2f)"), 
-    //    *IngredientInstance.IngredientData.DisplayName.ToString(), ScreenPosition.X, ScreenPosition.Y);
+    //    *IngredientInstance.GetDefinition().DisplayName.ToString(), ScreenPosition.X, ScreenPosition.Y);
 
     // Convert screen position to world position using raycast
     APlayerController* PlayerController = GetOwningPlayer();
@@ -3032,18 +3029,8 @@ void UPUIngredientSlot::SpawnIngredientAtPosition(const FVector2D& ScreenPositio
     //    ViewportSizeX, ViewportSizeY, MousePosition.X, MousePosition.Y);
     
     // Find the dish customization station in the world
-    TArray<AActor*> FoundActors;
-    UGameplayStatics::GetAllActorsOfClass(GetWorld(), AActor::StaticClass(), FoundActors);
-    
-    AActor* DishStation = nullptr;
-    for (AActor* Actor : FoundActors)
-    {
-        if (Actor && (Actor->GetName().Contains(TEXT("CookingStation")) || Actor->GetName().Contains(TEXT("DishCustomization"))))
-        {
-            DishStation = Actor;
-            break;
-        }
-    }
+    UPUStationRegistrySubsystem* StationRegistry = UPUStationRegistrySubsystem::Get(this);
+    AActor* DishStation = StationRegistry ? StationRegistry->FindDishStation() : nullptr;
     
     // Declare spawn position at function level
     FVector SpawnPosition;
@@ -3434,9 +3421,9 @@ TArray<FRadialMenuItem> UPUIngredientSlot::BuildPreparationMenuItems() const
         // We need to pass the ingredient's base tags, not the preparations
         // Combine ingredient base tag with current preparations for compatibility check
         FGameplayTagContainer IngredientTags;
-        if (IngredientInstance.IngredientData.IngredientTag.IsValid())
+        if (IngredientInstance.IngredientTag.IsValid())
         {
-            IngredientTags.AddTag(IngredientInstance.IngredientData.IngredientTag);
+            IngredientTags.AddTag(IngredientInstance.IngredientTag);
         }
         // Also include current preparations in the check (some preparations might be incompatible with other preparations)
         IngredientTags.AppendTags(IngredientInstance.Preparations);
@@ -3534,13 +3521,13 @@ bool UPUIngredientSlot::ApplyPreparationToIngredient(const FGameplayTag& Prepara
         
         if (bSuccess)
         {
-            // Update the dish customization widget's dish data
-            DishWidget->UpdateDishData(CurrentDish);
-            
             // Update the ingredient instance to reflect the change
             FIngredientInstance UpdatedInstance;
             if (CurrentDish.GetIngredientInstanceByID(IngredientInstance.InstanceID, UpdatedInstance))
             {
+                // Send only the changed instance to the dish customization widget
+                DishWidget->UpdateIngredientInstance(UpdatedInstance);
+                
                 SetIngredientInstance(UpdatedInstance);
                 //UE_LOG(LogTemp,Display, TEXT("✅ UPUIngredientSlot::ApplyPreparationToIngredient - Preparation applied successfully"));
                 
@@ -3655,13 +3642,13 @@ bool UPUIngredientSlot::RemovePreparationFromIngredient(const FGameplayTag& Prep
         
         if (bSuccess)
         {
-            // Update the dish customization widget's dish data
-            DishWidget->UpdateDishData(CurrentDish);
-            
             // Update the ingredient instance to reflect the change
             FIngredientInstance UpdatedInstance;
             if (CurrentDish.GetIngredientInstanceByID(IngredientInstance.InstanceID, UpdatedInstance))
             {
+                // Send only the changed instance to the dish customization widget
+                DishWidget->UpdateIngredientInstance(UpdatedInstance);
+                
                 SetIngredientInstance(UpdatedInstance);
                 //UE_LOG(LogTemp,Display, TEXT("✅ UPUIngredientSlot::RemovePreparationFromIngredient - Preparation removed successfully"));
                 
@@ -3971,14 +3958,14 @@ void UPUIngredientSlot::InitializeTimeTempSliders()
     UpdateTemperatureLabelText();
 }
 
-void UPUIngredientSlot::UpdateSliderFocusVisuals()
+void UPUIngredientSlot::UpdateSliderFocusVisuals(const SWidget* FocusedWidget)
 {
     if (!ShouldShowSliders()) return;
 
     // Time slider: show hover style when focused
     if (TimeSlider && TimeSlider->IsVisible())
     {
-        bool bHasFocus = TimeSlider->HasKeyboardFocus();
+        bool bHasFocus = FocusedWidget && TimeSlider->GetCachedWidget().Get() == FocusedWidget;
         if (bHasFocus && !bTimeSliderShowingHoverStyle)
         {
             FSliderStyle HoverStyle = CachedTimeSliderStyle;
@@ -4004,7 +3991,7 @@ void UPUIngredientSlot::UpdateSliderFocusVisuals()
     // Temperature slider: show hover style when focused
     if (TemperatureSlider && TemperatureSlider->IsVisible())
     {
-        bool bHasFocus = TemperatureSlider->HasKeyboardFocus();
+        bool bHasFocus = FocusedWidget && TemperatureSlider->GetCachedWidget().Get() == FocusedWidget;
         if (bHasFocus && !bTemperatureSliderShowingHoverStyle)
         {
             FSliderStyle HoverStyle = CachedTemperatureSliderStyle;
@@ -4030,110 +4017,43 @@ void UPUIngredientSlot::UpdateSliderFocusVisuals()
 
 void UPUIngredientSlot::RecalculateAspectsFromBase()
 {
+    PU_SCOPE_TIMING(RecalculateAspectsFromBase);
+    
     if (!bHasIngredient)
     {
         return;
     }
     
-    // Get the base ingredient from dish data (includes base aspects + preparations, but NOT time/temp/quantity)
-    if (UPUDishCustomizationWidget* DishWidget = GetDishCustomizationWidget())
+    UPUDishCustomizationWidget* DishWidget = GetDishCustomizationWidget();
+    UPUDishCustomizationComponent* Component = DishWidget ? DishWidget->GetCustomizationComponent() : nullptr;
+    if (!Component)
     {
-        FPUDishBase CurrentDish = DishWidget->GetCurrentDishData();
-        FPUIngredientBase BaseIngredient;
-        
-        // Use IngredientData.IngredientTag if IngredientTag is not valid
-        FGameplayTag IngredientTagToUse = IngredientInstance.IngredientTag.IsValid() 
-            ? IngredientInstance.IngredientTag 
-            : IngredientInstance.IngredientData.IngredientTag;
-        
-        if (!IngredientTagToUse.IsValid())
-        {
-            //UE_LOG(LogTemp,Warning, TEXT("⚠️ UPUIngredientSlot::RecalculateAspectsFromBase - No valid ingredient tag found!"));
-            return;
-        }
-        
-        // Ensure dish has ingredient data table (fallback to component's data table if needed)
-        if (!CurrentDish.IngredientDataTable.IsValid())
-        {
-            if (UPUDishCustomizationComponent* Component = DishWidget->GetCustomizationComponent())
-            {
-                if (Component->IngredientDataTable)
-                {
-                    CurrentDish.IngredientDataTable = TSoftObjectPtr<UDataTable>(Component->IngredientDataTable);
-                    //UE_LOG(LogTemp,Display, TEXT("🔍 UPUIngredientSlot::RecalculateAspectsFromBase - Using component's ingredient data table"));
-                }
-            }
-        }
-        
-        // Sync preparations to ActivePreparations before getting base ingredient
-        // (GetIngredient uses ActivePreparations to apply preparation modifiers)
-        BaseIngredient.ActivePreparations = IngredientInstance.Preparations;
+        //UE_LOG(LogTemp,Warning, TEXT("⚠️ UPUIngredientSlot::RecalculateAspectsFromBase - Could not find dish widget or customization component!"));
+        return;
+    }
+    
+    // Fast path: the component recomputes the instance in place from its cached base (base aspects + preparations)
+    // and broadcasts a delta, which updates the dish widget and the radar chart
+    if (Component->SetInstanceTimeTemperature(IngredientInstance.InstanceID, IngredientInstance.TimeValue, IngredientInstance.TemperatureValue))
+    {
+        const FPUDishBase& Dish = Component->GetCurrentDishData();
+        const FIngredientInstance& Recomputed = Dish.IngredientInstances[Dish.FindInstanceIndexByID(IngredientInstance.InstanceID)];
         
-        // Get base ingredient from dish data table (includes preparations)
-        // GetIngredient will apply preparations based on BaseIngredient.ActivePreparations
-        if (CurrentDish.GetIngredient(IngredientTagToUse, BaseIngredient))
-        {
-            // Start with base aspects (base + preparations)
-            FFlavorAspects PerUnitFlavor = BaseIngredient.FlavorAspects;
-            FTextureAspects PerUnitTexture = BaseIngredient.TextureAspects;
-            
-            //UE_LOG(LogTemp,Display, TEXT("🎯 UPUIngredientSlot::RecalculateAspectsFromBase - Base aspects: Umami=%.2f, Sweet=%.2f, Time=%.2f, Temp=%.2f, Qty=%d"),
-            //    PerUnitFlavor.Umami, PerUnitFlavor.Sweet, IngredientInstance.TimeValue, IngredientInstance.TemperatureValue, IngredientInstance.Quantity);
-            
-            // Apply time/temp modifiers to get per-unit modified aspects
-            BaseIngredient.CalculateTimeTempModifiedAspects(
-                IngredientInstance.TimeValue,
-                IngredientInstance.TemperatureValue,
-                PerUnitFlavor,
-                PerUnitTexture
-            );
-            
-            //UE_LOG(LogTemp,Display, TEXT("🎯 UPUIngredientSlot::RecalculateAspectsFromBase - After time/temp: Umami=%.2f, Sweet=%.2f"),
-            //    PerUnitFlavor.Umami, PerUnitFlavor.Sweet);
-            
-            // Store per-unit aspects (quantity multiplication happens in GetTotalFlavorAspect when summing)
-            // This keeps IngredientData consistent - it always represents a single unit
-            IngredientInstance.IngredientData.FlavorAspects.Umami = PerUnitFlavor.Umami;
-            IngredientInstance.IngredientData.FlavorAspects.Salt = PerUnitFlavor.Salt;
-            IngredientInstance.IngredientData.FlavorAspects.Sweet = PerUnitFlavor.Sweet;
-            IngredientInstance.IngredientData.FlavorAspects.Sour = PerUnitFlavor.Sour;
-            IngredientInstance.IngredientData.FlavorAspects.Bitter = PerUnitFlavor.Bitter;
-            IngredientInstance.IngredientData.FlavorAspects.Spicy = PerUnitFlavor.Spicy;
-            
-            IngredientInstance.IngredientData.TextureAspects.Rich = PerUnitTexture.Rich;
-            IngredientInstance.IngredientData.TextureAspects.Juicy = PerUnitTexture.Juicy;
-            IngredientInstance.IngredientData.TextureAspects.Tender = PerUnitTexture.Tender;
-            IngredientInstance.IngredientData.TextureAspects.Chewy = PerUnitTexture.Chewy;
-            IngredientInstance.IngredientData.TextureAspects.Crispy = PerUnitTexture.Crispy;
-            IngredientInstance.IngredientData.TextureAspects.Crumbly = PerUnitTexture.Crumbly;
-            
-            //UE_LOG(LogTemp,Display, TEXT("🎯 UPUIngredientSlot::RecalculateAspectsFromBase - Final per-unit aspects: Umami=%.2f, Sweet=%.2f (Qty=%d, Total Umami=%.2f)"),
-            //    IngredientInstance.IngredientData.FlavorAspects.Umami, IngredientInstance.IngredientData.FlavorAspects.Sweet, 
-            //    IngredientInstance.Quantity, IngredientInstance.IngredientData.FlavorAspects.Umami * IngredientInstance.Quantity);
-            
-            // Update dish data (triggers OnDishDataChanged and updates radar chart automatically)
-            for (int32 i = 0; i < CurrentDish.IngredientInstances.Num(); i++)
-            {
-                if (CurrentDish.IngredientInstances[i].InstanceID == IngredientInstance.InstanceID)
-                {
-                    CurrentDish.IngredientInstances[i] = IngredientInstance;
-                    //UE_LOG(LogTemp,Display, TEXT("🎯 UPUIngredientSlot::RecalculateAspectsFromBase - Updated ingredient instance %d in dish data"), IngredientInstance.InstanceID);
-                    break;
-                }
-            }
-            
-            DishWidget->UpdateDishData(CurrentDish);
-            //UE_LOG(LogTemp,Display, TEXT("🎯 UPUIngredientSlot::RecalculateAspectsFromBase - Called UpdateDishData"));
-        }
-        else
-        {
-            //UE_LOG(LogTemp,Warning, TEXT("⚠️ UPUIngredientSlot::RecalculateAspectsFromBase - Failed to get ingredient from dish data table! Tag: %s"),
-            //    *IngredientTagToUse.ToString());
-        }
+        // Store per-unit aspects (quantity multiplication happens in GetTotalFlavorAspect when summing)
+        IngredientInstance.FlavorAspects = Recomputed.FlavorAspects;
+        IngredientInstance.TextureAspects = Recomputed.TextureAspects;
+        return;
+    }
+    
+    // Instance isn't in the dish yet - compute its aspects and add it through the dish widget
+    if (Component->CalculateInstanceAspects(IngredientInstance, IngredientInstance.FlavorAspects, IngredientInstance.TextureAspects))
+    {
+        DishWidget->UpdateIngredientInstance(IngredientInstance);
     }
     else
     {
-        //UE_LOG(LogTemp,Warning, TEXT("⚠️ UPUIngredientSlot::RecalculateAspectsFromBase - Could not find dish widget!"));
+        //UE_LOG(LogTemp,Warning, TEXT("⚠️ UPUIngredientSlot::RecalculateAspectsFromBase - Failed to get ingredient from dish data table! Tag: %s"),
+        //    *IngredientInstance.IngredientTag.ToString());
     }
 }
 
@@ -4447,6 +4367,17 @@ FReply UPUIngredientSlot::NativeOnKeyDown(const FGeometry& InGeometry, const FKe
     return Super::NativeOnKeyDown(InGeometry, InKeyEvent);
 }
 
+FReply UPUIngredientSlot::NativeOnAnalogValueChanged(const FGeometry& InGeometry, const FAnalogInputEvent& InAnalogEvent)
+{
+    // Focus stays on this slot until the radial menu moves it to its first item, so pass stick input along meanwhile
+    if (bRadialMenuVisible && RadialMenuWidget && RadialMenuWidget->HandleStickInput(InAnalogEvent))
+    {
+        return FReply::Handled();
+    }
+    
+    return Super::NativeOnAnalogValueChanged(InGeometry, InAnalogEvent);
+}
+
 void UPUIngredientSlot::HandleControllerSelect()
 {
     UE_LOG(LogTemp, Log, TEXT("🎮 UPUIngredientSlot::HandleControllerSelect - Called (Slot: %s, Location: %d, Empty: %s)"), 
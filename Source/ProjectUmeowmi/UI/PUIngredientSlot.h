@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
+#include "Blueprint/IUserObjectListEntry.h"
 #include "Styling/SlateTypes.h"
 #include "../DishCustomization/PUDishBase.h"
 #include "PUIngredientQuantityControl.h"
@@ -33,8 +34,8 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnIngredientDroppedOnSlot, class UP
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnEmptySlotClicked, class UPUIngredientSlot*, Slot);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSlotIngredientChanged, const FIngredientInstance&, IngredientInstance);
 
-UCLASS(BlueprintType, Blueprintable)
-class PROJECTUMEOWMI_API UPUIngredientSlot : public UUserWidget
+UCLASS(BlueprintType, Blueprintable, meta = (DisableNativeTick))
+class PROJECTUMEOWMI_API UPUIngredientSlot : public UUserWidget, public IUserObjectListEntry
 {
     GENERATED_BODY()
 
@@ -43,7 +44,6 @@ public:
 
     virtual void NativeConstruct() override;
     virtual void NativeDestruct() override;
-    virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
 
     // Set the ingredient instance for this slot (use ClearSlot() to empty)
     UFUNCTION(BlueprintCallable, Category = "Ingredient Slot")
@@ -85,14 +85,16 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Ingredient Slot|Data")
     TArray<FPUIngredientBase> GetIngredientData() const;
 
-    // GUID-based unique ID generation for ingredient instances
-    UFUNCTION(BlueprintCallable, Category = "Ingredient Slot|Data")
-    static int32 GenerateGUIDBasedInstanceID();
-
-    // Generate a unique instance ID for this ingredient slot
+    // Reserve a new instance ID from the owning dish widget's dish.
+    // Returns 0 (the pantry "no ID yet" value) only if the slot has no dish widget, which is a setup error.
     UFUNCTION(BlueprintCallable, Category = "Ingredient Slot|Data")
     int32 GenerateUniqueInstanceID() const;
 
+    // @deprecated Static like the old GUID hash. Forwards to GenerateUniqueInstanceID when WorldContextObject is a slot,
+    // otherwise to the dish widget it belongs to (see UPUDishCustomizationWidget::GenerateGUIDBasedInstanceID).
+    UFUNCTION(BlueprintCallable, Category = "Ingredient Slot|Data", meta = (WorldContext = "WorldContextObject", DeprecatedFunction, DeprecationMessage = "Use GenerateUniqueInstanceID instead."))
+    static int32 GenerateGUIDBasedInstanceID(const UObject* WorldContextObject);
+
     // Update all display elements
     UFUNCTION(BlueprintCallable, Category = "Ingredient Slot|Display")
     void UpdateDisplay();
@@ -203,6 +205,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Ingredient Slot")
     void SetDishCustomizationWidget(class UPUDishCustomizationWidget* InDishWidget);
 
+    // Return to an empty slot at InLocation, with no delegate bindings, before the dish widget's slot pool hands it out again
+    void ResetForReuse(EPUIngredientSlotLocation InLocation);
+
     // Controller input functions
     UFUNCTION(BlueprintCallable, Category = "Ingredient Slot|Controller")
     void HandleControllerSelect(); // Called when A/X button is pressed on focused slot
@@ -388,6 +393,10 @@ protected:
     UPROPERTY()
     UPURadialMenu* RadialMenuWidget = nullptr;
 
+    // Invalidation box the radial menu sits in when it is added to RadialMenuContainer (its own invalidation island)
+    UPROPERTY()
+    class UInvalidationBox* RadialMenuIsland = nullptr;
+
     // Radial menu visibility flag
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Ingredient Slot|Radial Menu")
     bool bRadialMenuVisible = false;
@@ -480,9 +489,14 @@ protected:
     // Native focus events
     virtual void NativeOnAddedToFocusPath(const FFocusEvent& InFocusEvent) override;
     virtual void NativeOnRemovedFromFocusPath(const FFocusEvent& InFocusEvent) override;
+    virtual void NativeOnFocusChanging(const FWeakWidgetPath& PreviousFocusPath, const FWidgetPath& NewWidgetPath, const FFocusEvent& InFocusEvent) override;
 
     // Native key/button events for controller support
     virtual FReply NativeOnKeyDown(const FGeometry& InGeometry, const FKeyEvent& InKeyEvent) override;
+    virtual FReply NativeOnAnalogValueChanged(const FGeometry& InGeometry, const FAnalogInputEvent& InAnalogEvent) override;
+
+    // List entry support (virtualized pantry): show the UPUPantryItem this recycled slot now represents
+    virtual void NativeOnListItemObjectSet(UObject* ListItemObject) override;
 
     // Blueprint events that can be overridden
     UFUNCTION(BlueprintImplementableEvent, Category = "Ingredient Slot")
@@ -512,6 +526,12 @@ protected:
     void OnTimeTemperatureChanged(float TimeValue, float TemperatureValue);
 
 private:
+    // Empty slot at InLocation with default hover / selection / navigation state (delegate bindings are kept)
+    void ResetSlotState(EPUIngredientSlotLocation InLocation);
+
+    // Keep the owning dish widget's InstanceID -> slot registry current
+    void NotifyInstanceIDChanged(int32 PreviousInstanceID);
+
     // Helper functions
     void UpdateIngredientIcon();
     void UpdatePrepIcons();
@@ -547,14 +567,18 @@ private:
     void UpdateTimeLabelText();
     void UpdateTemperatureLabelText();
     bool ShouldShowSliders() const;
-    void UpdateSliderFocusVisuals();
+    // Swap the time/temperature sliders to their hover style while focused (FocusedWidget = the widget that now has focus)
+    void UpdateSliderFocusVisuals(const SWidget* FocusedWidget);
     
     // Recalculate aspects from base + time/temp + quantity
     void RecalculateAspectsFromBase();
 
-    // Get average color from ingredient texture
+    // Get average color from ingredient texture (shared per-texture cache, may arrive a few frames later)
     void GetAverageColorFromIngredientTexture();
 
+    // Set CachedAverageColor from a texture's average color (saturation boosted unless suspicious)
+    void ApplyIngredientTextureColor(const FLinearColor& BaseColor);
+
     // Boost color saturation using HSV conversion
     FLinearColor BoostColorSaturation(const FLinearColor& Color, float SaturationMultiplier) const;
 
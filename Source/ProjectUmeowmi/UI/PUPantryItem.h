@@ -0,0 +1,25 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "PUPantryItem.generated.h"
+
+class UPUDishCustomizationWidget;
+
+// One ingredient in the virtualized pantry (list item for UPUDishCustomizationWidget::PantryTileView).
+// Deliberately tiny: the ingredient data stays in the dish widget's PantryIngredients, and a
+// UPUIngredientSlot entry only exists while the item's tile is on screen.
+UCLASS(BlueprintType)
+class PROJECTUMEOWMI_API UPUPantryItem : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    // Widget that owns the pantry data
+    UPROPERTY(BlueprintReadOnly, Category = "Pantry Item")
+    TWeakObjectPtr<UPUDishCustomizationWidget> DishWidget;
+
+    // Index into the dish widget's PantryIngredients
+    UPROPERTY(BlueprintReadOnly, Category = "Pantry Item")
+    int32 PantryIndex = INDEX_NONE;
+};
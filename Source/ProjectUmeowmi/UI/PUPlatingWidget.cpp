@@ -7,7 +7,7 @@
 #include "Engine/Engine.h"
 #include "GameFramework/PlayerController.h"
 #include "Engine/GameViewportClient.h"
-#include "Kismet/GameplayStatics.h"
+#include "../DishCustomization/PUStationRegistrySubsystem.h"
 
 // Debug output toggles (kept in code, but disabled by default to avoid log spam).
 namespace
@@ -90,6 +90,30 @@ void UPUPlatingWidget::OnDishDataUpdated(const FPUDishBase& UpdatedDishData)
     OnDishDataChanged(UpdatedDishData);
 }
 
+void UPUPlatingWidget::OnDishDeltaReceived(const FDishDelta& Delta)
+{
+    if (CustomizationComponent)
+    {
+        Delta.ApplyTo(CurrentDishData, CustomizationComponent->GetCurrentDishData());
+    }
+
+    OnDishDeltaApplied(Delta);
+}
+
+void UPUPlatingWidget::OnDishDeltaApplied_Implementation(const FDishDelta& Delta)
+{
+    // Default: hand Blueprint the one changed instance (no copy of the whole dish per delta).
+    // Blueprints written before OnDishInstanceChanged existed still get the whole dish.
+    if (!GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UPUPlatingWidget, OnDishInstanceChanged)))
+    {
+        OnDishDataChanged(CurrentDishData);
+        return;
+    }
+
+    const FIngredientInstance* Instance = CurrentDishData.FindInstanceByID(Delta.InstanceID);
+    OnDishInstanceChanged(Delta, Instance ? *Instance : FIngredientInstance());
+}
+
 void UPUPlatingWidget::OnCustomizationEnded()
 {
     if (bPU_LogPlatingWidgetDebug)
@@ -155,6 +179,8 @@ void UPUPlatingWidget::UpdateDishData(const FPUDishBase& NewDishData)
     }
 
     CurrentDishData = NewDishData;
+    // May come from Blueprint, which can edit IngredientInstances directly
+    CurrentDishData.MarkAggregatesDirty();
 
     if (CustomizationComponent)
     {
@@ -218,7 +244,7 @@ void UPUPlatingWidget::CreateIngredientButtons()
             if (bPU_LogPlatingWidgetDebug)
             {
                 //UE_LOG(LogTemp,Display, TEXT("🍽️ UPUPlatingWidget::CreateIngredientButtons -   - %s (%s) x%d [ID: %d]"), 
-                //    *Instance.IngredientData.DisplayName.ToString(), *PrepText, Instance.Quantity, Instance.InstanceID);
+                //    *Instance.GetDefinition().DisplayName.ToString(), *PrepText, Instance.Quantity, Instance.InstanceID);
             }
         }
     }
@@ -283,18 +309,8 @@ void UPUPlatingWidget::SpawnIngredientAtPosition(const FGameplayTag& IngredientT
     }
     
     // Find the dish customization station in the world
-    TArray<AActor*> FoundActors;
-    UGameplayStatics::GetAllActorsOfClass(GetWorld(), AActor::StaticClass(), FoundActors);
-    
-    AActor* DishStation = nullptr;
-    for (AActor* Actor : FoundActors)
-    {
-        if (Actor && (Actor->GetName().Contains(TEXT("CookingStation")) || Actor->GetName().Contains(TEXT("DishCustomization"))))
-        {
-            DishStation = Actor;
-            break;
-        }
-    }
+    UPUStationRegistrySubsystem* StationRegistry = UPUStationRegistrySubsystem::Get(this);
+    AActor* DishStation = StationRegistry ? StationRegistry->FindDishStation() : nullptr;
     
     // Declare spawn position at function level
     FVector SpawnPosition;
@@ -384,9 +400,8 @@ UPUIngredientDragDropOperation* UPUPlatingWidget::CreateIngredientDragDropOperat
         FIngredientInstance IngredientInstance;
         IngredientInstance.InstanceID = InstanceID;
         IngredientInstance.Quantity = Quantity;
-        IngredientInstance.IngredientData = IngredientData;
+        IngredientInstance.SetIngredientData(IngredientData);
         IngredientInstance.IngredientTag = IngredientTag;
-        IngredientInstance.Preparations = IngredientData.ActivePreparations;
         
         // Set up the drag operation with ingredient instance
         DragOperation->SetupIngredientDrag(IngredientInstance);
@@ -409,6 +424,7 @@ void UPUPlatingWidget::SubscribeToEvents()
 
         CustomizationComponent->OnInitialDishDataReceived.AddDynamic(this, &UPUPlatingWidget::OnInitialDishDataReceived);
         CustomizationComponent->OnDishDataUpdated.AddDynamic(this, &UPUPlatingWidget::OnDishDataUpdated);
+        CustomizationComponent->OnDishDelta.AddDynamic(this, &UPUPlatingWidget::OnDishDeltaReceived);
         CustomizationComponent->OnCustomizationEnded.AddDynamic(this, &UPUPlatingWidget::OnCustomizationEnded);
     }
 }
@@ -421,6 +437,7 @@ void UPUPlatingWidget::UnsubscribeFromEvents()
 
         CustomizationComponent->OnInitialDishDataReceived.RemoveDynamic(this, &UPUPlatingWidget::OnInitialDishDataReceived);
         CustomizationComponent->OnDishDataUpdated.RemoveDynamic(this, &UPUPlatingWidget::OnDishDataUpdated);
+        CustomizationComponent->OnDishDelta.RemoveDynamic(this, &UPUPlatingWidget::OnDishDeltaReceived);
         CustomizationComponent->OnCustomizationEnded.RemoveDynamic(this, &UPUPlatingWidget::OnCustomizationEnded);
     }
 }
@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
 #include "../DishCustomization/PUDishBase.h"
+#include "../DishCustomization/PUDishDelta.h"
 #include "PUIngredientButton.h"
 #include "PUIngredientQuantityControl.h"
 #include "PUPreparationCheckbox.h"
@@ -10,7 +11,7 @@
 
 class UPUDishCustomizationComponent;
 
-UCLASS(BlueprintType, Blueprintable)
+UCLASS(BlueprintType, Blueprintable, meta = (DisableNativeTick))
 class PROJECTUMEOWMI_API UPUPlatingWidget : public UUserWidget
 {
     GENERATED_BODY()
@@ -28,6 +29,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Plating Widget")
     void OnDishDataUpdated(const FPUDishBase& UpdatedDishData);
 
+    // Per-instance change from the component - patches CurrentDishData instead of replacing it
+    UFUNCTION(BlueprintCallable, Category = "Plating Widget")
+    void OnDishDeltaReceived(const FDishDelta& Delta);
+
     UFUNCTION(BlueprintCallable, Category = "Plating Widget")
     void OnCustomizationEnded();
 
@@ -96,6 +101,16 @@ protected:
     UFUNCTION(BlueprintImplementableEvent, Category = "Plating Widget")
     void OnDishDataChanged(const FPUDishBase& DishData);
 
+    // Called after a dish delta has been applied to CurrentDishData.
+    // Default implementation raises OnDishInstanceChanged for the one instance that changed. Blueprints that
+    // don't implement OnDishInstanceChanged get OnDishDataChanged (a full copy of the dish) instead.
+    UFUNCTION(BlueprintNativeEvent, Category = "Plating Widget")
+    void OnDishDeltaApplied(const FDishDelta& Delta);
+
+    // One instance changed. Instance is its patched state (default-constructed if it was removed).
+    UFUNCTION(BlueprintImplementableEvent, Category = "Plating Widget")
+    void OnDishInstanceChanged(const FDishDelta& Delta, const FIngredientInstance& Instance);
+
     UFUNCTION(BlueprintImplementableEvent, Category = "Plating Widget")
     void OnCustomizationModeEnded();
 
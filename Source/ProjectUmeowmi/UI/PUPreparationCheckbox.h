@@ -11,7 +11,7 @@ class UImage;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnPreparationCheckboxChanged, const FGameplayTag&, PreparationTag, bool, bIsChecked);
 
-UCLASS(BlueprintType, Blueprintable)
+UCLASS(BlueprintType, Blueprintable, meta = (DisableNativeTick))
 class PROJECTUMEOWMI_API UPUPreparationCheckbox : public UUserWidget
 {
     GENERATED_BODY()
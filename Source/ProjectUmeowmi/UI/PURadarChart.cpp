@@ -5,10 +5,13 @@
 #include "Engine/DataTable.h"
 #include "../DishCustomization/PUIngredientBase.h"
 #include "../DishCustomization/PUDishBase.h"
+#include "../DishCustomization/PUIngredientCatalogSubsystem.h"
+#include "../PUStats.h"
 #include "TimerManager.h"
 #include "Engine/World.h"
 #include "Blueprint/WidgetTree.h"
 #include "Components/Widget.h"
+#include "Widgets/SInvalidationPanel.h"
 
 UPURadarChart::UPURadarChart()
     : CurrentFluctuationStep(0)
@@ -26,6 +29,54 @@ UPURadarChart::UPURadarChart()
     ShowIcons(true);
 }
 
+TSharedRef<SWidget> UPURadarChart::RebuildWidget()
+{
+    // Wrap the chart in its own invalidation panel: value changes and animations repaint only the chart,
+    // and the dish customization screen around it keeps its cached paint
+    return SAssignNew(InvalidationPanel, SInvalidationPanel)
+        [
+            Super::RebuildWidget()
+        ];
+}
+
+void UPURadarChart::ReleaseSlateResources(bool bReleaseChildren)
+{
+    Super::ReleaseSlateResources(bReleaseChildren);
+
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(VolatileTimerHandle);
+    }
+    InvalidationPanel.Reset();
+}
+
+void UPURadarChart::KeepVolatileFor(float Duration)
+{
+    // SRadarChart animates its values itself, so it must be painted every frame until the animation ends.
+    // Volatile widgets are repainted on their own, without invalidating the panel's cached elements.
+    TSharedPtr<SRadarChart> RadarWidget = GetRadarWidget();
+    UWorld* World = GetWorld();
+    if (!RadarWidget.IsValid() || !World)
+    {
+        return;
+    }
+
+    RadarWidget->ForceVolatile(true);
+
+    // One more frame's worth of margin so the final value is painted before the chart is cached again
+    World->GetTimerManager().SetTimer(VolatileTimerHandle, FTimerDelegate::CreateUObject(this, &UPURadarChart::EndVolatile),
+        FMath::Max(Duration, 0.0f) + 0.1f, false);
+}
+
+void UPURadarChart::EndVolatile()
+{
+    if (TSharedPtr<SRadarChart> RadarWidget = GetRadarWidget())
+    {
+        RadarWidget->ForceVolatile(false);
+        RadarWidget->Invalidate(EInvalidateWidgetReason::Paint);
+    }
+}
+
 void UPURadarChart::ShowIcons(bool bShow)
 {
     // Enable/disable icon display
@@ -93,6 +144,11 @@ int32 UPURadarChart::GetSegmentCount() const
 
 void UPURadarChart::SetValues(const TArray<float>& InValues)
 {
+    PU_SCOPE_TIMING(RadarChartSetValues);
+
+    // A direct write supersedes an ingredient refresh queued earlier this frame
+    DiscardPendingIngredientRefresh();
+
     // Validate input array size matches segment count
     if (InValues.Num() != ChartStyle.Segments.Num())
     {
@@ -120,18 +176,18 @@ void UPURadarChart::SetValues(const TArray<float>& InValues)
     // Set the values for the first layer
     SetValuesForLayer(0, InValues);
 
-    // Log the values being set for debugging
-    FString ValuesString = TEXT("[");
-    for (int32 i = 0; i < InValues.Num(); ++i)
-    {
-        if (i > 0) ValuesString += TEXT(", ");
-        ValuesString += FString::Printf(TEXT("%.2f"), InValues[i]);
-    }
-    ValuesString += TEXT("]");
-    //UE_LOG(LogTemp,Log, TEXT("PURadarChart::SetValues: Set values: %s"), *ValuesString);
+    //UE_LOG(LogTemp,Log, TEXT("PURadarChart::SetValues: Set %d values"), InValues.Num());
 }
 
 void UPURadarChart::SetValuesAnimated(const TArray<float>& InValues, float Duration, uint8 Fps, TEnumAsByte<EEasingFunc::Type> Ease)
+{
+    // A direct write supersedes an ingredient refresh queued earlier this frame
+    DiscardPendingIngredientRefresh();
+
+    ApplyValuesAnimated(InValues, Duration, Fps, Ease);
+}
+
+void UPURadarChart::ApplyValuesAnimated(const TArray<float>& InValues, float Duration, uint8 Fps, TEnumAsByte<EEasingFunc::Type> Ease)
 {
     // Validate input array size matches segment count
     if (InValues.Num() != ChartStyle.Segments.Num())
@@ -186,15 +242,6 @@ void UPURadarChart::SetValuesAnimated(const TArray<float>& InValues, float Durat
     TSharedPtr<SRadarChart> RadarWidget = GetRadarWidget();
     if (RadarWidget.IsValid())
     {
-        // Log current RawValues for debugging
-        FString CurrentValuesStr = TEXT("[");
-        for (int32 i = 0; i < ValueLayers[0].RawValues.Num(); ++i)
-        {
-            if (i > 0) CurrentValuesStr += TEXT(", ");
-            CurrentValuesStr += FString::Printf(TEXT("%.2f"), ValueLayers[0].RawValues[i]);
-        }
-        CurrentValuesStr += TEXT("]");
-        
         // The widget's SetValuesAnimated will:
         // 1. Check if there's an ongoing animation and cancel it, preserving current RawValues
         // 2. Use the CURRENT ValueLayers[0].RawValues as OldValues (line 597 in SRadarChart.cpp)
@@ -203,22 +250,15 @@ void UPURadarChart::SetValuesAnimated(const TArray<float>& InValues, float Durat
         // Since we share the same array, RawValues should already be current
         // But if they're empty/zero and this isn't the first call, something went wrong
         RadarWidget->SetValuesAnimated(0, InValues, Duration, Fps, Ease);
+        KeepVolatileFor(Duration);
         
-        FString NewValuesStr = TEXT("[");
-        for (int32 i = 0; i < InValues.Num(); ++i)
-        {
-            if (i > 0) NewValuesStr += TEXT(", ");
-            NewValuesStr += FString::Printf(TEXT("%.2f"), InValues[i]);
-        }
-        NewValuesStr += TEXT("]");
-        
-        //UE_LOG(LogTemp,Log, TEXT("PURadarChart::SetValuesAnimated: Animating from %s to %s (duration %.2f, fps %d)"), 
-        //    *CurrentValuesStr, *NewValuesStr, Duration, Fps);
+        //UE_LOG(LogTemp,Log, TEXT("PURadarChart::SetValuesAnimated: Animating %d values (duration %.2f, fps %d)"), 
+        //    InValues.Num(), Duration, Fps);
     }
     else
     {
         //UE_LOG(LogTemp,Warning, TEXT("PURadarChart::SetValuesAnimated: Radar widget is not valid, falling back to non-animated SetValues"));
-        SetValues(InValues);
+        SetValuesForLayer(0, InValues);
     }
 }
 
@@ -229,6 +269,7 @@ void UPURadarChart::SetNormalizationScaleAnimated(float InValue, float Duration,
     if (RadarWidget.IsValid())
     {
         RadarWidget->SetNormalizationScaleAnimated(InValue, Duration, Fps, Ease);
+        KeepVolatileFor(Duration);
         //UE_LOG(LogTemp,Log, TEXT("PURadarChart::SetNormalizationScaleAnimated: Setting scale to %.2f with duration %.2f, fps %d"), 
         //    InValue, Duration, Fps);
     }
@@ -261,6 +302,8 @@ bool UPURadarChart::SetSegmentNames(const TArray<FString>& InNames)
 
 bool UPURadarChart::SetValuesFromIngredient(const FPUIngredientBase& Ingredient)
 {
+    PU_SCOPE_TIMING(RadarChartFromIngredient);
+
     // Set the number of segments based on the total number of aspects (12 total: 6 flavors + 6 textures)
     const int32 TotalAspects = 12;
     if (!SetSegmentCount(TotalAspects))
@@ -311,6 +354,8 @@ bool UPURadarChart::SetValuesFromIngredient(const FPUIngredientBase& Ingredient)
 
 bool UPURadarChart::SetValuesFromIngredientWithTimeTemp(const FPUIngredientBase& Ingredient, float TimeValue, float TemperatureValue)
 {
+    PU_SCOPE_TIMING(RadarChartFromIngredient);
+
     // Set the number of segments based on the total number of aspects (12 total: 6 flavors + 6 textures)
     const int32 TotalAspects = 12;
     if (!SetSegmentCount(TotalAspects))
@@ -320,8 +365,9 @@ bool UPURadarChart::SetValuesFromIngredientWithTimeTemp(const FPUIngredientBase&
     }
 
     // Get the MODIFIED values (with time/temp applied) and display names from the ingredient's aspects
-    FFlavorAspects ModifiedFlavor = Ingredient.GetModifiedFlavorAspects(TimeValue, TemperatureValue);
-    FTextureAspects ModifiedTexture = Ingredient.GetModifiedTextureAspects(TimeValue, TemperatureValue);
+    FFlavorAspects ModifiedFlavor;
+    FTextureAspects ModifiedTexture;
+    Ingredient.CalculateTimeTempModifiedAspects(TimeValue, TemperatureValue, ModifiedFlavor, ModifiedTexture);
     
     TArray<float> Values;
     TArray<FString> DisplayNames;
@@ -366,48 +412,111 @@ bool UPURadarChart::SetValuesFromIngredientWithTimeTemp(const FPUIngredientBase&
 
 bool UPURadarChart::SetValuesFromDishIngredients(const FPUDishBase& Dish)
 {
-    // Track unique ingredients and their quantities
-    TMap<FGameplayTag, int32> IngredientQuantities;
-    TMap<FGameplayTag, FString> IngredientNames;
-    TMap<FGameplayTag, UTexture2D*> IngredientTextures;
+    PU_SCOPE_TIMING(RadarChartFromDishIngredients);
+
+    // Names and icons are per table; drop them if the dish uses a different one than last time
+    const UDataTable* IngredientDataTable = Dish.IngredientDataTable.Get();
+    if (SegmentMetadataTable.Get() != IngredientDataTable)
+    {
+        SegmentMetadata.Reset();
+        SegmentMetadataTable = IngredientDataTable;
+    }
+
+    // Single pass: total quantity and slot count per unique ingredient, in first-seen order
+    TArray<FPendingIngredientSegment> Segments;
+    TMap<FGameplayTag, int32> SegmentIndexByTag;
+    SegmentIndexByTag.Reserve(Dish.IngredientInstances.Num());
     
     //UE_LOG(LogTemp,Log, TEXT("PURadarChart::SetValuesFromDishIngredients: Starting with %d ingredient instances"), Dish.IngredientInstances.Num());
     
     for (const FIngredientInstance& Instance : Dish.IngredientInstances)
     {
-        // Use convenient field if available, fallback to data field
-        FGameplayTag InstanceTag = Instance.IngredientTag.IsValid() ? Instance.IngredientTag : Instance.IngredientData.IngredientTag;
-        
-        //UE_LOG(LogTemp,Log, TEXT("PURadarChart::SetValuesFromDishIngredients: Processing instance with tag: %s, quantity: %d"), 
-        //    *InstanceTag.ToString(), Instance.Quantity);
+        FGameplayTag InstanceTag = Instance.IngredientTag;
         
-        // Add or update quantity for this ingredient
-        IngredientQuantities.FindOrAdd(InstanceTag) += Instance.Quantity;
+        int32& SegmentIndex = SegmentIndexByTag.FindOrAdd(InstanceTag, INDEX_NONE);
+        if (SegmentIndex == INDEX_NONE)
+        {
+            SegmentIndex = Segments.AddDefaulted();
+            Segments[SegmentIndex].Tag = InstanceTag;
+            CacheSegmentMetadata(IngredientDataTable, InstanceTag);
+        }
         
-        // Get the display name and texture if we haven't already
-        if (!IngredientNames.Contains(InstanceTag))
+        FPendingIngredientSegment& Segment = Segments[SegmentIndex];
+        Segment.Quantity += Instance.Quantity;
+        if (InstanceTag.IsValid())
         {
-            FPUIngredientBase Ingredient;
-            if (Dish.GetIngredient(InstanceTag, Ingredient))
-            {
-                IngredientNames.Add(InstanceTag, Ingredient.DisplayName.ToString());
-                if (Ingredient.PreviewTexture)
-                {
-                    IngredientTextures.Add(InstanceTag, Ingredient.PreviewTexture);
-                    //UE_LOG(LogTemp,Log, TEXT("PURadarChart::SetValuesFromDishIngredients: Found ingredient %s with texture %p"), 
-                    //    *Ingredient.DisplayName.ToString(), 
-                    //    Ingredient.PreviewTexture);
-                }
-            }
-            else
-            {
-                //UE_LOG(LogTemp,Warning, TEXT("PURadarChart::SetValuesFromDishIngredients: Failed to get ingredient data for tag: %s"), 
-                //    *InstanceTag.ToString());
-            }
+            ++Segment.SlotCount;
         }
     }
     
-    //UE_LOG(LogTemp,Log, TEXT("PURadarChart::SetValuesFromDishIngredients: Found %d unique ingredients"), IngredientQuantities.Num());
+    //UE_LOG(LogTemp,Log, TEXT("PURadarChart::SetValuesFromDishIngredients: Found %d unique ingredients"), Segments.Num());
+    
+    // Would not fit on the chart (checked now, since the refresh itself happens next tick)
+    if (FMath::Max(3, Segments.Num()) > MaxSegmentCount)
+    {
+        //UE_LOG(LogTemp,Warning, TEXT("PURadarChart::SetValuesFromDishIngredients: Too many ingredients (%d)"), Segments.Num());
+        return false;
+    }
+    
+    // Several dish updates in one frame only restart the animation once, with the latest dish
+    PendingIngredientSegments = MoveTemp(Segments);
+    if (bIngredientRefreshPending)
+    {
+        return true;
+    }
+    
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        // Design time / no world to tick - refresh right away
+        bIngredientRefreshPending = true;
+        FlushIngredientRefresh();
+        return true;
+    }
+    
+    bIngredientRefreshPending = true;
+    World->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateUObject(this, &UPURadarChart::FlushIngredientRefresh));
+    return true;
+}
+
+void UPURadarChart::CacheSegmentMetadata(const UDataTable* IngredientDataTable, const FGameplayTag& IngredientTag)
+{
+    if (!IngredientTag.IsValid() || SegmentMetadata.Contains(IngredientTag))
+    {
+        return;
+    }
+    
+    // Straight from the catalog row - display name and preview texture do not depend on preparations
+    if (const FPUIngredientBase* Ingredient = UPUIngredientCatalogSubsystem::ResolveIngredient(IngredientDataTable, IngredientTag))
+    {
+        FSegmentMetadata& Metadata = SegmentMetadata.Add(IngredientTag);
+        Metadata.DisplayName = Ingredient->DisplayName.ToString();
+        Metadata.Icon = Ingredient->PreviewTexture;
+    }
+    else
+    {
+        //UE_LOG(LogTemp,Warning, TEXT("PURadarChart::SetValuesFromDishIngredients: Failed to get ingredient data for tag: %s"), 
+        //    *IngredientTag.ToString());
+    }
+}
+
+void UPURadarChart::DiscardPendingIngredientRefresh()
+{
+    bIngredientRefreshPending = false;
+    PendingIngredientSegments.Reset();
+}
+
+void UPURadarChart::FlushIngredientRefresh()
+{
+    if (!bIngredientRefreshPending)
+    {
+        return;
+    }
+    
+    PU_SCOPE_TIMING(RadarChartIngredientRefresh);
+    
+    const TArray<FPendingIngredientSegment> Segments = MoveTemp(PendingIngredientSegments);
+    DiscardPendingIngredientRefresh();
     
     // Calculate scale based on duplicate slots (same ingredient in multiple slots)
     // Each slot can contain an ingredient, and scale increases when the same ingredient appears in multiple slots
@@ -418,27 +527,11 @@ bool UPURadarChart::SetValuesFromDishIngredients(const FPUDishBase& Dish)
     const float SCALE_PER_DUPLICATE_SLOT = 5.0f;
     const float MAX_SCALE = 60.0f;
     
-    // Count how many times each ingredient appears in slots (not quantity, but slot count)
-    // Count duplicate slots: for each ingredient that appears in multiple slots, count the extra slots
+    // If an ingredient appears in more than 1 slot, count the extra slots as duplicates
     int32 DuplicateSlots = 0;
-    for (const auto& Pair : IngredientQuantities)
+    for (const FPendingIngredientSegment& Segment : Segments)
     {
-        // Count how many slots this ingredient appears in
-        int32 SlotCount = 0;
-        for (const FIngredientInstance& Instance : Dish.IngredientInstances)
-        {
-            FGameplayTag InstanceTag = Instance.IngredientTag.IsValid() ? Instance.IngredientTag : Instance.IngredientData.IngredientTag;
-            if (InstanceTag == Pair.Key && InstanceTag.IsValid())
-            {
-                SlotCount++;
-            }
-        }
-        
-        // If ingredient appears in more than 1 slot, count the extra slots as duplicates
-        if (SlotCount > 1)
-        {
-            DuplicateSlots += (SlotCount - 1);
-        }
+        DuplicateSlots += FMath::Max(0, Segment.SlotCount - 1);
     }
     
     // Calculate scale: base 5 + 5 per duplicate slot
@@ -448,121 +541,52 @@ bool UPURadarChart::SetValuesFromDishIngredients(const FPUDishBase& Dish)
     // Set the normalization scale for the radar chart with smooth animation
     SetNormalizationScaleAnimated(NormalizationScale, 0.5f, 18, EEasingFunc::ExpoOut);
     
-    //UE_LOG(LogTemp,Log, TEXT("PURadarChart::SetValuesFromDishIngredients: Duplicate slots: %d, Scale: %.1f"), 
+    //UE_LOG(LogTemp,Log, TEXT("PURadarChart::FlushIngredientRefresh: Duplicate slots: %d, Scale: %.1f"), 
     //    DuplicateSlots, NormalizationScale);
     
     // Calculate total segments needed (minimum 3, or more if we have more ingredients)
-    int32 TotalSegments = FMath::Max(3, IngredientQuantities.Num());
+    int32 TotalSegments = FMath::Max(3, Segments.Num());
     
-    // CRITICAL: Preserve current RawValues before changing segment count
-    // SetSegmentCount calls UpdateValueLayers() which resets RawValues to zero
-    // We need to preserve them so animation can start from current values, not zero
-    TArray<float> PreservedRawValues;
-    bool bSegmentCountChanged = (GetSegmentCount() != TotalSegments);
-    if (!bSegmentCountChanged && ValueLayers.Num() > 0 && ValueLayers[0].RawValues.Num() == GetSegmentCount())
+    // Only rebuild the segments when the count changes (SetSegmentCount resets RawValues to zero);
+    // otherwise the animation starts from the values currently shown
+    if (GetSegmentCount() != TotalSegments && !SetSegmentCount(TotalSegments))
     {
-        // Segment count is the same, preserve current RawValues
-        PreservedRawValues = ValueLayers[0].RawValues;
-        //UE_LOG(LogTemp,Log, TEXT("PURadarChart::SetValuesFromDishIngredients: Preserving %d current RawValues"), PreservedRawValues.Num());
-    }
-    
-    // Set the number of segments (this will reset RawValues if count changed)
-    if (!SetSegmentCount(TotalSegments))
-    {
-        //UE_LOG(LogTemp,Warning, TEXT("PURadarChart::SetValuesFromDishIngredients: Failed to set segment count to %d"), TotalSegments);
-        return false;
-    }
-    
-    // Restore preserved RawValues if segment count didn't change
-    if (!bSegmentCountChanged && PreservedRawValues.Num() == TotalSegments && ValueLayers.Num() > 0)
-    {
-        ValueLayers[0].RawValues = PreservedRawValues;
-        //UE_LOG(LogTemp,Log, TEXT("PURadarChart::SetValuesFromDishIngredients: Restored preserved RawValues"));
+        //UE_LOG(LogTemp,Warning, TEXT("PURadarChart::FlushIngredientRefresh: Failed to set segment count to %d"), TotalSegments);
+        return;
     }
     
-    //UE_LOG(LogTemp,Log, TEXT("PURadarChart::SetValuesFromDishIngredients: Set up %d segments"), TotalSegments);
-    
-    // Prepare arrays for values and names
+    // Fill in the first segments with actual ingredients, leave remaining as placeholders
     TArray<float> Values;
-    TArray<FString> DisplayNames;
-    TArray<UTexture2D*> IconTextures;
-    
-    // Initialize with placeholder values for all segments
-    for (int32 i = 0; i < TotalSegments; ++i)
+    Values.SetNumZeroed(TotalSegments);
+    for (int32 SegmentIndex = 0; SegmentIndex < TotalSegments; ++SegmentIndex)
     {
-        Values.Add(0.0f); // No value for placeholders
-        DisplayNames.Add(TEXT("???")); // Placeholder text
-        IconTextures.Add(nullptr); // No texture for placeholders
-    }
-    
-    // Fill in the first slots with actual ingredients, leave remaining as placeholders
-    int32 SegmentIndex = 0;
-    for (const auto& Pair : IngredientQuantities)
-    {
-        if (SegmentIndex < TotalSegments)
+        auto& ChartSegment = ChartStyle.Segments[SegmentIndex];
+        if (!Segments.IsValidIndex(SegmentIndex))
         {
-            Values[SegmentIndex] = static_cast<float>(Pair.Value);
-            
-            // Get the display name, defaulting to the tag name if not found
-            FString DisplayName;
-            if (const FString* FoundName = IngredientNames.Find(Pair.Key))
-            {
-                DisplayName = *FoundName;
-            }
-            else
-            {
-                DisplayName = Pair.Key.ToString();
-            }
-            DisplayNames[SegmentIndex] = DisplayName;
-            
-            // Get the texture
-            const UTexture2D* const* FoundTexture = IngredientTextures.Find(Pair.Key);
-            if (FoundTexture)
-            {
-                IconTextures[SegmentIndex] = const_cast<UTexture2D*>(*FoundTexture);
-            }
-            
-            //UE_LOG(LogTemp,Log, TEXT("PURadarChart::SetValuesFromDishIngredients: Set segment %d to %s (Qty: %d)"), 
-            //    SegmentIndex, *DisplayName, Pair.Value);
-            
-            SegmentIndex++;
-        }
-        else
-        {
-            //UE_LOG(LogTemp,Warning, TEXT("PURadarChart::SetValuesFromDishIngredients: Too many ingredients, skipping %s"), 
-            //    *Pair.Key.ToString());
+            ChartSegment.Name = FText::FromString(TEXT("???"));
+            ApplySegmentIcon(SegmentIndex, nullptr);
+            continue;
         }
-    }
-    
-    // Ensure we have exactly the right number of segments with proper names
-    while (DisplayNames.Num() < TotalSegments)
-    {
-        DisplayNames.Add(TEXT("???"));
-        Values.Add(0.0f);
-        IconTextures.Add(nullptr);
-    }
-    
-    // Set the segment names
-    if (!SetSegmentNames(DisplayNames))
-    {
-        //UE_LOG(LogTemp,Warning, TEXT("PURadarChart::SetValuesFromDishIngredients: Failed to set segment names"));
-        return false;
+        
+        const FPendingIngredientSegment& Segment = Segments[SegmentIndex];
+        Values[SegmentIndex] = static_cast<float>(Segment.Quantity);
+        
+        // Display name and icon from the metadata cache, defaulting to the tag name if not found
+        const FSegmentMetadata* Metadata = SegmentMetadata.Find(Segment.Tag);
+        ChartSegment.Name = FText::FromString(Metadata ? Metadata->DisplayName : Segment.Tag.ToString());
+        ApplySegmentIcon(SegmentIndex, Metadata ? Metadata->Icon.Get() : nullptr);
+        
+        //UE_LOG(LogTemp,Log, TEXT("PURadarChart::FlushIngredientRefresh: Set segment %d to %s (Qty: %d)"), 
+        //    SegmentIndex, *ChartSegment.Name.ToString(), Segment.Quantity);
     }
     
     // Set the values with smooth animation
-    SetValuesAnimated(Values, 0.5f, 18, EEasingFunc::ExpoOut);
-    
-    // Set the icons
-    for (int32 i = 0; i < IconTextures.Num() && i < TotalSegments; ++i)
-    {
-        SetSegmentIcon(i, IconTextures[i]);
-    }
+    ApplyValuesAnimated(Values, 0.5f, 18, EEasingFunc::ExpoOut);
     
-    // Make sure icons are enabled
+    // Make sure icons are enabled (also rebuilds the chart once for the new names and icons)
     ShowIcons(true);
     
-    //UE_LOG(LogTemp,Log, TEXT("PURadarChart::SetValuesFromDishIngredients: Completed setup with %d segments"), TotalSegments);
-    return true;
+    //UE_LOG(LogTemp,Log, TEXT("PURadarChart::FlushIngredientRefresh: Completed setup with %d segments"), TotalSegments);
 }
 
 void UPURadarChart::SetSegmentIcon(int32 SegmentIndex, UTexture2D* IconTexture)
@@ -582,6 +606,14 @@ void UPURadarChart::SetSegmentIcon(int32 SegmentIndex, UTexture2D* IconTexture)
         return;
     }
     
+    ApplySegmentIcon(SegmentIndex, IconTexture);
+    
+    // Force a rebuild of the chart to show the new icon
+    ForceRebuild();
+}
+
+void UPURadarChart::ApplySegmentIcon(int32 SegmentIndex, UTexture2D* IconTexture)
+{
     if (IconTexture)
     {
         // Set up the icon and its brush
@@ -601,13 +633,12 @@ void UPURadarChart::SetSegmentIcon(int32 SegmentIndex, UTexture2D* IconTexture)
         
         //UE_LOG(LogTemp,Log, TEXT("PURadarChart::SetSegmentIcon: Cleared icon for segment %d"), SegmentIndex);
     }
-    
-    // Force a rebuild of the chart to show the new icon
-    ForceRebuild();
 }
 
 bool UPURadarChart::SetValuesFromDishFlavorProfile(const FPUDishBase& Dish)
 {
+    PU_SCOPE_TIMING(RadarChartFromDishFlavor);
+
     // Always show all 6 flavor aspects
     const int32 TOTAL_FLAVOR_ASPECTS = 6;
     
@@ -659,9 +690,12 @@ bool UPURadarChart::SetValuesFromDishFlavorProfile(const FPUDishBase& Dish)
     TArray<FString> DisplayNames;
     
     // Always set all 6 flavor aspects, even if they have zero values
-    for (const FName& AspectName : FlavorAspectNames)
+    // All totals come from one pass over the dish (lane order matches FlavorAspectNames)
+    const FPUAspectVector DishTotals = Dish.GetTotalAspects();
+    for (int32 AspectIndex = 0; AspectIndex < FlavorAspectNames.Num(); ++AspectIndex)
     {
-        float AspectValue = Dish.GetTotalFlavorAspect(AspectName);
+        const FName& AspectName = FlavorAspectNames[AspectIndex];
+        float AspectValue = DishTotals[AspectIndex];
         Values.Add(AspectValue);
         DisplayNames.Add(AspectName.ToString());
         
@@ -714,6 +748,8 @@ bool UPURadarChart::SetValuesFromDishFlavorProfile(const FPUDishBase& Dish)
 
 bool UPURadarChart::SetValuesFromDishTextureProfile(const FPUDishBase& Dish)
 {
+    PU_SCOPE_TIMING(RadarChartFromDishTexture);
+
     // Always show all 6 texture aspects
     const int32 TOTAL_TEXTURE_ASPECTS = 6;
     
@@ -765,9 +801,12 @@ bool UPURadarChart::SetValuesFromDishTextureProfile(const FPUDishBase& Dish)
     TArray<FString> DisplayNames;
     
     // Always set all 6 texture aspects, even if they have zero values
-    for (const FName& AspectName : TextureAspectNames)
+    // All totals come from one pass over the dish (lane order matches TextureAspectNames)
+    const FPUAspectVector DishTotals = Dish.GetTotalAspects();
+    for (int32 AspectIndex = 0; AspectIndex < TextureAspectNames.Num(); ++AspectIndex)
     {
-        float AspectValue = Dish.GetTotalTextureAspect(AspectName);
+        const FName& AspectName = TextureAspectNames[AspectIndex];
+        float AspectValue = DishTotals[PUAspects::NumFlavorLanes + AspectIndex];
         Values.Add(AspectValue);
         DisplayNames.Add(AspectName.ToString());
         
@@ -825,6 +864,8 @@ bool UPURadarChart::SetValuesFromDishFlavorProfileWithFluctuations(
     float InFluctuationDuration,
     float InSettleDuration)
 {
+    PU_SCOPE_TIMING(RadarChartFromDishFlavor);
+
     // Always show all 6 flavor aspects
     const int32 TOTAL_FLAVOR_ASPECTS = 6;
     
@@ -871,9 +912,12 @@ bool UPURadarChart::SetValuesFromDishFlavorProfileWithFluctuations(
     TArray<FString> DisplayNames;
     
     // Always set all 6 flavor aspects, even if they have zero values
-    for (const FName& AspectName : FlavorAspectNames)
+    // All totals come from one pass over the dish (lane order matches FlavorAspectNames)
+    const FPUAspectVector DishTotals = Dish.GetTotalAspects();
+    for (int32 AspectIndex = 0; AspectIndex < FlavorAspectNames.Num(); ++AspectIndex)
     {
-        float AspectValue = Dish.GetTotalFlavorAspect(AspectName);
+        const FName& AspectName = FlavorAspectNames[AspectIndex];
+        float AspectValue = DishTotals[AspectIndex];
         Values.Add(AspectValue);
         DisplayNames.Add(AspectName.ToString());
     }
@@ -922,6 +966,8 @@ bool UPURadarChart::SetValuesFromDishTextureProfileWithFluctuations(
     float InFluctuationDuration,
     float InSettleDuration)
 {
+    PU_SCOPE_TIMING(RadarChartFromDishTexture);
+
     // Always show all 6 texture aspects
     const int32 TOTAL_TEXTURE_ASPECTS = 6;
     
@@ -968,9 +1014,12 @@ bool UPURadarChart::SetValuesFromDishTextureProfileWithFluctuations(
     TArray<FString> DisplayNames;
     
     // Always set all 6 texture aspects, even if they have zero values
-    for (const FName& AspectName : TextureAspectNames)
+    // All totals come from one pass over the dish (lane order matches TextureAspectNames)
+    const FPUAspectVector DishTotals = Dish.GetTotalAspects();
+    for (int32 AspectIndex = 0; AspectIndex < TextureAspectNames.Num(); ++AspectIndex)
     {
-        float AspectValue = Dish.GetTotalTextureAspect(AspectName);
+        const FName& AspectName = TextureAspectNames[AspectIndex];
+        float AspectValue = DishTotals[PUAspects::NumFlavorLanes + AspectIndex];
         Values.Add(AspectValue);
         DisplayNames.Add(AspectName.ToString());
     }
@@ -1071,8 +1120,9 @@ void UPURadarChart::SetValuesWithFluctuations(
         }
     }
 
-    // Cancel any existing fluctuation animation
+    // Cancel any existing fluctuation animation (and any ingredient refresh queued earlier this frame)
     CancelFluctuationAnimation();
+    DiscardPendingIngredientRefresh();
 
     // Store parameters
     FinalTargetValues = InValues;
@@ -1118,6 +1168,8 @@ bool UPURadarChart::IsFluctuationAnimationInProgress() const
 
 void UPURadarChart::ProcessFluctuationStep()
 {
+    PU_SCOPE_TIMING(RadarChartFluctuationStep);
+
     if (FinalTargetValues.Num() != ChartStyle.Segments.Num())
     {
         //UE_LOG(LogTemp,Warning, TEXT("PURadarChart::ProcessFluctuationStep: Final values array size mismatch"));
@@ -1159,7 +1211,7 @@ void UPURadarChart::ProcessFluctuationStep()
     }
 
     // Animate to the target values
-    SetValuesAnimated(TargetValues, AnimationDuration, AnimationFps, AnimationEase);
+    ApplyValuesAnimated(TargetValues, AnimationDuration, AnimationFps, AnimationEase);
 
     // Schedule next step
     CurrentFluctuationStep++;
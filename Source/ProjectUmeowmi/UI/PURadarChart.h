@@ -100,8 +100,9 @@ public:
 
     /**
      * Sets values from a dish's ingredient quantities.
+     * The chart refreshes on the next tick, once, with the latest dish passed in this frame.
      * @param Dish - The dish to get ingredient quantities from
-     * @return True if the values were successfully set
+     * @return True if the refresh was queued (false if the dish has more ingredients than the chart has segments)
      */
     UFUNCTION(BlueprintCallable, Category = "Radar Chart")
     bool SetValuesFromDishIngredients(const FPUDishBase& Dish);
@@ -245,6 +246,11 @@ public:
     void OnFluctuationAnimationCompleteEvent();
 
 protected:
+    //~ Begin UWidget Interface
+    virtual TSharedRef<SWidget> RebuildWidget() override;
+    virtual void ReleaseSlateResources(bool bReleaseChildren) override;
+    //~ End UWidget Interface
+
     /** Minimum number of segments allowed in the radar chart */
     static const int32 MinSegmentCount = 1;
     
@@ -263,7 +269,60 @@ protected:
     /** Generates random fluctuation values based on final values and intensity */
     TArray<float> GenerateFluctuationValues(const TArray<float>& FinalValues, float Intensity);
 
+    /** SetValuesAnimated without discarding a queued ingredient refresh (used by the refresh and fluctuation steps) */
+    void ApplyValuesAnimated(const TArray<float>& InValues, float Duration, uint8 Fps, TEnumAsByte<EEasingFunc::Type> Ease);
+
+    /** Sets a segment's icon without rebuilding the chart */
+    void ApplySegmentIcon(int32 SegmentIndex, UTexture2D* IconTexture);
+
+    /** Applies the latest SetValuesFromDishIngredients call (next tick) */
+    void FlushIngredientRefresh();
+
+    /** Drops a queued ingredient refresh (a direct value write supersedes it) */
+    void DiscardPendingIngredientRefresh();
+
+    /** Resolves an ingredient's segment name and icon once */
+    void CacheSegmentMetadata(const UDataTable* IngredientDataTable, const FGameplayTag& IngredientTag);
+
+    /** Keeps the chart volatile (repainted every frame inside its invalidation panel) while an animation runs */
+    void KeepVolatileFor(float Duration);
+
+    /** Lets the invalidation panel cache the chart again once its animation is over */
+    void EndVolatile();
+
 private:
+    /** One ingredient segment waiting for the next refresh */
+    struct FPendingIngredientSegment
+    {
+        FGameplayTag Tag;
+        int32 Quantity = 0;
+        int32 SlotCount = 0;
+    };
+
+    /** Segment label and icon for an ingredient */
+    struct FSegmentMetadata
+    {
+        FString DisplayName;
+        TWeakObjectPtr<UTexture2D> Icon;
+    };
+
+    /** Latest ingredient segments, applied by FlushIngredientRefresh */
+    TArray<FPendingIngredientSegment> PendingIngredientSegments;
+
+    /** Whether FlushIngredientRefresh is scheduled for the next tick */
+    bool bIngredientRefreshPending = false;
+
+    /** Segment labels and icons by ingredient tag, for SegmentMetadataTable */
+    TMap<FGameplayTag, FSegmentMetadata> SegmentMetadata;
+    TWeakObjectPtr<const UDataTable> SegmentMetadataTable;
+
+
+    /** The chart's own invalidation island, so its repaints never invalidate the screen around it */
+    TSharedPtr<class SInvalidationPanel> InvalidationPanel;
+
+    /** Ends the volatile window started by KeepVolatileFor */
+    FTimerHandle VolatileTimerHandle;
+
     /** Timer handle for fluctuation animation sequence */
     FTimerHandle FluctuationTimerHandle;
 
@@ -9,6 +9,7 @@
 #include "Engine/DataTable.h"
 #include "Blueprint/WidgetTree.h"
 #include "PURadialMenuItemButton.h"
+#include "SDirectionLineWidget.h"
 #include "Input/Events.h"
 #include "Framework/Application/SlateApplication.h"
 #include "GameFramework/PlayerController.h"
@@ -27,12 +28,31 @@
 #include "Fonts/FontMeasure.h"
 #include "Engine/Engine.h"
 
+namespace
+{
+    // Resolution of the stick angle -> menu item table (one sector per degree)
+    constexpr int32 RadialMenuSectorCount = 360;
+
+    // Direction line changes smaller than this are not worth a repaint
+    constexpr float DirectionLineRepaintAngleTolerance = 0.5f;
+    constexpr float DirectionLineRepaintMagnitudeTolerance = 0.01f;
+
+    // Debug region overlay
+    const FLinearColor RegionLineColor(0.5f, 0.5f, 0.5f, 0.5f); // Gray, semi-transparent
+    constexpr float RegionLineThickness = 1.0f;
+    const FLinearColor RegionHighlightColor = FLinearColor::Yellow;
+    constexpr float RegionHighlightThickness = 2.0f;
+    constexpr float RegionLabelInset = 15.0f; // Labels sit this far in from their button, toward the center
+}
+
 UPURadialMenu::UPURadialMenu(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
     , bIsVisible(false)
     , PreparationDataTable(nullptr)
     , ItemRadius(100.0f)
 {
+    // Diamond pointer: Tip (0), Right (1), Base (2), Left (3) as two triangles
+    DiamondIndices = { 0, 1, 2, 0, 2, 3 };
 }
 
 void UPURadialMenu::NativeConstruct()
@@ -89,6 +109,10 @@ void UPURadialMenu::ShowMenuAtPosition(const FVector2D& ScreenPosition)
     // Reset selected index to first item when menu opens
     SelectedMenuItemIndex = 0;
     
+    // Stick state is only updated by analog events, so start from rest
+    CurrentStickX = 0.0f;
+    CurrentStickY = 0.0f;
+    
     // Set the center position
     MenuCenterPosition = ScreenPosition;
     SetMenuCenterPosition(ScreenPosition);
@@ -190,13 +214,9 @@ void UPURadialMenu::HideMenu()
     }
     
     // Hide the direction line
-    bShouldDrawDirectionLine = false;
-    CurrentDirectionLength = 0.0f;
-    CurrentInputMagnitude = 0.0f;
-    if (IsValid(this))
-    {
-        Invalidate(EInvalidateWidget::Paint);
-    }
+    ClearDirectionLine();
+    CurrentStickX = 0.0f;
+    CurrentStickY = 0.0f;
 
     // Note: Don't remove from parent/viewport here - keep it in the hierarchy
     // Just hide it so it can be shown again quickly
@@ -232,6 +252,9 @@ void UPURadialMenu::SetLayoutCenterPosition(const FVector2D& InCenterPosition)
 
 void UPURadialMenu::UpdateMenuLayout()
 {
+    SectorTable.Reset();
+    RegionLabels.Reset();
+    
     int32 ItemCount = MenuItems.Num();
     if (ItemCount == 0)
     {
@@ -253,9 +276,6 @@ void UPURadialMenu::UpdateMenuLayout()
     // Get container size - try multiple methods to ensure we get a valid size
     FVector2D ContainerSize = FVector2D::ZeroVector;
     
-    // Force geometry update first to ensure we have valid cached geometry
-    MenuItemsContainer->InvalidateLayoutAndVolatility();
-    
     // Try GetCachedGeometry first (most reliable at runtime)
     FGeometry ContainerGeometry = MenuItemsContainer->GetCachedGeometry();
     if (ContainerGeometry.GetLocalSize().X > 0 && ContainerGeometry.GetLocalSize().Y > 0)
@@ -362,9 +382,104 @@ void UPURadialMenu::UpdateMenuLayout()
         MenuItemsContainer->ForceLayoutPrepass();
     }
 
+    BuildSectorTable();
+    BuildPaintGeometry();
+
     //UE_LOG(LogTemp,Display, TEXT("🎯 UPURadialMenu::UpdateMenuLayout - Created and positioned %d menu item buttons"), MenuItemButtons.Num());
 }
 
+void UPURadialMenu::BuildSectorTable()
+{
+    SectorTable.Init(INDEX_NONE, RadialMenuSectorCount);
+    
+    const int32 NumButtons = MenuItemButtons.Num();
+    if (NumButtons == 0)
+    {
+        return;
+    }
+    
+    // Each sector maps to the enabled item whose layout angle is closest to the sector's middle
+    // (the same angles UpdateMenuLayout placed the buttons at, so stick direction and button direction agree)
+    const float SectorSize = 360.0f / RadialMenuSectorCount;
+    for (int32 Sector = 0; Sector < RadialMenuSectorCount; ++Sector)
+    {
+        const float SectorAngle = (Sector + 0.5f) * SectorSize;
+        float SmallestAngleDiff = 360.0f;
+        
+        for (int32 i = 0; i < NumButtons; ++i)
+        {
+            if (MenuItems.IsValidIndex(i) && !MenuItems[i].bIsEnabled)
+            {
+                continue;
+            }
+            
+            // Handle wrap-around (e.g., 350° and 10° are only 20° apart)
+            float AngleDiff = FMath::Abs(SectorAngle - GetMenuItemAngle(i));
+            if (AngleDiff > 180.0f)
+            {
+                AngleDiff = 360.0f - AngleDiff;
+            }
+            
+            if (AngleDiff < SmallestAngleDiff)
+            {
+                SmallestAngleDiff = AngleDiff;
+                SectorTable[Sector] = i;
+            }
+        }
+    }
+}
+
+void UPURadialMenu::BuildPaintGeometry()
+{
+    RegionLineVertices.Reset();
+    RegionLineIndices.Reset();
+    RegionHighlightVertices.Reset();
+    RegionHighlightIndices.Reset();
+    RegionLabels.Reset();
+
+    const int32 NumButtons = MenuItemButtons.Num();
+    if (NumButtons == 0)
+    {
+        return;
+    }
+
+    RegionLabelFont = FCoreStyle::GetDefaultFontStyle("Regular", 12);
+    TSharedPtr<FSlateFontMeasure> FontMeasure;
+    if (FSlateApplication::IsInitialized() && FSlateApplication::Get().GetRenderer())
+    {
+        FontMeasure = FSlateApplication::Get().GetRenderer()->GetFontMeasureService();
+    }
+
+    const FSlateRenderTransform LocalSpace;
+    for (int32 i = 0; i < NumButtons; ++i)
+    {
+        const float ItemAngle = GetMenuItemAngle(i);
+        const float AngleRadians = FMath::DegreesToRadians(ItemAngle);
+
+        // Same direction as the button positioning (+Sin to match the flipped buttons)
+        const FVector2D Direction(FMath::Cos(AngleRadians), FMath::Sin(AngleRadians));
+        const FVector2f EndPoint = FVector2f(Direction * ItemRadius);
+
+        SDirectionLineWidget::AppendLineGeometry(RegionLineVertices, RegionLineIndices, LocalSpace,
+            FVector2f::ZeroVector, EndPoint, RegionLineThickness, RegionLineColor, RegionLineColor);
+        SDirectionLineWidget::AppendLineGeometry(RegionHighlightVertices, RegionHighlightIndices, LocalSpace,
+            FVector2f::ZeroVector, EndPoint, RegionHighlightThickness, RegionHighlightColor, RegionHighlightColor);
+
+        FRegionLabel& Label = RegionLabels.AddDefaulted_GetRef();
+        Label.Text = FString::Printf(TEXT("[%d] %.0f°"), i, ItemAngle);
+        Label.Size = FontMeasure.IsValid() ? FontMeasure->Measure(Label.Text, RegionLabelFont) : FVector2D::ZeroVector;
+        Label.Offset = Direction * (ItemRadius - RegionLabelInset) - (Label.Size * 0.5f);
+    }
+
+    // Only one highlight is drawn at a time, so the first line's indices (0-based) serve every item
+    RegionHighlightIndices.SetNum(SDirectionLineWidget::LineIndexCount);
+
+    // Room for the larger of the region lines and the direction line (glow + gradient segments + arrowhead)
+    const int32 DirectionLineCount = FMath::Max(DirectionLineGradientSegments, 1) + 2;
+    PaintVertices.Reserve(FMath::Max(NumButtons, DirectionLineCount) * SDirectionLineWidget::LineVertexCount);
+    PaintIndices.Reserve(DirectionLineCount * SDirectionLineWidget::LineIndexCount);
+}
+
 void UPURadialMenu::ClearMenuItems()
 {
     // Make a copy of the array to avoid iterating over it if GC happens during iteration
@@ -486,118 +601,80 @@ void UPURadialMenu::SelectMenuItemByIndex(int32 ItemIndex)
     OnMenuItemSelected.Broadcast(SelectedItem);
 }
 
-void UPURadialMenu::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+FReply UPURadialMenu::NativeOnAnalogValueChanged(const FGeometry& InGeometry, const FAnalogInputEvent& InAnalogEvent)
 {
-    Super::NativeTick(MyGeometry, InDeltaTime);
+    if (HandleStickInput(InAnalogEvent))
+    {
+        return FReply::Handled();
+    }
     
+    return Super::NativeOnAnalogValueChanged(InGeometry, InAnalogEvent);
+}
+
+bool UPURadialMenu::HandleStickInput(const FAnalogInputEvent& InAnalogEvent)
+{
     // Only handle joystick input if menu is visible
     if (!bIsVisible || MenuItemButtons.Num() == 0)
     {
-        JoystickSelectionCooldown = 0.0f;
-        return;
+        return false;
     }
     
-    // Debug logs removed - use bShowDebugText if you need to see this
+    // Each axis arrives as its own event, and only when its value changes
+    const FKey Key = InAnalogEvent.GetKey();
+    if (Key == EKeys::Gamepad_LeftX)
+    {
+        CurrentStickX = InAnalogEvent.GetAnalogValue();
+    }
+    else if (Key == EKeys::Gamepad_LeftY)
+    {
+        CurrentStickY = InAnalogEvent.GetAnalogValue();
+    }
+    else
+    {
+        return false;
+    }
     
-    // Update cooldown
-    if (JoystickSelectionCooldown > 0.0f)
+    // Stick values are only drawn by the debug text
+    if (bShowDebugText)
     {
-        JoystickSelectionCooldown -= InDeltaTime;
+        Invalidate(EInvalidateWidget::Paint);
     }
     
-    // Get player controller to read joystick input
-    if (UWorld* World = GetWorld())
+    // Apply deadzone
+    FVector2D StickInput(CurrentStickX, CurrentStickY);
+    float InputMagnitude = StickInput.Size();
+    
+    if (InputMagnitude < JoystickDeadzone)
     {
-        if (APlayerController* PC = World->GetFirstPlayerController())
-        {
-            // Get left stick input values
-            float LeftStickX = 0.0f;
-            float LeftStickY = 0.0f;
-            
-            // Get analog stick values
-            if (PC->InputComponent)
-            {
-                LeftStickX = PC->GetInputAnalogKeyState(EKeys::Gamepad_LeftX);
-                LeftStickY = PC->GetInputAnalogKeyState(EKeys::Gamepad_LeftY);
-                
-                // Debug: Log raw input values (only when there's significant input to avoid spam)
-                if (FMath::Abs(LeftStickX) > 0.1f || FMath::Abs(LeftStickY) > 0.1f)
-                {
-                    UE_LOG(LogTemp, Warning, TEXT("🎮 Raw Stick Input - X: %.2f, Y: %.2f"), LeftStickX, LeftStickY);
-                }
-            }
-            else
-            {
-                UE_LOG(LogTemp, Warning, TEXT("🎮 UPURadialMenu::NativeTick - InputComponent is NULL!"));
-            }
-            
-            // Apply deadzone
-            FVector2D StickInput(LeftStickX, LeftStickY);
-            float InputMagnitude = StickInput.Size();
-            
-            if (InputMagnitude < JoystickDeadzone)
-            {
-                // Input is below deadzone, hide the direction line
-                bShouldDrawDirectionLine = false;
-                CurrentDirectionLength = 0.0f;
-                CurrentInputMagnitude = 0.0f;
-                CurrentStickX = 0.0f;
-                CurrentStickY = 0.0f;
-                if (IsValid(this))
-                {
-                    Invalidate(EInvalidateWidget::Paint);
-                }
-                return;
-            }
-            
-            // Normalize input
-            StickInput.Normalize();
-            
-            // Calculate angle in degrees (0-360, where 0 is right, 90 is up, 180 is left, 270 is down)
-            // In Unreal's input: stick up = negative Y, stick right = positive X
-            // We want standard math angles: 0° = right, 90° = up, 180° = left, 270° = down
-            // Atan2(-Y, X) converts from Unreal's input (up = -Y) to standard math (up = +Y)
-            // This gives us: up stick → Atan2(1, 0) = 90°, right stick → Atan2(0, 1) = 0°
-            float AngleRadians = FMath::Atan2(-StickInput.Y, StickInput.X);
-            float AngleDegrees = FMath::RadiansToDegrees(AngleRadians);
-            
-            // Convert to 0-360 range (atan2 returns -180 to 180)
-            if (AngleDegrees < 0.0f)
-            {
-                AngleDegrees += 360.0f;
-            }
-            
-            // Update the direction line to show where the stick is pointing
-            // Use normalized magnitude (0.0 to 1.0) for line length
-            float NormalizedMagnitude = FMath::Clamp((InputMagnitude - JoystickDeadzone) / (1.0f - JoystickDeadzone), 0.0f, 1.0f);
-            
-            // Store stick values for on-screen display
-            CurrentStickX = LeftStickX;
-            CurrentStickY = LeftStickY;
-            
-            // Debug log removed - use bShowDebugText if you need to see this
-            
-            UpdateDirectionLine(AngleDegrees, NormalizedMagnitude);
-            
-            // Only update selection if cooldown is expired
-            if (JoystickSelectionCooldown <= 0.0f)
-            {
-                SelectMenuItemByAngle(AngleDegrees);
-                JoystickSelectionCooldown = JoystickSelectionRepeatDelay;
-            }
-        }
-        else
-        {
-            // No player controller, hide the direction line
-            bShouldDrawDirectionLine = false;
-            CurrentDirectionLength = 0.0f;
-            CurrentInputMagnitude = 0.0f;
-            if (IsValid(this))
-            {
-                Invalidate(EInvalidateWidget::Paint);
-            }
-        }
+        // Input is below deadzone, hide the direction line
+        ClearDirectionLine();
+        return true;
     }
+    
+    // Normalize input
+    StickInput.Normalize();
+    
+    // Calculate angle in degrees (0-360, where 0 is right, 90 is up, 180 is left, 270 is down)
+    // In Unreal's input: stick up = negative Y, stick right = positive X
+    // We want standard math angles: 0° = right, 90° = up, 180° = left, 270° = down
+    // Atan2(-Y, X) converts from Unreal's input (up = -Y) to standard math (up = +Y)
+    // This gives us: up stick → Atan2(1, 0) = 90°, right stick → Atan2(0, 1) = 0°
+    float AngleRadians = FMath::Atan2(-StickInput.Y, StickInput.X);
+    float AngleDegrees = FMath::RadiansToDegrees(AngleRadians);
+    
+    // Convert to 0-360 range (atan2 returns -180 to 180)
+    if (AngleDegrees < 0.0f)
+    {
+        AngleDegrees += 360.0f;
+    }
+    
+    // Update the direction line to show where the stick is pointing
+    // Use normalized magnitude (0.0 to 1.0) for line length
+    float NormalizedMagnitude = FMath::Clamp((InputMagnitude - JoystickDeadzone) / (1.0f - JoystickDeadzone), 0.0f, 1.0f);
+    
+    UpdateDirectionLine(AngleDegrees, NormalizedMagnitude);
+    SelectMenuItemByAngle(AngleDegrees);
+    return true;
 }
 
 float UPURadialMenu::GetMenuItemAngle(int32 ItemIndex) const
@@ -620,115 +697,24 @@ float UPURadialMenu::GetMenuItemAngle(int32 ItemIndex) const
         AngleDegrees += 360.0f;
     }
     
-    // Debug log (only log once per item when menu is shown, use Warning level for visibility)
-    static TSet<int32> LoggedItems;
-    if (bIsVisible && !LoggedItems.Contains(ItemIndex))
-    {
-        UE_LOG(LogTemp, Warning, TEXT("🎯 Menu Item %d - Angle: %.2f° (AngleStep: %.2f°, Total Items: %d)"), 
-            ItemIndex, AngleDegrees, AngleStep, NumButtons);
-        LoggedItems.Add(ItemIndex);
-        
-        // Clear logged items when menu closes (reset when all items are logged)
-        if (LoggedItems.Num() >= NumButtons)
-        {
-            LoggedItems.Empty();
-        }
-    }
-    
     return AngleDegrees;
 }
 
 void UPURadialMenu::SelectMenuItemByAngle(float AngleDegrees)
 {
-    // Cache array sizes to avoid accessing during potential GC
-    const int32 NumButtons = MenuItemButtons.Num();
-    const int32 NumMenuItems = MenuItems.Num();
-    
-    if (NumButtons == 0 || !MenuItemsContainer)
+    if (SectorTable.Num() == 0)
     {
         return;
     }
     
-    // Convert stick angle to direction vector (standard math: 0° = right, 90° = up)
-    float AngleRadians = FMath::DegreesToRadians(AngleDegrees);
-    FVector2D StickDirection(FMath::Cos(AngleRadians), FMath::Sin(AngleRadians));
-    
-    // Get the center position of the menu (use the layout center)
-    FVector2D CenterPos = bUseCustomCenter ? LayoutCenterPosition : MenuCenterPosition;
-    
-    // If we don't have a valid center, try to get it from the container
-    if (CenterPos.IsNearlyZero())
-    {
-        FGeometry ContainerGeometry = MenuItemsContainer->GetCachedGeometry();
-        FVector2D ContainerSize = ContainerGeometry.GetLocalSize();
-        CenterPos = ContainerSize * 0.5f;
-    }
-    
-    // Find the menu item closest to the stick direction
-    int32 ClosestIndex = 0;
-    float SmallestAngleDiff = 360.0f;
-    
-    for (int32 i = 0; i < NumButtons; ++i)
-    {
-        // Skip disabled items - use cached size check
-        if (i >= 0 && i < NumMenuItems && !MenuItems[i].bIsEnabled)
-        {
-            continue;
-        }
-        
-        // Use cached size check instead of array access
-        if (i < 0 || i >= NumButtons || !IsValid(MenuItemButtons[i]))
-        {
-            continue;
-        }
-        
-        // Get the actual button position from its slot
-        FVector2D ButtonPos = CenterPos; // Default to center if we can't get position
-        if (UCanvasPanelSlot* ButtonSlot = Cast<UCanvasPanelSlot>(MenuItemButtons[i]->Slot))
-        {
-            FVector2D SlotPos = ButtonSlot->GetPosition();
-            FVector2D SlotSize = ButtonSlot->GetSize();
-            // Button center position = slot position + half size
-            ButtonPos = SlotPos + (SlotSize * 0.5f);
-        }
-        
-        // Calculate direction from center to button
-        FVector2D ButtonDirection = (ButtonPos - CenterPos);
-        float ButtonDistance = ButtonDirection.Size();
-        
-        if (ButtonDistance > 0.01f) // Avoid division by zero
-        {
-            ButtonDirection.Normalize();
-            
-            // Calculate angle of button direction
-            float ButtonAngleRadians = FMath::Atan2(ButtonDirection.Y, ButtonDirection.X);
-            float ButtonAngleDegrees = FMath::RadiansToDegrees(ButtonAngleRadians);
-            if (ButtonAngleDegrees < 0.0f)
-            {
-                ButtonAngleDegrees += 360.0f;
-            }
-            
-            // Calculate the difference between joystick angle and button angle
-            // Handle wrap-around (e.g., 350° and 10° are only 20° apart)
-            float AngleDiff = FMath::Abs(AngleDegrees - ButtonAngleDegrees);
-            if (AngleDiff > 180.0f)
-            {
-                AngleDiff = 360.0f - AngleDiff;
-            }
-            
-            if (AngleDiff < SmallestAngleDiff)
-            {
-                SmallestAngleDiff = AngleDiff;
-                ClosestIndex = i;
-            }
-        }
-    }
+    // Closest enabled item comes straight from the sector table built by UpdateMenuLayout
+    const int32 Sector = FMath::Clamp(FMath::FloorToInt(AngleDegrees * SectorTable.Num() / 360.0f), 0, SectorTable.Num() - 1);
+    const int32 ClosestIndex = SectorTable[Sector];
     
     // Only update if the selection changed
-    if (ClosestIndex != SelectedMenuItemIndex)
+    if (ClosestIndex != INDEX_NONE && ClosestIndex != SelectedMenuItemIndex)
     {
         NavigateToMenuItem(ClosestIndex);
-        UpdateSelectionIndicator();
     }
 }
 
@@ -763,7 +749,7 @@ FReply UPURadialMenu::NativeOnKeyDown(const FGeometry& InGeometry, const FKeyEve
         }
     }
     
-    // Handle D-pad navigation (left stick is handled in NativeTick for directional selection)
+    // Handle D-pad navigation (left stick is handled in NativeOnAnalogValueChanged for directional selection)
     bool bNavigated = false;
     if (Key == EKeys::Gamepad_DPad_Right || Key == EKeys::Right)
     {
@@ -816,7 +802,13 @@ void UPURadialMenu::NavigateToMenuItem(int32 NewIndex)
         }
     }
     
-    SelectedMenuItemIndex = NewIndex;
+    if (SelectedMenuItemIndex != NewIndex)
+    {
+        SelectedMenuItemIndex = NewIndex;
+        
+        // NativePaint highlights the selected item
+        Invalidate(EInvalidateWidget::Paint);
+    }
     SetFocusToSelectedMenuItem();
     UpdateSelectionIndicator();
     
@@ -945,105 +937,42 @@ int32 UPURadialMenu::NativePaint(const FPaintArgs& Args, const FGeometry& Allott
     LayerId = Super::NativePaint(Args, AllottedGeometry, MyCullingRect, OutDrawElements, LayerId, InWidgetStyle, bParentEnabled);
     
     // Get the center of the widget
-    FVector2D Center = AllottedGeometry.GetLocalSize() * 0.5f;
+    const FVector2D Center = AllottedGeometry.GetLocalSize() * 0.5f;
+    const FSlateRenderTransform& RenderTransform = AllottedGeometry.GetAccumulatedRenderTransform();
+    const FSlateResourceHandle ResourceHandle = FSlateApplication::Get().GetRenderer()->GetResourceHandle(*FCoreStyle::Get().GetBrush("WhiteBrush"));
     
     // Cache array sizes and indices to avoid accessing arrays during GC
-    const int32 NumButtons = MenuItemButtons.Num();
+    const int32 NumRegions = RegionLabels.Num();
     const int32 NumMenuItems = MenuItems.Num();
     const int32 CachedSelectedIndex = SelectedMenuItemIndex;
     
     // Draw debug visualization if enabled
-    if (bShowDebugRegions && bIsVisible && NumButtons > 0)
+    if (bShowDebugRegions && bIsVisible && NumRegions > 0)
     {
-        // Draw lines from center to each button to show regions
-        for (int32 i = 0; i < NumButtons; ++i)
-        {
-            float ItemAngle = GetMenuItemAngle(i);
-            float AngleRadians = FMath::DegreesToRadians(ItemAngle);
-            
-            // Calculate direction (same as button positioning - use +Sin to match flipped buttons)
-            FVector2D Direction(FMath::Cos(AngleRadians), FMath::Sin(AngleRadians));
-            FVector2D EndPoint = Center + (Direction * ItemRadius);
-            
-            // Draw region line (lighter color)
-            TArray<FVector2D> RegionLinePoints;
-            RegionLinePoints.Add(Center);
-            RegionLinePoints.Add(EndPoint);
-            
-            FSlateDrawElement::MakeLines(
-                OutDrawElements,
-                LayerId + 1,
-                AllottedGeometry.ToPaintGeometry(),
-                RegionLinePoints,
-                ESlateDrawEffect::None,
-                FLinearColor(0.5f, 0.5f, 0.5f, 0.5f), // Gray, semi-transparent
-                false,
-                1.0f
-            );
-        }
+        // All region lines (center to each button) in one batch
+        SDirectionLineWidget::TransformGeometry(RegionLineVertices, RenderTransform, FVector2f(Center), PaintVertices);
+        FSlateDrawElement::MakeCustomVerts(OutDrawElements, LayerId + 1, ResourceHandle, PaintVertices, RegionLineIndices, nullptr, 0, 0);
         
         // Draw the selected region more prominently
-        if (CachedSelectedIndex >= 0 && CachedSelectedIndex < NumButtons)
+        if (CachedSelectedIndex >= 0 && CachedSelectedIndex < NumRegions)
         {
-            float SelectedAngle = GetMenuItemAngle(CachedSelectedIndex);
-            float AngleRadians = FMath::DegreesToRadians(SelectedAngle);
-            FVector2D Direction(FMath::Cos(AngleRadians), FMath::Sin(AngleRadians)); // Use +Sin to match flipped buttons
-            FVector2D EndPoint = Center + (Direction * ItemRadius);
-            
-            TArray<FVector2D> SelectedLinePoints;
-            SelectedLinePoints.Add(Center);
-            SelectedLinePoints.Add(EndPoint);
-            
-            FSlateDrawElement::MakeLines(
-                OutDrawElements,
-                LayerId + 2,
-                AllottedGeometry.ToPaintGeometry(),
-                SelectedLinePoints,
-                ESlateDrawEffect::None,
-                FLinearColor::Yellow, // Yellow for selected
-                false,
-                2.0f
-            );
+            const TConstArrayView<FSlateVertex> SelectedLine = MakeArrayView(RegionHighlightVertices).Slice(
+                CachedSelectedIndex * SDirectionLineWidget::LineVertexCount, SDirectionLineWidget::LineVertexCount);
+            SDirectionLineWidget::TransformGeometry(SelectedLine, RenderTransform, FVector2f(Center), PaintVertices);
+            FSlateDrawElement::MakeCustomVerts(OutDrawElements, LayerId + 2, ResourceHandle, PaintVertices, RegionHighlightIndices, nullptr, 0, 0);
         }
         
-        // Draw angle labels for each button
-        const FSlateFontInfo FontInfo = FCoreStyle::GetDefaultFontStyle("Regular", 12);
-        const TSharedRef<FSlateFontMeasure> FontMeasure = FSlateApplication::Get().GetRenderer()->GetFontMeasureService();
-        
-        for (int32 i = 0; i < NumButtons; ++i)
+        // Draw angle labels for each button (text and size come from the layout)
+        for (int32 i = 0; i < NumRegions; ++i)
         {
-            // Use cached size check instead of accessing array
-            if (i < 0 || i >= NumButtons)
-            {
-                continue;
-            }
-            
-            float ItemAngle = GetMenuItemAngle(i);
-            float AngleRadians = FMath::DegreesToRadians(ItemAngle);
-            
-            // Calculate button position (same as how buttons are positioned)
-            // Use +Sin to match the flipped button positioning
-            FVector2D Direction(FMath::Cos(AngleRadians), FMath::Sin(AngleRadians));
-            FVector2D ButtonPosition = Center + (Direction * ItemRadius);
-            
-            // Format text showing button index and angle
-            FString AngleText = FString::Printf(TEXT("[%d] %.0f°"), i, ItemAngle);
-            
-            // Measure text size
-            FVector2D TextSize = FontMeasure->Measure(AngleText, FontInfo);
-            
-            // Position text slightly offset from button (toward center)
-            FVector2D TextOffset = -Direction * 15.0f; // Offset 15px toward center
-            FVector2D TextPosition = ButtonPosition + TextOffset - (TextSize * 0.5f);
+            const FRegionLabel& Label = RegionLabels[i];
+            const FVector2D TextPosition = Center + Label.Offset;
             
             // Draw text background (small semi-transparent rectangle)
-            FVector2D BackgroundSize = TextSize + FVector2D(4.0f, 4.0f);
-            FVector2D BackgroundPosition = TextPosition - FVector2D(2.0f, 2.0f);
-            
             FSlateDrawElement::MakeBox(
                 OutDrawElements,
                 LayerId + 3,
-                AllottedGeometry.ToPaintGeometry(BackgroundSize, FSlateLayoutTransform(BackgroundPosition)),
+                AllottedGeometry.ToPaintGeometry(Label.Size + FVector2D(4.0f, 4.0f), FSlateLayoutTransform(TextPosition - FVector2D(2.0f, 2.0f))),
                 FCoreStyle::Get().GetBrush("WhiteBrush"),
                 ESlateDrawEffect::None,
                 FLinearColor(0.0f, 0.0f, 0.0f, 0.6f) // Black with 60% opacity
@@ -1053,9 +982,9 @@ int32 UPURadialMenu::NativePaint(const FPaintArgs& Args, const FGeometry& Allott
             FSlateDrawElement::MakeText(
                 OutDrawElements,
                 LayerId + 4,
-                AllottedGeometry.ToPaintGeometry(TextSize, FSlateLayoutTransform(TextPosition)),
-                AngleText,
-                FontInfo,
+                AllottedGeometry.ToPaintGeometry(Label.Size, FSlateLayoutTransform(TextPosition)),
+                Label.Text,
+                RegionLabelFont,
                 ESlateDrawEffect::None,
                 i == CachedSelectedIndex ? FLinearColor::Yellow : FLinearColor::White // Yellow for selected, white for others
             );
@@ -1066,20 +995,12 @@ int32 UPURadialMenu::NativePaint(const FPaintArgs& Args, const FGeometry& Allott
     if (bShouldDrawDirectionLine && CurrentDirectionLength > 0.0f && bIsVisible)
     {
         // Calculate the end point of the line based on angle and length
-        // Convert angle from degrees to radians
         // Note: 0° = right, positive = counter-clockwise (standard math convention)
-        float AngleRadians = FMath::DegreesToRadians(CurrentDirectionAngle);
-        
-        // Calculate direction vector
-        // The angle is in standard math coordinates (0° = right, 90° = up)
-        // But Unreal's UI uses: X increases right, Y increases DOWN
-        // Buttons are positioned with: Y = Center - (Radius * Sin(angle))
-        // So if angle is 90° (up), Sin(90°) = 1, so Y = Center - Radius (moves up)
-        // For the line to match, we need: when angle is 90°, line should point up
-        // Direction = (Cos, -Sin) gives: (0, -1) which is up in UI (Y decreases)
-        // But if controls are backwards, try: (Cos, Sin) without negation
-        FVector2D Direction(FMath::Cos(AngleRadians), FMath::Sin(AngleRadians)); // Try without -Sin
-        FVector2D EndPoint = Center + (Direction * CurrentDirectionLength);
+        // Uses +Sin, the same as the button positioning, so the line points at the buttons
+        const float AngleRadians = FMath::DegreesToRadians(CurrentDirectionAngle);
+        const FVector2f LineCenter = FVector2f(Center);
+        const FVector2f Direction(FMath::Cos(AngleRadians), FMath::Sin(AngleRadians));
+        const FVector2f EndPoint = LineCenter + (Direction * CurrentDirectionLength);
         
         // Calculate color intensity based on input magnitude (0.3 to 1.0 range)
         // Map to 0.5 to 1.0 for alpha, and use brighter colors for stronger input
@@ -1103,88 +1024,55 @@ int32 UPURadialMenu::NativePaint(const FPaintArgs& Args, const FGeometry& Allott
         );
         
         // Perpendicular direction (for diamond wings and arrowhead)
-        FVector2D Perpendicular(-Direction.Y, Direction.X);
+        const FVector2f Perpendicular(-Direction.Y, Direction.X);
         
         if (DirectionLineStyle == EDirectionLineStyle::Diamond)
         {
-            // Diamond style: kite shape (Tip at EndPoint, Base at Center, wings at midpoint)
-            // Same shape as before, but FILLED using custom verts
+            // Diamond style: kite shape (Tip at EndPoint, Base at Center, wings at midpoint), filled
             const float HalfWidth = DiamondWidth * 0.5f * NormalizedIntensity;
-            FVector2D MidPoint = Center + (Direction * CurrentDirectionLength * 0.5f);
-            FVector2D DiamondLeft = MidPoint + (Perpendicular * HalfWidth);
-            FVector2D DiamondRight = MidPoint - (Perpendicular * HalfWidth);
-            
-            // Diamond vertices: Tip (0), Right (1), Base (2), Left (3)
-            TArray<FVector2D> DiamondPoints;
-            DiamondPoints.Add(EndPoint);   // 0 Tip
-            DiamondPoints.Add(DiamondRight); // 1
-            DiamondPoints.Add(Center);     // 2 Base
-            DiamondPoints.Add(DiamondLeft); // 3
-            
-            const FSlateResourceHandle ResourceHandle = FSlateApplication::Get().GetRenderer()->GetResourceHandle(*FCoreStyle::Get().GetBrush("WhiteBrush"));
+            const FVector2f MidPoint = LineCenter + (Direction * CurrentDirectionLength * 0.5f);
+            const FVector2f DiamondPoints[4] =
+            {
+                EndPoint,                               // 0 Tip
+                MidPoint - (Perpendicular * HalfWidth), // 1 Right
+                LineCenter,                             // 2 Base
+                MidPoint + (Perpendicular * HalfWidth)  // 3 Left
+            };
             
-            // Build vertices for filled quad (2 triangles: 0-1-2 and 0-2-3)
-            TArray<FSlateVertex> DiamondVerts;
-            DiamondVerts.SetNum(4);
+            // Glow: slightly expanded diamond behind (points pushed outward from center, base pushed backward)
+            const float GlowExpand = DirectionLineGlowThickness * 0.5f;
+            const FColor GlowVertexColor = GlowColor.ToFColor(false);
+            PaintVertices.Reset();
             for (int32 i = 0; i < 4; ++i)
             {
-                DiamondVerts[i].Position = FVector2f(AllottedGeometry.LocalToAbsolute(DiamondPoints[i]));
-                DiamondVerts[i].Color = BaseColor.ToFColor(false);
-                DiamondVerts[i].TexCoords[0] = 0.5f;
-                DiamondVerts[i].TexCoords[1] = 0.5f;
-                DiamondVerts[i].TexCoords[2] = 1.0f;
-                DiamondVerts[i].TexCoords[3] = 1.0f;
+                const FVector2f GlowPoint = (i == 2)
+                    ? LineCenter - (Direction * GlowExpand)
+                    : DiamondPoints[i] + ((DiamondPoints[i] - LineCenter).GetSafeNormal() * GlowExpand);
+                PaintVertices.Add(SDirectionLineWidget::MakeVertex(RenderTransform, GlowPoint, GlowVertexColor));
             }
+            FSlateDrawElement::MakeCustomVerts(OutDrawElements, LayerId + 4, ResourceHandle, PaintVertices, DiamondIndices, nullptr, 0, 0);
             
-            TArray<SlateIndex> DiamondIndices = { 0, 1, 2, 0, 2, 3 };
-            
-            // Glow: slightly expanded diamond behind (scale points outward from center)
-            TArray<FSlateVertex> GlowVerts;
-            GlowVerts.SetNum(4);
-            const float GlowExpand = DirectionLineGlowThickness * 0.5f;
+            const FColor DiamondVertexColor = BaseColor.ToFColor(false);
+            PaintVertices.Reset();
             for (int32 i = 0; i < 4; ++i)
             {
-                FVector2D GlowPoint;
-                if (i == 2) // Base at center - expand backward
-                {
-                    GlowPoint = Center - (Direction * GlowExpand);
-                }
-                else
-                {
-                    FVector2D ToPoint = DiamondPoints[i] - Center;
-                    ToPoint.Normalize();
-                    GlowPoint = DiamondPoints[i] + (ToPoint * GlowExpand);
-                }
-                GlowVerts[i].Position = FVector2f(AllottedGeometry.LocalToAbsolute(GlowPoint));
-                GlowVerts[i].Color = GlowColor.ToFColor(false);
-                GlowVerts[i].TexCoords[0] = 0.5f;
-                GlowVerts[i].TexCoords[1] = 0.5f;
-                GlowVerts[i].TexCoords[2] = 1.0f;
-                GlowVerts[i].TexCoords[3] = 1.0f;
+                PaintVertices.Add(SDirectionLineWidget::MakeVertex(RenderTransform, DiamondPoints[i], DiamondVertexColor));
             }
-            
-            FSlateDrawElement::MakeCustomVerts(OutDrawElements, LayerId + 4, ResourceHandle, GlowVerts, DiamondIndices, nullptr, 0, 0);
-            FSlateDrawElement::MakeCustomVerts(OutDrawElements, LayerId + 5, ResourceHandle, DiamondVerts, DiamondIndices, nullptr, 0, 0);
+            FSlateDrawElement::MakeCustomVerts(OutDrawElements, LayerId + 5, ResourceHandle, PaintVertices, DiamondIndices, nullptr, 0, 0);
         }
         else // EDirectionLineStyle::Line
         {
             // Draw glow/shadow effect (thicker, semi-transparent line behind)
-            TArray<FVector2D> GlowLinePoints;
-            GlowLinePoints.Add(Center);
-            GlowLinePoints.Add(EndPoint);
+            PaintVertices.Reset();
+            PaintIndices.Reset();
+            SDirectionLineWidget::AppendLineGeometry(PaintVertices, PaintIndices, RenderTransform,
+                LineCenter, EndPoint, DirectionLineGlowThickness, GlowColor, GlowColor);
+            FSlateDrawElement::MakeCustomVerts(OutDrawElements, LayerId + 4, ResourceHandle, PaintVertices, PaintIndices, nullptr, 0, 0);
             
-            FSlateDrawElement::MakeLines(
-                OutDrawElements,
-                LayerId + 4, // Draw behind main line
-                AllottedGeometry.ToPaintGeometry(),
-                GlowLinePoints,
-                ESlateDrawEffect::None,
-                GlowColor,
-                true,  // bAntialias for smooth glow
-                DirectionLineGlowThickness   // Use exposed property
-            );
-            
-            // Draw gradient line using multiple segments for smooth fade
+            // Gradient line (segments fading toward the end) and arrowhead go out as one batch,
+            // arrowhead last so it draws over the line
+            PaintVertices.Reset();
+            PaintIndices.Reset();
             const int32 GradientSegments = DirectionLineGradientSegments;
             for (int32 i = 0; i < GradientSegments; ++i)
             {
@@ -1193,69 +1081,30 @@ int32 UPURadialMenu::NativePaint(const FPaintArgs& Args, const FGeometry& Allott
                 
                 float StartOpacity = 1.0f - (SegmentStart * DirectionLineEndFadeAmount);
                 
-                FVector2D SegmentStartPoint = Center + (Direction * CurrentDirectionLength * SegmentStart);
-                FVector2D SegmentEndPoint = Center + (Direction * CurrentDirectionLength * SegmentEnd);
-                
-                TArray<FVector2D> SegmentPoints;
-                SegmentPoints.Add(SegmentStartPoint);
-                SegmentPoints.Add(SegmentEndPoint);
-                
                 FLinearColor SegmentColor = BaseColor;
                 SegmentColor.A = StartOpacity * NormalizedIntensity;
                 
-                FSlateDrawElement::MakeLines(
-                    OutDrawElements,
-                    LayerId + 5,
-                    AllottedGeometry.ToPaintGeometry(),
-                    SegmentPoints,
-                    ESlateDrawEffect::None,
-                    SegmentColor,
-                    true,
-                    DirectionLineThickness
-                );
+                SDirectionLineWidget::AppendLineGeometry(PaintVertices, PaintIndices, RenderTransform,
+                    LineCenter + (Direction * CurrentDirectionLength * SegmentStart),
+                    LineCenter + (Direction * CurrentDirectionLength * SegmentEnd),
+                    DirectionLineThickness, SegmentColor, SegmentColor);
             }
             
             // Draw arrowhead at the end
             const float ArrowheadLength = DirectionLineArrowheadLength;
             const float ArrowheadAngle = FMath::DegreesToRadians(DirectionLineArrowheadAngle);
-            
-            FVector2D ArrowLeft = EndPoint - (Direction * ArrowheadLength * FMath::Cos(ArrowheadAngle)) 
-                                  + (Perpendicular * ArrowheadLength * FMath::Sin(ArrowheadAngle));
-            FVector2D ArrowRight = EndPoint - (Direction * ArrowheadLength * FMath::Cos(ArrowheadAngle))
-                                   - (Perpendicular * ArrowheadLength * FMath::Sin(ArrowheadAngle));
-            
-            TArray<FVector2D> ArrowLeftLine;
-            ArrowLeftLine.Add(EndPoint);
-            ArrowLeftLine.Add(ArrowLeft);
-            
-            TArray<FVector2D> ArrowRightLine;
-            ArrowRightLine.Add(EndPoint);
-            ArrowRightLine.Add(ArrowRight);
+            const FVector2f ArrowBack = EndPoint - (Direction * ArrowheadLength * FMath::Cos(ArrowheadAngle));
+            const FVector2f ArrowSpread = Perpendicular * ArrowheadLength * FMath::Sin(ArrowheadAngle);
             
             FLinearColor ArrowColor = BaseColor;
             ArrowColor.A = 1.0f;
             
-            FSlateDrawElement::MakeLines(
-                OutDrawElements,
-                LayerId + 6,
-                AllottedGeometry.ToPaintGeometry(),
-                ArrowLeftLine,
-                ESlateDrawEffect::None,
-                ArrowColor,
-                true,
-                DirectionLineArrowheadThickness
-            );
+            SDirectionLineWidget::AppendLineGeometry(PaintVertices, PaintIndices, RenderTransform,
+                EndPoint, ArrowBack + ArrowSpread, DirectionLineArrowheadThickness, ArrowColor, ArrowColor);
+            SDirectionLineWidget::AppendLineGeometry(PaintVertices, PaintIndices, RenderTransform,
+                EndPoint, ArrowBack - ArrowSpread, DirectionLineArrowheadThickness, ArrowColor, ArrowColor);
             
-            FSlateDrawElement::MakeLines(
-                OutDrawElements,
-                LayerId + 6,
-                AllottedGeometry.ToPaintGeometry(),
-                ArrowRightLine,
-                ESlateDrawEffect::None,
-                ArrowColor,
-                true,
-                DirectionLineArrowheadThickness
-            );
+            FSlateDrawElement::MakeCustomVerts(OutDrawElements, LayerId + 5, ResourceHandle, PaintVertices, PaintIndices, nullptr, 0, 0);
         }
         
         // Draw a bright dot at the center for emphasis
@@ -1286,7 +1135,7 @@ int32 UPURadialMenu::NativePaint(const FPaintArgs& Args, const FGeometry& Allott
         
         // Get selected button info - use cached values to avoid accessing during GC
         FString SelectedButtonInfo = TEXT("None");
-        if (CachedSelectedIndex >= 0 && CachedSelectedIndex < NumButtons)
+        if (CachedSelectedIndex >= 0 && CachedSelectedIndex < NumRegions)
         {
             if (CachedSelectedIndex >= 0 && CachedSelectedIndex < NumMenuItems)
             {
@@ -1346,9 +1195,24 @@ int32 UPURadialMenu::NativePaint(const FPaintArgs& Args, const FGeometry& Allott
 
 void UPURadialMenu::UpdateDirectionLine(float AngleDegrees, float InputMagnitude)
 {
+    // If no input, hide the line
+    if (InputMagnitude <= 0.0f)
+    {
+        ClearDirectionLine();
+        return;
+    }
+    
     // Calculate line length based on input magnitude
     float LineLength = ItemRadius * FMath::Clamp(InputMagnitude, 0.3f, 1.0f);
     
+    // Skip the repaint if the line would look the same
+    if (bShouldDrawDirectionLine
+        && FMath::IsNearlyEqual(CurrentDirectionAngle, AngleDegrees, DirectionLineRepaintAngleTolerance)
+        && FMath::IsNearlyEqual(CurrentInputMagnitude, InputMagnitude, DirectionLineRepaintMagnitudeTolerance))
+    {
+        return;
+    }
+    
     // Update the mutable state for NativePaint
     CurrentDirectionAngle = AngleDegrees;
     CurrentDirectionLength = LineLength;
@@ -1356,22 +1220,20 @@ void UPURadialMenu::UpdateDirectionLine(float AngleDegrees, float InputMagnitude
     bShouldDrawDirectionLine = true;
     
     // Invalidate the widget to trigger a repaint
-    if (IsValid(this))
+    Invalidate(EInvalidateWidget::Paint);
+}
+
+void UPURadialMenu::ClearDirectionLine()
+{
+    if (!bShouldDrawDirectionLine)
     {
-        Invalidate(EInvalidateWidget::Paint);
+        return;
     }
     
-    // If no input, hide the line
-    if (InputMagnitude <= 0.0f)
-    {
-        bShouldDrawDirectionLine = false;
-        CurrentDirectionLength = 0.0f;
-        CurrentInputMagnitude = 0.0f;
-        if (IsValid(this))
-        {
-            Invalidate(EInvalidateWidget::Paint);
-        }
-    }
+    bShouldDrawDirectionLine = false;
+    CurrentDirectionLength = 0.0f;
+    CurrentInputMagnitude = 0.0f;
+    Invalidate(EInvalidateWidget::Paint);
 }
 
 void UPURadialMenu::PreviewRadialLayout()
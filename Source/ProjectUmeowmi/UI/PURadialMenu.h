@@ -3,6 +3,8 @@
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
 #include "GameplayTagContainer.h"
+#include "Fonts/SlateFontInfo.h"
+#include "Rendering/RenderingCommon.h"
 #include "PURadialMenu.generated.h"
 
 class UImage;
@@ -73,7 +75,7 @@ enum class EDirectionLineStyle : uint8
  * Radial menu widget for displaying circular menu options
  * Used for ingredient slot preparation and action menus
  */
-UCLASS(BlueprintType, Blueprintable)
+UCLASS(BlueprintType, Blueprintable, meta = (DisableNativeTick))
 class PROJECTUMEOWMI_API UPURadialMenu : public UUserWidget
 {
     GENERATED_BODY()
@@ -83,8 +85,12 @@ public:
 
     virtual void NativeConstruct() override;
     virtual void NativeDestruct() override;
-    virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
     virtual FReply NativeOnKeyDown(const FGeometry& InGeometry, const FKeyEvent& InKeyEvent) override;
+    virtual FReply NativeOnAnalogValueChanged(const FGeometry& InGeometry, const FAnalogInputEvent& InAnalogEvent) override;
+
+    // Left stick selection. Returns true if the event was a left stick axis and the menu is open.
+    // Also called by the owning slot, which still has focus for a moment after the menu opens.
+    bool HandleStickInput(const FAnalogInputEvent& InAnalogEvent);
 
     // Set the menu items to display
     UFUNCTION(BlueprintCallable, Category = "Radial Menu")
@@ -274,6 +280,12 @@ private:
     // Helper function to update menu layout
     void UpdateMenuLayout();
 
+    // Rebuild SectorTable from the current layout angles and enabled items
+    void BuildSectorTable();
+
+    // Rebuild the retained debug region geometry and labels from the current item count and radius
+    void BuildPaintGeometry();
+
     // Clear all menu item buttons
     void ClearMenuItems();
 
@@ -297,8 +309,9 @@ private:
     
     // Joystick-based selection state
     float JoystickDeadzone = 0.3f; // Deadzone to prevent drift
-    float JoystickSelectionCooldown = 0.0f; // Cooldown to prevent rapid switching
-    const float JoystickSelectionRepeatDelay = 0.1f; // Delay between selection changes
+    
+    // Stick angle (1 degree sectors, 0 = right, counter-clockwise) -> closest enabled item index (INDEX_NONE if none)
+    TArray<int32> SectorTable;
     
     // Select menu item based on joystick direction (angle in degrees)
     void SelectMenuItemByAngle(float AngleDegrees);
@@ -309,9 +322,12 @@ private:
     // Update the visual indicator to point to the selected menu item
     void UpdateSelectionIndicator();
     
-    // Update the direction line to point from center to stick/mouse direction
+    // Update the direction line to point from center to stick/mouse direction (repaints only if it visibly changed)
     void UpdateDirectionLine(float AngleDegrees, float InputMagnitude);
     
+    // Hide the direction line (repaints only if it was shown)
+    void ClearDirectionLine();
+    
     // Custom paint to draw the direction line using Slate (like radar graphs)
     virtual int32 NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, 
                              const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, 
@@ -325,5 +341,27 @@ private:
     mutable float CurrentStickX = 0.0f;
     mutable float CurrentStickY = 0.0f;
 
+    // Debug label for one region, relative to the menu center
+    struct FRegionLabel
+    {
+        FString Text;
+        FVector2D Offset = FVector2D::ZeroVector; // Top-left of the text
+        FVector2D Size = FVector2D::ZeroVector;
+    };
+
+    // Retained paint geometry, rebuilt by BuildPaintGeometry on layout changes only.
+    // Vertices are relative to the menu center and moved to render space as they are painted.
+    TArray<FSlateVertex> RegionLineVertices;
+    TArray<SlateIndex> RegionLineIndices;
+    TArray<FSlateVertex> RegionHighlightVertices; // One line per item, drawn one at a time
+    TArray<SlateIndex> RegionHighlightIndices;    // Indices of a single line
+    TArray<SlateIndex> DiamondIndices;
+    TArray<FRegionLabel> RegionLabels;
+    FSlateFontInfo RegionLabelFont;
+
+    // Render space scratch buffers, reserved up front so painting does not allocate
+    mutable TArray<FSlateVertex> PaintVertices;
+    mutable TArray<SlateIndex> PaintIndices;
+
 };
 
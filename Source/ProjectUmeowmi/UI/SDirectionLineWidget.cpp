@@ -1,6 +1,15 @@
 #include "SDirectionLineWidget.h"
 #include "Rendering/DrawElements.h"
 #include "Math/UnrealMathUtility.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Rendering/SlateRenderer.h"
+#include "Styling/CoreStyle.h"
+
+namespace
+{
+    // Width of the transparent fringe on each side of a line (what MakeLines' antialiasing would give)
+    constexpr float LineFeatherWidth = 1.0f;
+}
 
 void SDirectionLineWidget::Construct(const FArguments& InArgs)
 {
@@ -9,6 +18,10 @@ void SDirectionLineWidget::Construct(const FArguments& InArgs)
     LineLength = InArgs._LineLength.Get(100.0f);
     AngleDegrees = InArgs._AngleDegrees.Get(0.0f);
     bIsVisible = InArgs._bIsVisible.Get(true);
+
+    UpdateEndOffset();
+    PaintVertices.Reserve(LineVertexCount);
+    PaintIndices.Reserve(LineIndexCount);
 }
 
 int32 SDirectionLineWidget::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry,
@@ -21,46 +34,92 @@ int32 SDirectionLineWidget::OnPaint(const FPaintArgs& Args, const FGeometry& All
     }
 
     // Get the center of the widget
-    FVector2D Center = AllottedGeometry.GetLocalSize() * 0.5f;
+    const FVector2f Center = FVector2f(AllottedGeometry.GetLocalSize() * 0.5f);
+
+    PaintVertices.Reset();
+    PaintIndices.Reset();
+    AppendLineGeometry(PaintVertices, PaintIndices, AllottedGeometry.GetAccumulatedRenderTransform(),
+        Center, Center + EndOffset, LineThickness, LineColor, LineColor);
+
+    const FSlateResourceHandle ResourceHandle = FSlateApplication::Get().GetRenderer()->GetResourceHandle(*FCoreStyle::Get().GetBrush("WhiteBrush"));
+    FSlateDrawElement::MakeCustomVerts(OutDrawElements, LayerId, ResourceHandle, PaintVertices, PaintIndices, nullptr, 0, 0);
     
-    // Calculate the end point of the line based on angle and length
-    // Convert angle from degrees to radians
+    return LayerId;
+}
+
+void SDirectionLineWidget::UpdateEndOffset()
+{
     // Note: 0° = right, positive = counter-clockwise (standard math convention)
-    float AngleRadians = FMath::DegreesToRadians(AngleDegrees);
-    
-    // Calculate direction vector (cos for X, sin for Y, but we need to account for Unreal's coordinate system)
     // In Unreal's UI: X increases right, Y increases down
     // So we need: X = cos(angle), Y = -sin(angle) (negative because Y increases down)
-    FVector2D Direction(FMath::Cos(AngleRadians), -FMath::Sin(AngleRadians));
-    FVector2D EndPoint = Center + (Direction * LineLength);
-    
-    // Create a brush for the line
-    FSlateBrush LineBrush;
-    LineBrush.TintColor = FSlateColor(LineColor);
-    
-    // Draw the line using FSlateDrawElement
-    // We'll draw it as a series of line segments or use DrawLines
-    TArray<FVector2D> LinePoints;
-    LinePoints.Add(Center);
-    LinePoints.Add(EndPoint);
-    
-    TArray<FLinearColor> LineColors;
-    LineColors.Add(LineColor);
-    LineColors.Add(LineColor);
-    
-    // Draw the line
-    FSlateDrawElement::MakeLines(
-        OutDrawElements,
-        LayerId,
-        AllottedGeometry.ToPaintGeometry(),
-        LinePoints,
-        ESlateDrawEffect::None,
-        LineColor,
-        false, // bAntialias
-        LineThickness
-    );
-    
-    return LayerId;
+    const float AngleRadians = FMath::DegreesToRadians(AngleDegrees);
+    EndOffset = FVector2f(FMath::Cos(AngleRadians), -FMath::Sin(AngleRadians)) * LineLength;
+}
+
+FSlateVertex SDirectionLineWidget::MakeVertex(const FSlateRenderTransform& Transform, const FVector2f& LocalPosition, const FColor& Color)
+{
+    FSlateVertex Vertex;
+    Vertex.Position = Transform.TransformPoint(LocalPosition);
+    Vertex.Color = Color;
+    Vertex.TexCoords[0] = 0.5f;
+    Vertex.TexCoords[1] = 0.5f;
+    Vertex.TexCoords[2] = 1.0f;
+    Vertex.TexCoords[3] = 1.0f;
+    return Vertex;
+}
+
+void SDirectionLineWidget::AppendLineGeometry(TArray<FSlateVertex>& OutVertices, TArray<SlateIndex>& OutIndices,
+                                              const FSlateRenderTransform& Transform, const FVector2f& Start, const FVector2f& End,
+                                              float Thickness, const FLinearColor& StartColor, const FLinearColor& EndColor)
+{
+    const FVector2f Direction = (End - Start).GetSafeNormal();
+    if (Direction.IsZero())
+    {
+        return;
+    }
+
+    // Across the line: outer edge (transparent), inner edge, inner edge, outer edge (transparent)
+    const FVector2f Normal(-Direction.Y, Direction.X);
+    const float HalfThickness = Thickness * 0.5f;
+    const float AcrossOffsets[4] = { HalfThickness + LineFeatherWidth, HalfThickness, -HalfThickness, -(HalfThickness + LineFeatherWidth) };
+    const float AcrossAlpha[4] = { 0.0f, 1.0f, 1.0f, 0.0f };
+
+    const SlateIndex BaseIndex = static_cast<SlateIndex>(OutVertices.Num());
+    for (int32 Row = 0; Row < 2; ++Row)
+    {
+        const FVector2f& Point = Row == 0 ? Start : End;
+        const FLinearColor& PointColor = Row == 0 ? StartColor : EndColor;
+        for (int32 Across = 0; Across < 4; ++Across)
+        {
+            FLinearColor Color = PointColor;
+            Color.A *= AcrossAlpha[Across];
+            OutVertices.Add(MakeVertex(Transform, Point + Normal * AcrossOffsets[Across], Color.ToFColor(false)));
+        }
+    }
+
+    // Feather, core, feather: two triangles each between the start row (0-3) and the end row (4-7)
+    for (SlateIndex Strip = 0; Strip < 3; ++Strip)
+    {
+        const SlateIndex StartInner = BaseIndex + Strip;
+        const SlateIndex EndInner = BaseIndex + 4 + Strip;
+        OutIndices.Add(StartInner);
+        OutIndices.Add(StartInner + 1);
+        OutIndices.Add(EndInner);
+        OutIndices.Add(StartInner + 1);
+        OutIndices.Add(EndInner + 1);
+        OutIndices.Add(EndInner);
+    }
+}
+
+void SDirectionLineWidget::TransformGeometry(TConstArrayView<FSlateVertex> LocalVertices, const FSlateRenderTransform& Transform,
+                                             const FVector2f& Origin, TArray<FSlateVertex>& OutVertices)
+{
+    OutVertices.Reset();
+    for (const FSlateVertex& LocalVertex : LocalVertices)
+    {
+        FSlateVertex& Vertex = OutVertices.Add_GetRef(LocalVertex);
+        Vertex.Position = Transform.TransformPoint(Origin + LocalVertex.Position);
+    }
 }
 
 FVector2D SDirectionLineWidget::ComputeDesiredSize(float) const
@@ -74,26 +133,32 @@ FVector2D SDirectionLineWidget::ComputeDesiredSize(float) const
 void SDirectionLineWidget::SetLineColor(const FLinearColor& InColor)
 {
     LineColor = InColor;
+    Invalidate(EInvalidateWidgetReason::Paint);
 }
 
 void SDirectionLineWidget::SetLineThickness(float InThickness)
 {
     LineThickness = InThickness;
+    Invalidate(EInvalidateWidgetReason::Paint);
 }
 
 void SDirectionLineWidget::SetLineLength(float InLength)
 {
     LineLength = InLength;
+    UpdateEndOffset();
+    // Desired size follows the length
+    Invalidate(EInvalidateWidgetReason::Layout);
 }
 
 void SDirectionLineWidget::SetAngleDegrees(float InAngle)
 {
     AngleDegrees = InAngle;
+    UpdateEndOffset();
+    Invalidate(EInvalidateWidgetReason::Paint);
 }
 
 void SDirectionLineWidget::SetVisibility(bool bVisible)
 {
     bIsVisible = bVisible;
+    Invalidate(EInvalidateWidgetReason::Paint);
 }
-
-
@@ -4,6 +4,8 @@
 #include "Widgets/SWidget.h"
 #include "Widgets/DeclarativeSyntaxSupport.h"
 #include "Rendering/DrawElements.h"
+#include "Rendering/RenderingCommon.h"
+#include "Rendering/SlateRenderTransform.h"
 
 /**
  * Custom Slate widget that draws a line from center to a target direction
@@ -35,19 +37,49 @@ public:
     
     virtual FVector2D ComputeDesiredSize(float) const override;
 
-    // Update the line properties
+    // Update the line properties (each invalidates the widget, so it also paints correctly under global invalidation)
     void SetLineColor(const FLinearColor& InColor);
     void SetLineThickness(float InThickness);
     void SetLineLength(float InLength);
     void SetAngleDegrees(float InAngle);
     void SetVisibility(bool bVisible);
 
+    // Vertices / indices written by AppendLineGeometry for one line
+    static constexpr int32 LineVertexCount = 8;
+    static constexpr int32 LineIndexCount = 18;
+
+    // Untextured vertex (for the white brush) at Transform(LocalPosition)
+    static FSlateVertex MakeVertex(const FSlateRenderTransform& Transform, const FVector2f& LocalPosition, const FColor& Color);
+
+    /**
+     * Append a line as a filled quad with a one pixel feathered edge on each side, so any number of lines
+     * can go out in a single MakeCustomVerts call and still look antialiased. Pass an identity transform
+     * to keep the vertices local (for cached geometry moved to render space with TransformGeometry).
+     */
+    static void AppendLineGeometry(TArray<FSlateVertex>& OutVertices, TArray<SlateIndex>& OutIndices,
+                                   const FSlateRenderTransform& Transform, const FVector2f& Start, const FVector2f& End,
+                                   float Thickness, const FLinearColor& StartColor, const FLinearColor& EndColor);
+
+    // Copy local vertices into OutVertices, offset by Origin and moved to render space (no allocation once OutVertices has the capacity)
+    static void TransformGeometry(TConstArrayView<FSlateVertex> LocalVertices, const FSlateRenderTransform& Transform,
+                                  const FVector2f& Origin, TArray<FSlateVertex>& OutVertices);
+
 private:
+    // Recompute EndOffset (trig happens here, not in OnPaint)
+    void UpdateEndOffset();
+
     FLinearColor LineColor;
     float LineThickness;
     float LineLength;
     float AngleDegrees;
     bool bIsVisible;
+
+    // Line end relative to the widget center
+    FVector2f EndOffset = FVector2f::ZeroVector;
+
+    // Paint buffers, kept between paints so painting does not allocate
+    mutable TArray<FSlateVertex> PaintVertices;
+    mutable TArray<SlateIndex> PaintIndices;
 };
 
 